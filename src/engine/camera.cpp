@@ -45,9 +45,9 @@ void TA_Camera::update(bool ground, bool spring) {
 
     auto move = [&](float current, float need) {
         if(current < need) {
-            current = std::min(need, current + movementSpeed * TA::elapsedTime);
+            current = std::min(need, current + movementSpeed * context->elapsedTime);
         } else {
-            current = std::max(need, current - movementSpeed * TA::elapsedTime);
+            current = std::max(need, current - movementSpeed * context->elapsedTime);
         }
         return current;
     };
@@ -91,22 +91,22 @@ void TA_Camera::update(bool ground, bool spring) {
         position.y = std::max(position.y, borderTopLeft.y);
     }
     if((borderMask & (1 << 1)) != 0) {
-        position.y = std::min(position.y, borderBottomRight.y - TA::screenHeight);
+        position.y = std::min(position.y, borderBottomRight.y - context->screenHeight);
     }
     if((borderMask & (1 << 2)) != 0) {
         position.x = std::max(position.x, borderTopLeft.x);
     }
     if((borderMask & (1 << 3)) != 0) {
-        position.x = std::min(position.x, borderBottomRight.x - TA::screenWidth);
+        position.x = std::min(position.x, borderBottomRight.x - context->screenWidth);
     }
 
     if(shakeTime > 0) {
         int previousStep = shakeTime / shakeFrequency;
-        shakeTime -= TA::elapsedTime;
+        shakeTime -= context->elapsedTime;
         int currentStep = shakeTime / shakeFrequency;
         if(previousStep != currentStep) {
-            shakeDelta.x = (TA::random::next() % 2 == 0 ? -shakeRadius : shakeRadius);
-            shakeDelta.y = (TA::random::next() % 2 == 0 ? -shakeRadius : shakeRadius);
+            shakeDelta.x = (TA::random::next(context) % 2 == 0 ? -shakeRadius : shakeRadius);
+            shakeDelta.y = (TA::random::next(context) % 2 == 0 ? -shakeRadius : shakeRadius);
         }
     } else {
         shakeDelta = {0, 0};
@@ -114,7 +114,7 @@ void TA_Camera::update(bool ground, bool spring) {
 }
 
 void TA_Camera::updateOffset() {
-    if(TA::levelPath == "maps/pm/pm4") {
+    if(flightLevel) {
         yTopOffset = -8;
         yBottomOffset = 16;
     } else {
@@ -1,6 +1,7 @@
 #ifndef TA_CAMERA_H
 #define TA_CAMERA_H
 
+#include "context.h"
 #include "geometry.h"
 
 class TA_Camera {
@@ -18,10 +19,12 @@ private:
 
     int yTopOffset, yBottomOffset;
     int borderMask = 15;
-    bool locked = false, lockedX = false, lockedY = false;
+    bool locked = false, lockedX = false, lockedY = false, flightLevel = false;
     float shakeTime = -1;
+    TA_Context* context = nullptr;
 
 public:
+    void setContext(TA_Context* newContext) { context = newContext; }
     void update(bool ground, bool spring);
     void setFollowPosition(TA_Point* newFollowPosition);
     void setLockPosition(TA_Point newLockPosition);
@@ -30,6 +33,7 @@ public:
     void unlock() { locked = lockedX = lockedY = false; }
     void setBorder(TA_Point topLeft, TA_Point bottomRight);
     void setBorderMask(int mask) { borderMask = mask; }
+    void setFlightLevel(bool enabled) { flightLevel = enabled; }
     void shake(float time) { shakeTime = time; }
     TA_Point getPosition() { return position + shakeDelta; }
     TA_Point getRelative(TA_Point realPosition) { return realPosition - (position + shakeDelta); }
@@ -9,30 +9,33 @@
 #include "tools.h"
 
 void TA_Character::load(TA_Links newLinks) {
+    if(newLinks.level == nullptr) {
+        TA::handleError("%s", "character links have no level context");
+    }
     links = newLinks;
     jumpSound.load("sound/jump.ogg", TA_SOUND_CHANNEL_SFX1);
     remoteRobotStepSound.load("sound/remote_robot_step.ogg", TA_SOUND_CHANNEL_SFX1);
     flySound.load("sound/fly.ogg", TA_SOUND_CHANNEL_SFX1);
     remoteRobotFlySound.load("sound/remote_robot_fly.ogg", TA_SOUND_CHANNEL_SFX1);
-    damageSound.load("sound/damage.ogg", TA_SOUND_CHANNEL_SFX1);
+    damageSound.load("sound/damage.ogg", TA_SOUND_CHANNEL_SFX1, false, TA_SOUND_PRIORITY_HIGH);
     hammerSound.load("sound/hammer.ogg", TA_SOUND_CHANNEL_SFX3);
-    teleportSound.load("sound/teleport.ogg", TA_SOUND_CHANNEL_SFX3);
+    teleportSound.load("sound/teleport.ogg", TA_SOUND_CHANNEL_SFX3, false, TA_SOUND_PRIORITY_HIGH);
     waterSound.load("sound/water.ogg", TA_SOUND_CHANNEL_SFX1);
     nightVisionSound.load("sound/land.ogg", TA_SOUND_CHANNEL_SFX3);
 
-    loadFromToml("tails/tails.toml");
+    loadFromToml(links.context, "tails/tails.toml");
     setCamera(links.camera);
 
-    remoteRobotControlSprite.loadFromToml("tails/tails.toml");
+    remoteRobotControlSprite.loadFromToml(links.context, "tails/tails.toml");
     remoteRobotControlSprite.setAnimation("control_remote_robot");
     remoteRobotControlSprite.setCamera(links.camera);
-    rings = TA::save::getSaveParameter("rings");
+    rings = TA::save::getSaveParameter(links.context, "rings");
 
     debugMode = TA::arguments.contains("--debug");
 }
 
 void TA_Character::handleInput() {
-    rings = TA::save::getSaveParameter("rings");
+    rings = TA::save::getSaveParameter(links.context, "rings");
     hidden = nextFrameHidden;
     if(hidden) {
         return;
@@ -43,7 +46,7 @@ void TA_Character::handleInput() {
             noclip = !noclip;
         }
         if(noclip) {
-            position += links.controller->getDirectionVector() * TA::elapsedTime * 5;
+            position += links.controller->getDirectionVector() * links.context->elapsedTime * 5;
             setPosition(position);
             updateFollowPosition();
             return;
@@ -68,13 +71,13 @@ void TA_Character::handleInput() {
 }
 
 void TA_Character::update() {
-    rings = TA::save::getSaveParameter("rings");
+    rings = TA::save::getSaveParameter(links.context, "rings");
     if(hidden || noclip) {
         return;
     }
 
     if(invincibleTimeLeft >= 0) {
-        invincibleTimeLeft -= TA::elapsedTime;
+        invincibleTimeLeft -= links.context->elapsedTime;
     }
 
     if(state == STATE_HAMMER) {
@@ -100,12 +103,12 @@ void TA_Character::update() {
     }
 
     if(state == STATE_DEAD) {
-        invincibleTimeLeft -= TA::elapsedTime;
+        invincibleTimeLeft -= links.context->elapsedTime;
         return;
     }
 
     if(state == STATE_REMOTE_ROBOT_INIT) {
-        timer += TA::elapsedTime;
+        timer += links.context->elapsedTime;
         setAlpha(255 * (timer / remoteRobotInitTime));
         if(timer > remoteRobotInitTime) {
             state = STATE_NORMAL;
@@ -253,11 +256,12 @@ void TA_Character::updateFollowPosition() {
     if(state == STATE_CLIMB_LOW || state == STATE_CLIMB_HIGH) {
         sourcePosition.x = climbPosition.x;
     }
-    followPosition = sourcePosition + TA_Point(22 - TA::screenWidth / 2, 26 - TA::screenHeight / 2);
+    followPosition =
+        sourcePosition + TA_Point(22 - links.context->screenWidth / 2, 26 - links.context->screenHeight / 2);
 
     if(ground && (links.controller->getDirection() == TA_DIRECTION_UP ||
                      links.controller->getDirection() == TA_DIRECTION_DOWN)) {
-        lookTime += TA::elapsedTime;
+        lookTime += links.context->elapsedTime;
     } else {
         lookTime = 0;
     }
@@ -278,7 +282,7 @@ void TA_Character::setSpawnPoint(TA_Point newPosition, bool newFlip) {
 }
 
 void TA_Character::updateRemoteRobotReturn() {
-    timer = std::fmod(timer + TA::elapsedTime, 30);
+    timer = std::fmod(timer + links.context->elapsedTime, 30);
     if(timer < 15) {
         setAlpha(255 - 255 * (timer / 5));
     } else {
@@ -301,7 +305,7 @@ void TA_Character::updateRemoteRobotReturn() {
     float divisor = velocity.length();
     velocity.x /= divisor;
     velocity.y /= divisor;
-    position = position + velocity * TA::elapsedTime;
+    position = position + velocity * links.context->elapsedTime;
 
     setPosition(position);
     updateFollowPosition();
@@ -327,7 +331,7 @@ void TA_Character::setWindVelocity(TA_Point windVelocity) {
         this->windVelocity = windVelocity;
     } else {
         ground = jump = helitail = false;
-        velocity.y -= strongWindForce * TA::elapsedTime;
+        velocity.y -= strongWindForce * links.context->elapsedTime;
         velocity.y = std::max(velocity.y, float(-5));
         strongWind = true;
         if(hurt && rings >= 1) {
@@ -338,14 +342,14 @@ void TA_Character::setWindVelocity(TA_Point windVelocity) {
 }
 
 float TA_Character::getMaxHelitailTime() {
-    if(TA::levelPath == "maps/pm/pm4") {
+    if(links.level->flightLevel) {
         return 1e6;
     }
     return 140 + 70 * links.objectSet->getEmeraldsCount();
 }
 
 bool TA_Character::displayFlightTimeBar() {
-    if(TA::levelPath == "maps/pm/pm4") {
+    if(links.level->flightLevel) {
         return false;
     }
     if(state == STATE_TELEPORT) {
@@ -3,7 +3,6 @@
 #include "object_set.h"
 #include "ring.h"
 #include "save.h"
-#include "splash.h"
 #include "tilemap.h"
 
 int TA_Character::getSolidFlags() {
@@ -72,10 +71,10 @@ void TA_Character::updateCollisions() {
 
     useMovingPlatforms = true;
     TA_Point positionDelta;
-    if(TA::levelPath.substr(0, 7) == "maps/ci") {
-        positionDelta = velocity * TA::elapsedTime;
+    if(links.level->windAsFlow) {
+        positionDelta = velocity * links.context->elapsedTime;
     } else {
-        positionDelta = (velocity + windVelocity) * TA::elapsedTime;
+        positionDelta = (velocity + windVelocity) * links.context->elapsedTime;
     }
 
     int flags = links.objectSet->checkCollision(hitbox);
@@ -83,11 +82,11 @@ void TA_Character::updateCollisions() {
     if(ground) {
         conveyorBelt = false;
         if((flags & TA_COLLISION_CONVEYOR_BELT_LEFT) != 0) {
-            positionDelta.x -= 0.8F * TA::elapsedTime;
+            positionDelta.x -= 0.8F * links.context->elapsedTime;
             conveyorBelt = true;
         }
         if((flags & TA_COLLISION_CONVEYOR_BELT_RIGHT) != 0) {
-            positionDelta.x += 0.8F * TA::elapsedTime;
+            positionDelta.x += 0.8F * links.context->elapsedTime;
             conveyorBelt = true;
         }
     }
@@ -190,7 +189,8 @@ void TA_Character::updateCollisions() {
         }
     }
 
-    if(TA::levelPath.substr(0, 7) == "maps/ci" && (!TA::equal(windVelocity.x, 0) || !TA::equal(windVelocity.y, 0))) {
+    if(links.level->windAsFlow &&
+        (!TA::equal(windVelocity.x, 0) || !TA::equal(windVelocity.y, 0))) {
         ground = jump = jumpReleased = false;
     }
 
@@ -212,7 +212,7 @@ void TA_Character::updateClimb() {
     if(remoteRobot || !wall || !TA::equal(deltaX, 0)) {
         return;
     }
-    if(helitail && TA::levelPath == "maps/pm/pm4") {
+    if(helitail && links.level->flightLevel) {
         return;
     }
 
@@ -275,7 +275,7 @@ void TA_Character::updateClimb() {
                 ground = true;
                 jump = spring = wall = false;
                 if(water && !(collisionFlags & TA_COLLISION_WATER)) {
-                    links.objectSet->spawnObject<TA_Splash>(position + TA_Point(14, (height == 32 ? 6 : 22)));
+                    links.objectSet->getParticles().spawnSplash(position + TA_Point(14, (height == 32 ? 6 : 22)));
                     waterSound.play();
                     water = false;
                 }
@@ -324,7 +324,7 @@ void TA_Character::updateWaterCollision() {
 
     bool newWater = (links.objectSet->checkCollision(hitbox) & TA_COLLISION_WATER);
     if(water != newWater && newWater == (velocity.y > 0) && !ground) {
-        links.objectSet->spawnObject<TA_Splash>(position + TA_Point(14, 22));
+        links.objectSet->getParticles().spawnSplash(position + TA_Point(14, 22));
         waterSound.play();
     }
     if(water && !newWater && velocity.y < 0 && !spring) {
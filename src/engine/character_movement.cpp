@@ -1,11 +1,12 @@
 #include "character.h"
 #include "controller.h"
 #include "error.h"
+#include "level_context.h"
 #include "tools.h"
 
 void TA_Character::physicsStep() {
     if(!hurt) {
-        if(TA::levelPath.substr(0, 7) == "maps/ci" &&
+        if(links.level->windAsFlow &&
             (!TA::equal(windVelocity.x, 0) || !TA::equal(windVelocity.y, 0))) {
             updateWaterFlow();
         } else if(helitail) {
@@ -16,7 +17,7 @@ void TA_Character::physicsStep() {
             updateAir();
         }
     } else {
-        velocity.y += grv * (water ? 0.5F : 1) * TA::elapsedTime;
+        velocity.y += grv * (water ? 0.5F : 1) * links.context->elapsedTime;
         velocity.y = std::min(velocity.y, maxJumpSpeed * (water ? 0.5F : 1));
     }
 
@@ -59,13 +60,13 @@ void TA_Character::updateGround() {
 }
 
 void TA_Character::updateAir() {
-    coyoteTime += TA::elapsedTime;
+    coyoteTime += links.context->elapsedTime;
     horizontalMove();
 
     if(jump) {
-        jumpSpeed += grv * (water ? 0.5F : 1) * TA::elapsedTime;
+        jumpSpeed += grv * (water ? 0.5F : 1) * links.context->elapsedTime;
         jumpSpeed = std::min(jumpSpeed, maxJumpSpeed);
-        jumpTime += TA::elapsedTime;
+        jumpTime += links.context->elapsedTime;
 
         if(jump && !jumpReleased && !links.controller->isPressed(TA_BUTTON_A)) {
             jumpReleased = true;
@@ -75,7 +76,7 @@ void TA_Character::updateAir() {
         }
 
         if(water && jumpSpeed > maxJumpSpeed * 0.5F) {
-            jumpSpeed = std::max(maxJumpSpeed * 0.5F, jumpSpeed - waterFriction * TA::elapsedTime);
+            jumpSpeed = std::max(maxJumpSpeed * 0.5F, jumpSpeed - waterFriction * links.context->elapsedTime);
         }
         if(spring) {
             velocity.y = std::min(maxJumpSpeed * (water ? 0.5F : 1), jumpSpeed);
@@ -88,10 +89,10 @@ void TA_Character::updateAir() {
     }
 
     else {
-        velocity.y += grv * (water ? 0.5F : 1) * TA::elapsedTime;
+        velocity.y += grv * (water ? 0.5F : 1) * links.context->elapsedTime;
         velocity.y = std::min(velocity.y, maxJumpSpeed);
         if(water && velocity.y > maxJumpSpeed * 0.5F) {
-            velocity.y = std::max(maxJumpSpeed * 0.5F, velocity.y - waterFriction * TA::elapsedTime);
+            velocity.y = std::max(maxJumpSpeed * 0.5F, velocity.y - waterFriction * links.context->elapsedTime);
         }
 
         if(links.controller->isJustPressed(TA_BUTTON_A) && coyoteTime < maxCoyoteTime) {
@@ -107,13 +108,13 @@ void TA_Character::updateAir() {
 void TA_Character::updateHelitail() {
     auto process = [&](float& x, float need) {
         if(x > need) {
-            x = std::max(need, x - helitailAcc * TA::elapsedTime);
+            x = std::max(need, x - helitailAcc * links.context->elapsedTime);
         } else {
-            x = std::min(need, x + helitailAcc * TA::elapsedTime);
+            x = std::min(need, x + helitailAcc * links.context->elapsedTime);
         }
     };
 
-    helitailTime += TA::elapsedTime;
+    helitailTime += links.context->elapsedTime;
     TA_Point vector;
     TA_Direction direction = links.controller->getDirection();
     if(direction != TA_DIRECTION_MAX) {
@@ -166,17 +167,17 @@ void TA_Character::horizontalMove() {
 
     if(direction == TA_DIRECTION_RIGHT) {
         flip = false;
-        velocity.x += currentAcc * TA::elapsedTime;
+        velocity.x += currentAcc * links.context->elapsedTime;
         velocity.x = std::min(velocity.x, currentTopX);
     } else if(direction == TA_DIRECTION_LEFT) {
         flip = true;
-        velocity.x -= currentAcc * TA::elapsedTime;
+        velocity.x -= currentAcc * links.context->elapsedTime;
         velocity.x = std::max(velocity.x, -currentTopX);
     } else {
         if(velocity.x > 0) {
-            velocity.x = std::max(float(0), velocity.x - currentAcc * TA::elapsedTime);
+            velocity.x = std::max(float(0), velocity.x - currentAcc * links.context->elapsedTime);
         } else {
-            velocity.x = std::min(float(0), velocity.x + currentAcc * TA::elapsedTime);
+            velocity.x = std::min(float(0), velocity.x + currentAcc * links.context->elapsedTime);
         }
     }
 }
@@ -184,9 +185,9 @@ void TA_Character::horizontalMove() {
 void TA_Character::updateWaterFlow() {
     auto addAcceleration = [&](float& speed, float neededSpeed) {
         if(speed < neededSpeed) {
-            speed = std::min(neededSpeed, speed + waterFlowAcc * TA::elapsedTime);
+            speed = std::min(neededSpeed, speed + waterFlowAcc * links.context->elapsedTime);
         } else {
-            speed = std::max(neededSpeed, speed - waterFlowAcc * TA::elapsedTime);
+            speed = std::max(neededSpeed, speed - waterFlowAcc * links.context->elapsedTime);
         }
     };
 
@@ -113,7 +113,7 @@ void TA_Character::spawnLargeBomb() {
 void TA_Character::spawnRemoteRobot() {
     const std::vector<std::string> bossLevels{"maps/pf/pf3", "maps/pm/pm4", "maps/ci/ci3"};
 
-    if(!ground || std::find(bossLevels.begin(), bossLevels.end(), TA::levelPath) != bossLevels.end()) {
+    if(!ground || std::find(bossLevels.begin(), bossLevels.end(), links.context->levelPath) != bossLevels.end()) {
         damageSound.play();
         return;
     }
@@ -149,7 +149,7 @@ void TA_Character::updateHammer() {
     if(!ground) {
         TA_Point topLeft{18, 12}, bottomRight{30, 39};
         auto [delta, flags] = links.objectSet->moveAndCollide(
-            position, topLeft, bottomRight, velocity * TA::elapsedTime, getSolidFlags());
+            position, topLeft, bottomRight, velocity * links.context->elapsedTime, getSolidFlags());
         position += delta;
         if(flags & TA_GROUND_COLLISION) {
             ground = true;
@@ -198,10 +198,10 @@ void TA_Character::initTeleport() {
 }
 
 void TA_Character::updateTeleport() {
-    teleportTime += TA::elapsedTime;
+    teleportTime += links.context->elapsedTime;
     if(teleportTime > teleportInitTime) {
-        velocity.y -= grv * TA::elapsedTime;
-        position = position + velocity * TA::elapsedTime;
+        velocity.y -= grv * links.context->elapsedTime;
+        position = position + velocity * links.context->elapsedTime;
     }
     setPosition(position);
 }
@@ -220,7 +220,7 @@ void TA_Character::initNightVision() {
 }
 
 void TA_Character::updateNightVision() {
-    nightVisionTimer += TA::elapsedTime;
+    nightVisionTimer += links.context->elapsedTime;
     if(nightVisionTimer > nightVisionActivateTime) {
         nightVisionSound.play();
         links.tilemap->setLayerAlpha(links.tilemap->getNumLayers() - 1, 0);
@@ -239,6 +239,6 @@ void TA_Character::changeMusic() {
         "sound/pm.vgm", "sound/lc.vgm", "sound/radio.vgm", "sound/title.vgm", "sound/vt.vgm"};
 
     // TODO: don't play current music
-    int pos = TA::random::next() % (int)music.size();
+    int pos = TA::random::next(links.context) % (int)music.size();
     TA::sound::playMusic(music[pos]);
 }
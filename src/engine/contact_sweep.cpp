@@ -0,0 +1,12 @@
+#include "contact_sweep.h"
+
+void TA_ContactSweep::add(const TA_Rect& hitbox, int type, int owner) {
+    TA_Point topLeft = hitbox.getTopLeft(), bottomRight = hitbox.getBottomRight();
+    entries.push_back({topLeft.x, topLeft.y, bottomRight.x, bottomRight.y, type, owner});
+}
+
+void TA_ContactSweep::sort() {
+    std::sort(entries.begin(), entries.end(), [](const Entry& first, const Entry& second) {
+        return first.left < second.left;
+    });
+}
@@ -0,0 +1,56 @@
+#ifndef TA_CONTACT_SWEEP_H
+#define TA_CONTACT_SWEEP_H
+
+#include <algorithm>
+#include <vector>
+#include "geometry.h"
+
+// finds every overlapping pair of hitboxes at once: boxes are sorted by their left edge, so each one only has to be
+// tested against the boxes that are still open at that point
+class TA_ContactSweep {
+public:
+    struct Entry {
+        float left, top, right, bottom;
+        int type, owner;
+    };
+
+    void clear() { entries.clear(); }
+    void add(const TA_Rect& hitbox, int type, int owner);
+    int getCount() { return static_cast<int>(entries.size()); }
+
+    // calls function(first, second) once for every pair with different owners whose boxes overlap or touch
+    // touching boxes only count as a contact if hits() says so, which the caller checks for each direction
+    template <typename Function>
+    void forEachPair(Function function) {
+        sort();
+        open.clear();
+        for(const Entry& current : entries) {
+            std::erase_if(open, [&](const Entry* entry) { return entry->right < current.left; });
+            for(const Entry* entry : open) {
+                if(entry->owner != current.owner && entry->top <= current.bottom && current.top <= entry->bottom) {
+                    function(*entry, current);
+                }
+            }
+            open.push_back(&current);
+        }
+    }
+
+    // whether a query with the bounds of query hits box, decided like TA_Rect::intersects and the hitbox container
+    // decide it on this platform: with SSE a query whose right or bottom edge touches the box counts
+    static bool hits(const Entry& query, const Entry& box) {
+#ifdef SDL_SSE_INTRINSICS
+        return query.left < box.right && query.top < box.bottom && query.right >= box.left &&
+               query.bottom >= box.top;
+#else
+        return query.left < box.right && query.top < box.bottom && query.right > box.left && query.bottom > box.top;
+#endif
+    }
+
+private:
+    void sort();
+
+    std::vector<Entry> entries;
+    std::vector<const Entry*> open;
+};
+
+#endif // TA_CONTACT_SWEEP_H
@@ -0,0 +1,28 @@
+#ifndef TA_CONTEXT_H
+#define TA_CONTEXT_H
+
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+
+using TA_SaveMap = std::map<std::string, long long, std::less<>>;
+
+// state that belongs to one running game rather than to the process: view size, frame time, current level, random
+// generator and save data; it is passed explicitly through TA_Links, screens and sprites
+// textures, sounds, parsed assets, settings and the renderer stay shared between contexts and are read-only to them
+struct TA_Context {
+    int screenWidth = 0, screenHeight = 0;
+    float elapsedTime = 0;
+    // advanced by elapsedTime once per update step, sprites animate by it whether they are drawn or not
+    double animationClock = 0;
+    // cleared for frames that are simulated but never shown
+    bool renderingEnabled = true;
+    std::string levelPath, previousLevelPath;
+    std::mt19937_64 random;
+    // the main game works on the config itself so its saves reach the disk, other games on a copy of it
+    TA_SaveMap* saveMap = nullptr;
+    std::string currentSave;
+};
+
+#endif // TA_CONTEXT_H
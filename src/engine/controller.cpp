@@ -4,9 +4,9 @@
 #include "tools.h"
 #include "touchscreen.h"
 
-void TA_Controller::load() {
+void TA_Controller::load(TA_Context* context) {
 #ifdef __ANDROID__
-    onscreen.load();
+    onscreen.load(context);
 #endif
 
     update();
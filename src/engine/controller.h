@@ -44,9 +44,10 @@ private:
     TA_Sprite stickSprite, pointerSprite;
     TA_OnscreenStick stick;
     TA_Point vector;
+    TA_Context* context = nullptr;
 
 public:
-    void load();
+    void load(TA_Context* newContext);
     void update();
     void draw();
     void setMode(TA_OnscreenControllerMode newMode) { mode = newMode; }
@@ -70,7 +71,7 @@ private:
     bool justChanged = false;
 
 public:
-    void load();
+    void load(TA_Context* context);
     void update();
     void draw();
     void setMode(TA_OnscreenControllerMode mode) { onscreen.setMode(mode); }
@@ -0,0 +1,519 @@
+#include "cpu_renderer.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "error.h"
+#include "thread_pool.h"
+#include "tools.h"
+
+// draw calls are recorded during the frame and replayed at present, each pool worker takes a band of rows and runs
+// every command clipped to it, so draw order is kept without locking
+
+namespace TA::cpuRenderer {
+    // how the pixels of a texture row look within one cell, OR-ed together over the cells a blit covers
+    enum PixelMask : Uint8 { MASK_TRANSPARENT = 1, MASK_OPAQUE = 2, MASK_PARTIAL = 4 };
+
+    using Palette = std::array<Uint32, 256>;
+
+    // either pixels or indices is filled, modPalettes holds the palette with a color mod applied, keyed by the mod
+    struct Image {
+        std::vector<Uint32> pixels;
+        std::vector<Uint8> indices, cellMasks;
+        Palette palette{};
+        std::vector<std::pair<Uint32, std::unique_ptr<Palette>>> modPalettes;
+        int width = 0, height = 0, cellsPerRow = 0;
+    };
+
+    struct Command {
+        const Image* image = nullptr;
+        const Uint32* palette = nullptr;
+        Uint32 color = 0, mod = 0xFFFFFFFF;
+        int srcX = 0, srcY = 0, x = 0, y = 0, w = 0, h = 0;
+        bool flip = false;
+    };
+
+    constexpr int cellSize = 16, bandHeight = 8, maxWorkers = 4, maxModPalettes = 64;
+    constexpr Uint32 alphaMask = 0xFF000000;
+
+    bool makeIndexed(Image& image);
+    const Uint32* getPalette(Image& image, Uint32 mod);
+    bool clip(Command& command);
+    void drawBand(int band);
+    void drawRow(const Command& command, int y, std::vector<Uint32>& buffer);
+    void upscaleBand(int band, Uint32* pixels, int pitch, int scale);
+
+    void parallelFor(int count, const std::function<void(int)>& function);
+
+    bool enabled = false, indexed = true;
+    std::unordered_map<SDL_Texture*, Image> images;
+    int modPaletteCount = 0;
+    std::vector<Command> commands;
+    size_t captureStart = 0;
+    std::vector<Uint32> frame;
+    int frameWidth = 0, frameHeight = 0;
+
+    SDL_Texture* output = nullptr;
+    int outputWidth = 0, outputHeight = 0;
+}
+
+namespace {
+    inline Uint32 div255(Uint32 value) {
+        value += 128;
+        return (value + (value >> 8)) >> 8;
+    }
+
+    void copyRow(Uint32* dst, const Uint32* src, int count) {
+        std::memcpy(dst, src, static_cast<size_t>(count) * sizeof(Uint32));
+    }
+
+    void fillRow(Uint32* dst, Uint32 color, int count) {
+        std::fill_n(dst, count, color);
+    }
+
+    void reverseRow(Uint32* dst, const Uint32* src, int count) {
+        int pos = 0;
+#ifdef SDL_SSE2_INTRINSICS
+        for(; pos + 4 <= count; pos += 4) {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count - pos - 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pos), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+#endif
+        for(; pos < count; pos++) {
+            dst[pos] = src[count - 1 - pos];
+        }
+    }
+
+    void lookupRow(Uint32* dst, const Uint8* src, const Uint32* palette, int count, bool flip) {
+        if(flip) {
+            for(int pos = 0; pos < count; pos++) {
+                dst[pos] = palette[src[count - 1 - pos]];
+            }
+        } else {
+            for(int pos = 0; pos < count; pos++) {
+                dst[pos] = palette[src[pos]];
+            }
+        }
+    }
+
+    void keyRow(Uint32* dst, const Uint32* src, int count) {
+        int pos = 0;
+#ifdef SDL_SSE2_INTRINSICS
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(TA::cpuRenderer::alphaMask));
+        for(; pos + 4 <= count; pos += 4) {
+            __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+            __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + pos));
+            __m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(source, alpha), _mm_setzero_si128());
+            target = _mm_or_si128(_mm_and_si128(transparent, target), _mm_andnot_si128(transparent, source));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pos), target);
+        }
+#endif
+        for(; pos < count; pos++) {
+            if((src[pos] & TA::cpuRenderer::alphaMask) != 0) {
+                dst[pos] = src[pos];
+            }
+        }
+    }
+
+    // same rounding as the SIMD path so both give identical frames
+    void blendRowScalar(Uint32* dst, const Uint32* src, int count, Uint32 mod) {
+        const Uint32 modA = mod >> 24, modR = (mod >> 16) & 0xFF, modG = (mod >> 8) & 0xFF, modB = mod & 0xFF;
+        for(int pos = 0; pos < count; pos++) {
+            Uint32 source = src[pos], target = dst[pos];
+            Uint32 alpha = div255((source >> 24) * modA);
+            if(alpha == 0) {
+                dst[pos] = target | TA::cpuRenderer::alphaMask;
+                continue;
+            }
+            Uint32 inverse = 255 - alpha;
+            Uint32 red = div255(div255(((source >> 16) & 0xFF) * modR) * alpha + ((target >> 16) & 0xFF) * inverse);
+            Uint32 green = div255(div255(((source >> 8) & 0xFF) * modG) * alpha + ((target >> 8) & 0xFF) * inverse);
+            Uint32 blue = div255(div255((source & 0xFF) * modB) * alpha + (target & 0xFF) * inverse);
+            dst[pos] = TA::cpuRenderer::alphaMask | (red << 16) | (green << 8) | blue;
+        }
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    inline __m128i div255(__m128i value) {
+        value = _mm_add_epi16(value, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+    }
+
+    inline __m128i blendHalf(__m128i source, __m128i target, __m128i mod) {
+        source = div255(_mm_mullo_epi16(source, mod));
+        __m128i alpha = _mm_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3));
+        alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+        return div255(_mm_add_epi16(_mm_mullo_epi16(source, alpha), _mm_mullo_epi16(target, inverse)));
+    }
+#endif
+
+    void blendRow(Uint32* dst, const Uint32* src, int count, Uint32 mod) {
+        int pos = 0;
+#ifdef SDL_SSE2_INTRINSICS
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(TA::cpuRenderer::alphaMask));
+        const auto modA = static_cast<short>(mod >> 24), modR = static_cast<short>((mod >> 16) & 0xFF);
+        const auto modG = static_cast<short>((mod >> 8) & 0xFF), modB = static_cast<short>(mod & 0xFF);
+        const __m128i modulation = _mm_setr_epi16(modB, modG, modR, modA, modB, modG, modR, modA);
+        for(; pos + 4 <= count; pos += 4) {
+            __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+            __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + pos));
+            __m128i low = blendHalf(_mm_unpacklo_epi8(source, zero), _mm_unpacklo_epi8(target, zero), modulation);
+            __m128i high = blendHalf(_mm_unpackhi_epi8(source, zero), _mm_unpackhi_epi8(target, zero), modulation);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pos), _mm_or_si128(_mm_packus_epi16(low, high), alpha));
+        }
+#endif
+        blendRowScalar(dst + pos, src + pos, count - pos, mod);
+    }
+}
+
+int TA::cpuRenderer::getThreadCount() {
+    if(!enabled) {
+        return 0;
+    }
+    return std::min(SDL_GetNumLogicalCPUCores(), maxWorkers + 1) - 1;
+}
+
+void TA::cpuRenderer::setEnabled(bool newEnabled) {
+    enabled = newEnabled;
+}
+
+bool TA::cpuRenderer::isEnabled() {
+    return enabled;
+}
+
+void TA::cpuRenderer::setIndexed(bool newIndexed) {
+    indexed = newIndexed;
+}
+
+void TA::cpuRenderer::registerTexture(SDL_Texture* texture, SDL_Surface* surface) {
+    if(!enabled) {
+        return;
+    }
+    SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+    if(converted == nullptr) {
+        TA::handleSDLError("%s", "failed to convert surface for the cpu renderer");
+    }
+
+    Image& image = images[texture];
+    image.width = converted->w;
+    image.height = converted->h;
+    image.cellsPerRow = (image.width + cellSize - 1) / cellSize;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+    image.cellMasks.assign(static_cast<size_t>(image.cellsPerRow) * image.height, 0);
+
+    for(int y = 0; y < image.height; y++) {
+        const auto* row = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(converted->pixels) +
+                                                          (static_cast<ptrdiff_t>(y) * converted->pitch));
+        for(int x = 0; x < image.width; x++) {
+            Uint32 pixel = row[x];
+            Uint32 alpha = pixel >> 24;
+            image.pixels[(y * image.width) + x] = (alpha == 0 ? 0 : pixel);
+            image.cellMasks[(y * image.cellsPerRow) + (x / cellSize)] |=
+                (alpha == 0 ? MASK_TRANSPARENT : (alpha == 255 ? MASK_OPAQUE : MASK_PARTIAL));
+        }
+    }
+    SDL_DestroySurface(converted);
+
+    if(indexed && makeIndexed(image)) {
+        image.pixels.clear();
+        image.pixels.shrink_to_fit();
+    }
+}
+
+void TA::cpuRenderer::unregisterTexture(SDL_Texture* texture) {
+    images.erase(texture);
+}
+
+bool TA::cpuRenderer::getTextureSize(SDL_Texture* texture, int& width, int& height) {
+    auto iterator = images.find(texture);
+    if(iterator == images.end()) {
+        return false;
+    }
+    width = iterator->second.width;
+    height = iterator->second.height;
+    return true;
+}
+
+bool TA::cpuRenderer::makeIndexed(Image& image) {
+    std::unordered_map<Uint32, Uint8> colors;
+    std::vector<Uint8> indices(image.pixels.size());
+    for(size_t pos = 0; pos < image.pixels.size(); pos++) {
+        auto iterator = colors.find(image.pixels[pos]);
+        if(iterator == colors.end()) {
+            if(colors.size() == image.palette.size()) {
+                return false;
+            }
+            iterator = colors.emplace(image.pixels[pos], static_cast<Uint8>(colors.size())).first;
+            image.palette[iterator->second] = image.pixels[pos];
+        }
+        indices[pos] = iterator->second;
+    }
+    image.indices = std::move(indices);
+    return true;
+}
+
+TA::cpuRenderer::MemoryStats TA::cpuRenderer::getMemoryStats() {
+    MemoryStats stats;
+    for(const auto& [texture, image] : images) {
+        stats.expanded += static_cast<size_t>(image.width) * image.height * sizeof(Uint32);
+        stats.stored += (image.pixels.size() * sizeof(Uint32)) + image.indices.size() + image.cellMasks.size();
+        if(!image.indices.empty()) {
+            stats.stored += sizeof(Palette);
+        }
+    }
+    return stats;
+}
+
+const Uint32* TA::cpuRenderer::getPalette(Image& image, Uint32 mod) {
+    if(mod == 0xFFFFFFFF) {
+        return image.palette.data();
+    }
+    for(const auto& [key, palette] : image.modPalettes) {
+        if(key == mod) {
+            return palette->data();
+        }
+    }
+
+    // same math as blendRow applies to the source, so the result doesn't depend on the storage
+    const Uint32 modA = mod >> 24, modR = (mod >> 16) & 0xFF, modG = (mod >> 8) & 0xFF, modB = mod & 0xFF;
+    auto palette = std::make_unique<Palette>();
+    for(size_t pos = 0; pos < palette->size(); pos++) {
+        Uint32 color = image.palette[pos];
+        (*palette)[pos] = (div255((color >> 24) * modA) << 24) | (div255(((color >> 16) & 0xFF) * modR) << 16) |
+                          (div255(((color >> 8) & 0xFF) * modG) << 8) | div255((color & 0xFF) * modB);
+    }
+    image.modPalettes.emplace_back(mod, std::move(palette));
+    modPaletteCount++;
+    return image.modPalettes.back().second->data();
+}
+
+void TA::cpuRenderer::beginFrame(int width, int height) {
+    frameWidth = width;
+    frameHeight = height;
+    frame.assign(static_cast<size_t>(width) * height, alphaMask);
+    commands.clear();
+
+    // nothing refers to the mod palettes between frames, drop them once effects leave too many behind
+    if(modPaletteCount > maxModPalettes) {
+        for(auto& [texture, image] : images) {
+            image.modPalettes.clear();
+        }
+        modPaletteCount = 0;
+    }
+}
+
+void TA::cpuRenderer::drawTexture(
+    SDL_Texture* texture, const SDL_Rect& srcRect, int x, int y, bool flip, SDL_Color mod) {
+    auto iterator = images.find(texture);
+    if(iterator == images.end() || mod.a == 0) {
+        return;
+    }
+
+    Command command;
+    command.image = &iterator->second;
+    command.mod = (static_cast<Uint32>(mod.a) << 24) | (mod.r << 16) | (mod.g << 8) | mod.b;
+    command.srcX = srcRect.x;
+    command.srcY = srcRect.y;
+    command.x = x;
+    command.y = y;
+    command.w = std::min(srcRect.w, command.image->width - srcRect.x);
+    command.h = std::min(srcRect.h, command.image->height - srcRect.y);
+    command.flip = flip;
+    if(!clip(command)) {
+        return;
+    }
+    if(!iterator->second.indices.empty()) {
+        command.palette = getPalette(iterator->second, command.mod);
+    }
+    commands.push_back(command);
+}
+
+void TA::cpuRenderer::fillRect(const SDL_FRect& rect, int r, int g, int b, int a) {
+    if(a <= 0) {
+        return;
+    }
+    Command command;
+    command.color = (static_cast<Uint32>(std::min(a, 255)) << 24) | (r << 16) | (g << 8) | b;
+    command.x = static_cast<int>(rect.x);
+    command.y = static_cast<int>(rect.y);
+    command.w = static_cast<int>(rect.w);
+    command.h = static_cast<int>(rect.h);
+    if(clip(command)) {
+        commands.push_back(command);
+    }
+}
+
+void TA::cpuRenderer::beginCapture() {
+    captureStart = commands.size();
+}
+
+void TA::cpuRenderer::endCapture(SDL_Texture* texture) {
+    // run only the captured commands over a blank frame, then put the real frame and its commands back
+    std::vector<Command> frameCommands(commands.begin(), commands.begin() + static_cast<ptrdiff_t>(captureStart));
+    commands.erase(commands.begin(), commands.begin() + static_cast<ptrdiff_t>(captureStart));
+    std::vector<Uint32> pixels(static_cast<size_t>(frameWidth) * frameHeight, alphaMask);
+    frame.swap(pixels);
+    parallelFor((frameHeight + bandHeight - 1) / bandHeight, drawBand);
+    frame.swap(pixels);
+    commands = std::move(frameCommands);
+
+    Image& image = images[texture];
+    image = Image();
+    image.width = frameWidth;
+    image.height = frameHeight;
+    image.cellsPerRow = (image.width + cellSize - 1) / cellSize;
+    image.pixels = std::move(pixels);
+    image.cellMasks.assign(static_cast<size_t>(image.cellsPerRow) * image.height, MASK_OPAQUE);
+}
+
+bool TA::cpuRenderer::clip(Command& command) {
+    int left = std::max(command.x, 0), right = std::min(command.x + command.w, frameWidth);
+    int top = std::max(command.y, 0), bottom = std::min(command.y + command.h, frameHeight);
+    if(left >= right || top >= bottom) {
+        return false;
+    }
+
+    command.srcX += (command.flip ? command.x + command.w - right : left - command.x);
+    command.srcY += top - command.y;
+    command.x = left;
+    command.y = top;
+    command.w = right - left;
+    command.h = bottom - top;
+    return true;
+}
+
+void TA::cpuRenderer::present(int scale, const SDL_FRect& dstRect, bool linear) {
+    int bands = (frameHeight + bandHeight - 1) / bandHeight;
+    parallelFor(bands, drawBand);
+    commands.clear();
+
+    if(output == nullptr || outputWidth != frameWidth * scale || outputHeight != frameHeight * scale) {
+        if(output != nullptr) {
+            SDL_DestroyTexture(output);
+        }
+        outputWidth = frameWidth * scale;
+        outputHeight = frameHeight * scale;
+        output = SDL_CreateTexture(
+            TA::renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, outputWidth, outputHeight);
+        if(output == nullptr) {
+            TA::handleSDLError("%s", "failed to create cpu renderer output texture");
+        }
+    }
+    SDL_SetTextureScaleMode(output, linear ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST);
+
+    void* pixels = nullptr;
+    int pitch = 0;
+    if(!SDL_LockTexture(output, nullptr, &pixels, &pitch)) {
+        TA::handleSDLError("%s", "failed to lock cpu renderer output texture");
+    }
+    parallelFor(bands, [&](int band) { upscaleBand(band, static_cast<Uint32*>(pixels), pitch, scale); });
+    SDL_UnlockTexture(output);
+    SDL_RenderTexture(TA::renderer, output, nullptr, &dstRect);
+}
+
+void TA::cpuRenderer::drawBand(int band) {
+    thread_local std::vector<Uint32> buffer;
+    int top = band * bandHeight, bottom = std::min(top + bandHeight, frameHeight);
+    for(const Command& command : commands) {
+        int first = std::max(top, command.y), last = std::min(bottom, command.y + command.h);
+        for(int y = first; y < last; y++) {
+            drawRow(command, y, buffer);
+        }
+    }
+}
+
+void TA::cpuRenderer::drawRow(const Command& command, int y, std::vector<Uint32>& buffer) {
+    Uint32* dst = frame.data() + (static_cast<ptrdiff_t>(y) * frameWidth) + command.x;
+    if(command.image == nullptr) {
+        if((command.color >> 24) == 255) {
+            fillRow(dst, command.color, command.w);
+        } else {
+            buffer.resize(command.w);
+            fillRow(buffer.data(), command.color, command.w);
+            blendRow(dst, buffer.data(), command.w, 0xFFFFFFFF);
+        }
+        return;
+    }
+
+    const Image& image = *command.image;
+    int srcY = command.srcY + (y - command.y);
+    Uint8 mask = 0;
+    for(int cell = command.srcX / cellSize; cell <= (command.srcX + command.w - 1) / cellSize; cell++) {
+        mask |= image.cellMasks[(srcY * image.cellsPerRow) + cell];
+    }
+    if(mask == MASK_TRANSPARENT) {
+        return;
+    }
+
+    if(command.palette != nullptr) {
+        // the mod is already in the palette, only translucency still needs the blend
+        buffer.resize(command.w);
+        const Uint8* src = image.indices.data() + (static_cast<ptrdiff_t>(srcY) * image.width) + command.srcX;
+        lookupRow(buffer.data(), src, command.palette, command.w, command.flip);
+        if((command.mod >> 24) != 255 || (mask & MASK_PARTIAL) != 0) {
+            blendRow(dst, buffer.data(), command.w, 0xFFFFFFFF);
+        } else if(mask == MASK_OPAQUE) {
+            copyRow(dst, buffer.data(), command.w);
+        } else {
+            keyRow(dst, buffer.data(), command.w);
+        }
+        return;
+    }
+
+    const Uint32* src = image.pixels.data() + (static_cast<ptrdiff_t>(srcY) * image.width) + command.srcX;
+    if(command.flip) {
+        buffer.resize(command.w);
+        reverseRow(buffer.data(), src, command.w);
+        src = buffer.data();
+    }
+
+    if(command.mod != 0xFFFFFFFF || (mask & MASK_PARTIAL) != 0) {
+        blendRow(dst, src, command.w, command.mod);
+    } else if(mask == MASK_OPAQUE) {
+        copyRow(dst, src, command.w);
+    } else {
+        keyRow(dst, src, command.w);
+    }
+}
+
+void TA::cpuRenderer::upscaleBand(int band, Uint32* pixels, int pitch, int scale) {
+    int top = band * bandHeight, bottom = std::min(top + bandHeight, frameHeight);
+    int rowPixels = pitch / static_cast<int>(sizeof(Uint32));
+    for(int y = top; y < bottom; y++) {
+        const Uint32* src = frame.data() + (static_cast<ptrdiff_t>(y) * frameWidth);
+        Uint32* dst = pixels + (static_cast<ptrdiff_t>(y) * scale * rowPixels);
+        if(scale == 1) {
+            copyRow(dst, src, frameWidth);
+            continue;
+        }
+        for(int x = 0; x < frameWidth; x++) {
+            fillRow(dst + (x * scale), src[x], scale);
+        }
+        for(int row = 1; row < scale; row++) {
+            copyRow(dst + (row * rowPixels), dst, frameWidth * scale);
+        }
+    }
+}
+
+void TA::cpuRenderer::parallelFor(int count, const std::function<void(int)>& function) {
+    TA::threadPool::parallelFor(count, 1, [&](int begin, int end) {
+        for(int index = begin; index < end; index++) {
+            function(index);
+        }
+    });
+}
+
+void TA::cpuRenderer::quit() {
+    if(output != nullptr) {
+        SDL_DestroyTexture(output);
+        output = nullptr;
+    }
+    images.clear();
+    commands.clear();
+    modPaletteCount = 0;
+}
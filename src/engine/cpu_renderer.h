@@ -0,0 +1,36 @@
+#ifndef TA_CPU_RENDERER_H
+#define TA_CPU_RENDERER_H
+
+#include "SDL3/SDL.h"
+
+// draws the frame at native resolution into a 32-bit buffer and upscales it once at present, for machines where SDL
+// falls back to its generic software renderer
+// textures with up to 256 colors are kept as 8-bit indices, color mod is applied to a copy of the palette per draw
+
+namespace TA::cpuRenderer {
+    struct MemoryStats {
+        size_t stored = 0, expanded = 0;
+    };
+
+    // how many TA::threadPool workers the renderer can use, 0 while it's disabled
+    int getThreadCount();
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    void setIndexed(bool indexed);
+    void registerTexture(SDL_Texture* texture, SDL_Surface* surface);
+    void unregisterTexture(SDL_Texture* texture);
+    // size of the registered image, the SDL texture behind it is only a placeholder
+    bool getTextureSize(SDL_Texture* texture, int& width, int& height);
+    MemoryStats getMemoryStats();
+
+    void beginFrame(int width, int height);
+    void drawTexture(SDL_Texture* texture, const SDL_Rect& srcRect, int x, int y, bool flip, SDL_Color mod);
+    void fillRect(const SDL_FRect& rect, int r, int g, int b, int a);
+    // draws between the two calls are rasterized into an opaque frame sized image for texture instead of the frame
+    void beginCapture();
+    void endCapture(SDL_Texture* texture);
+    void present(int scale, const SDL_FRect& dstRect, bool linear);
+    void quit();
+}
+
+#endif // TA_CPU_RENDERER_H
@@ -1,10 +1,14 @@
 #include "font.h"
+#include <functional>
 #include <utility>
+#include "cpu_renderer.h"
 #include "error.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "tools.h"
 
-void TA_Font::loadFont(const std::filesystem::path& path) {
+void TA_Font::loadFont(TA_Context* newContext, const std::filesystem::path& path) {
+    context = newContext;
     try {
         tryLoadFont(path);
     } catch(std::exception& e) {
@@ -17,28 +21,33 @@ void TA_Font::tryLoadFont(const std::filesystem::path& path) {
     std::filesystem::path image = path.parent_path() / table.at("font").at("image").as_string();
     int width = static_cast<int>(table.at("font").at("width").as_integer());
     int height = static_cast<int>(table.at("font").at("height").as_integer());
-    load(image.string(), width, height);
+    load(context, image.string(), width, height);
     setMapping(table.at("font").at("mapping").as_string());
 }
 
-std::string TA_Font::getUtf8Char(const std::string& text, int pos) {
+char32_t TA_Font::getUtf8Char(const std::string& text, int& pos) {
     if(pos >= text.size()) {
         TA::handleError("UTF8 symbol position out of range (text = %s, pos = %i)", text.c_str(), pos);
     }
 
     unsigned char firstByte = static_cast<unsigned char>(text[pos]);
     int charLength = 0;
+    char32_t symbol = 0;
     if(firstByte <= 0x7FU) {
         charLength = 1;
+        symbol = firstByte;
     } else if((firstByte & 0xE0U) == 0xC0U) {
         if(firstByte < 0xC2U) {
             TA::handleError("invalid UTF8 first byte (text = %s, pos = %i)", text.c_str(), pos);
         }
         charLength = 2;
+        symbol = firstByte & 0x1FU;
     } else if((firstByte & 0xF0U) == 0xE0U) {
         charLength = 3;
+        symbol = firstByte & 0x0FU;
     } else if((firstByte & 0xF8U) == 0xF0U) {
         charLength = 4;
+        symbol = firstByte & 0x07U;
     } else {
         TA::handleError("invalid UTF8 first byte (text = %s, pos = %i)", text.c_str(), pos);
     }
@@ -47,54 +56,150 @@ std::string TA_Font::getUtf8Char(const std::string& text, int pos) {
         TA::handleError(
             "UTF8 symbol length out of range (text = %s, pos = %i, length = %i", text.c_str(), pos, charLength);
     }
-    return text.substr(pos, charLength);
+    for(int byte = 1; byte < charLength; byte++) {
+        symbol = (symbol << 6) | (static_cast<unsigned char>(text[pos + byte]) & 0x3FU);
+    }
+    pos += charLength;
+    return symbol;
 }
 
 void TA_Font::setMapping(const std::string& mappingString) {
-    mapping.clear();
+    glyphFrames.clear();
+    runCache.clear();
     int frame = 0;
     for(int pos = 0; pos < static_cast<int>(mappingString.length());) {
-        std::string symbol = getUtf8Char(mappingString, pos);
-        mapping[symbol] = frame;
+        char32_t symbol = getUtf8Char(mappingString, pos);
+        if(symbol >= glyphFrames.size()) {
+            glyphFrames.resize(symbol + 1, -1);
+        }
+        glyphFrames[symbol] = frame;
         frame++;
-        pos += static_cast<int>(symbol.size());
     }
 }
 
-void TA_Font::drawText(TA_Point position, std::string text, TA_Point offset) {
-    TA_Point currentPosition = position;
-    for(int pos = 0; pos < static_cast<int>(text.length());) {
-        std::string symbol = getUtf8Char(text, pos);
-        if(mapping.count(symbol)) {
-            setPosition(currentPosition);
-            setFrame(mapping[symbol]);
-            draw();
-            currentPosition.x += getWidth() + offset.x;
-        } else if(symbol == "\n") {
-            currentPosition.x = position.x;
-            currentPosition.y += getHeight() + offset.y;
-        }
-        pos += static_cast<int>(symbol.size());
+int TA_Font::getGlyphFrame(char32_t symbol) {
+    if(symbol >= glyphFrames.size()) {
+        return -1;
     }
+    return glyphFrames[symbol];
 }
 
-void TA_Font::drawTextCentered(float y, std::string text, TA_Point offset) {
-    float width = getTextWidth(text, offset);
-    drawText(TA_Point(TA::screenWidth / 2 - width / 2, y), text, offset);
+const TA_Font::GlyphRun& TA_Font::getGlyphRun(const std::string& text, TA_Point offset) {
+    size_t hash = std::hash<std::string>{}(text);
+    hash ^= std::hash<float>{}(offset.x) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<float>{}(offset.y) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+
+    auto iterator = runCache.find(hash);
+    if(iterator != runCache.end() && iterator->second.text == text && TA::equal(iterator->second.offset.x, offset.x) &&
+        TA::equal(iterator->second.offset.y, offset.y)) {
+        return iterator->second;
+    }
+
+    if(iterator == runCache.end() && runCache.size() >= maxCachedRuns) {
+        runCache.clear();
+    }
+    GlyphRun& run = runCache[hash];
+    run.text = text;
+    run.offset = offset;
+    buildGlyphRun(run);
+    return run;
 }
 
-float TA_Font::getTextWidth(std::string text, TA_Point offset) {
+void TA_Font::buildGlyphRun(GlyphRun& run) {
+    run.glyphs.clear();
+    run.width = 0;
+
+    TA_Point currentPosition{0, 0};
     float currentWidth = 0;
-    float maxWidth = 0;
-    for(int pos = 0; pos < static_cast<int>(text.length());) {
-        std::string symbol = getUtf8Char(text, pos);
-        if(symbol != "\n") {
-            currentWidth += getWidth() + offset.x;
-            maxWidth = std::max(maxWidth, currentWidth);
+    for(int pos = 0; pos < static_cast<int>(run.text.length());) {
+        char32_t symbol = getUtf8Char(run.text, pos);
+        int frame = getGlyphFrame(symbol);
+        if(frame != -1) {
+            run.glyphs.push_back({currentPosition, frame});
+            currentPosition.x += getWidth() + run.offset.x;
+        } else if(symbol == '\n') {
+            currentPosition.x = 0;
+            currentPosition.y += getHeight() + run.offset.y;
+        }
+
+        if(symbol != '\n') {
+            currentWidth += getWidth() + run.offset.x;
+            run.width = std::max(run.width, currentWidth);
         } else {
             currentWidth = 0;
         }
-        pos += static_cast<int>(symbol.size());
     }
-    return maxWidth;
+}
+
+void TA_Font::drawGlyphRun(const GlyphRun& run, TA_Point position) {
+    const TA_Texture& texture = getTexture();
+    if(texture.SDLTexture == nullptr || !context->renderingEnabled || run.glyphs.empty() || getAlpha() == 0) {
+        return;
+    }
+
+    TA::profiler::addCounter(TA_COUNTER_DRAW_CALLS, static_cast<long long>(run.glyphs.size()));
+    if(TA::cpuRenderer::isEnabled()) {
+        for(const Glyph& glyph : run.glyphs) {
+            TA_Point glyphPosition = position + glyph.position;
+            SDL_FRect srcRect = getFrameRect(glyph.frame);
+            SDL_Rect rect{static_cast<int>(srcRect.x), static_cast<int>(srcRect.y), static_cast<int>(srcRect.w),
+                static_cast<int>(srcRect.h)};
+            TA::cpuRenderer::drawTexture(texture.SDLTexture, rect, static_cast<int>(glyphPosition.x + 0.5),
+                static_cast<int>(glyphPosition.y + 0.5), false, getColorMod());
+        }
+        return;
+    }
+
+    SDL_Color mod = getColorMod();
+    SDL_FColor color{static_cast<float>(mod.r) / 255, static_cast<float>(mod.g) / 255, static_cast<float>(mod.b) / 255,
+        static_cast<float>(mod.a) / 255};
+
+    vertices.resize(run.glyphs.size() * 4);
+    indices.resize(run.glyphs.size() * 6);
+    const float glyphWidth = static_cast<float>(getWidth() * TA::scaleFactor);
+    const float glyphHeight = static_cast<float>(getHeight() * TA::scaleFactor);
+
+    for(size_t pos = 0; pos < run.glyphs.size(); pos++) {
+        const Glyph& glyph = run.glyphs[pos];
+        TA_Point glyphPosition = position + glyph.position;
+        float left = static_cast<float>(static_cast<int>(glyphPosition.x * TA::scaleFactor + 0.5));
+        float top = static_cast<float>(static_cast<int>(glyphPosition.y * TA::scaleFactor + 0.5));
+
+        SDL_FRect srcRect = getFrameRect(glyph.frame);
+        float srcLeft = srcRect.x / static_cast<float>(texture.width);
+        float srcTop = srcRect.y / static_cast<float>(texture.height);
+        float srcRight = (srcRect.x + srcRect.w) / static_cast<float>(texture.width);
+        float srcBottom = (srcRect.y + srcRect.h) / static_cast<float>(texture.height);
+
+        SDL_Vertex* quad = &vertices[pos * 4];
+        quad[0] = {{left, top}, color, {srcLeft, srcTop}};
+        quad[1] = {{left + glyphWidth, top}, color, {srcRight, srcTop}};
+        quad[2] = {{left + glyphWidth, top + glyphHeight}, color, {srcRight, srcBottom}};
+        quad[3] = {{left, top + glyphHeight}, color, {srcLeft, srcBottom}};
+
+        int first = static_cast<int>(pos * 4);
+        int* quadIndices = &indices[pos * 6];
+        quadIndices[0] = first;
+        quadIndices[1] = first + 1;
+        quadIndices[2] = first + 2;
+        quadIndices[3] = first;
+        quadIndices[4] = first + 2;
+        quadIndices[5] = first + 3;
+    }
+
+    SDL_RenderGeometry(TA::renderer, texture.SDLTexture, vertices.data(), static_cast<int>(vertices.size()),
+        indices.data(), static_cast<int>(indices.size()));
+}
+
+void TA_Font::drawText(TA_Point position, const std::string& text, TA_Point offset) {
+    drawGlyphRun(getGlyphRun(text, offset), position);
+}
+
+void TA_Font::drawTextCentered(float y, const std::string& text, TA_Point offset) {
+    const GlyphRun& run = getGlyphRun(text, offset);
+    drawGlyphRun(run, TA_Point(context->screenWidth / 2 - run.width / 2, y));
+}
+
+float TA_Font::getTextWidth(const std::string& text, TA_Point offset) {
+    return getGlyphRun(text, offset).width;
 }
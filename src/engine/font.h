@@ -2,23 +2,46 @@
 #define TA_FONT_H
 
 #include <filesystem>
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "sprite.h"
 
 class TA_Font : public TA_Sprite {
 public:
-    void loadFont(const std::filesystem::path& path);
+    void loadFont(TA_Context* newContext, const std::filesystem::path& path);
     void setMapping(const std::string& mappingString);
-    void drawText(TA_Point position, std::string text, TA_Point offset = {0, 0});
-    void drawTextCentered(float y, std::string text, TA_Point offset = {0, 0});
-    float getTextWidth(std::string text, TA_Point offset = {0, 0});
+    void drawText(TA_Point position, const std::string& text, TA_Point offset = {0, 0});
+    void drawTextCentered(float y, const std::string& text, TA_Point offset = {0, 0});
+    float getTextWidth(const std::string& text, TA_Point offset = {0, 0});
 
 private:
+    struct Glyph {
+        TA_Point position;
+        int frame;
+    };
+
+    // text laid out relative to its origin, reused while the string stays the same
+    struct GlyphRun {
+        std::string text;
+        TA_Point offset;
+        std::vector<Glyph> glyphs;
+        float width = 0;
+    };
+
+    static constexpr size_t maxCachedRuns = 256;
+
     void tryLoadFont(const std::filesystem::path& path);
-    static std::string getUtf8Char(const std::string& text, int pos);
+    static char32_t getUtf8Char(const std::string& text, int& pos);
+    int getGlyphFrame(char32_t symbol);
+    const GlyphRun& getGlyphRun(const std::string& text, TA_Point offset);
+    void buildGlyphRun(GlyphRun& run);
+    void drawGlyphRun(const GlyphRun& run, TA_Point position);
 
-    std::map<std::string, int> mapping;
+    std::vector<int> glyphFrames;
+    std::unordered_map<size_t, GlyphRun> runCache;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
 };
 
 #endif // TA_FONT_H
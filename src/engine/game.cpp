@@ -1,47 +1,101 @@
 #include "game.h"
+#include <algorithm>
 #include <chrono>
+#include <vector>
 #include "SDL3/SDL_hints.h"
 #include "SDL3_mixer/SDL_mixer.h"
+#include "cpu_renderer.h"
 #include "error.h"
 #include "gamepad.h"
 #include "keyboard.h"
+#include "music_cache.h"
+#include "pacing.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "save.h"
 #include "sound.h"
+#include "thread_pool.h"
 #include "tools.h"
 #include "touchscreen.h"
 
 TA_Game::TA_Game() {
+    startupTime = startupPhaseTime = std::chrono::high_resolution_clock::now();
     TA::save::load();
+    context.saveMap = &TA::save::getConfig();
+    markStartupPhase("save");
     initSDL();
     createWindow();
-    TA::random::init(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    TA::gamepad::init();
+    markStartupPhase("window");
+    TA::random::init(&context, std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    TA::keyboard::init();
+    TA::cpuRenderer::setEnabled(TA::save::getParameter("cpu_renderer"));
+    TA::cpuRenderer::setIndexed(TA::save::getParameter("indexed_textures"));
+    // update_threads (0 by default) splits object updates across that many workers, only objects with a
+    // prepareUpdate (rings so far) benefit; the cpu renderer shares the same pool for its bands
+    int updateThreads = static_cast<int>(TA::save::getParameter("update_threads"));
+    TA::threadPool::init(std::max(updateThreads, TA::cpuRenderer::getThreadCount()));
+    markStartupPhase("renderer");
     TA::resmgr::load();
+    markStartupPhase("mods");
+    turboSteps = static_cast<int>(TA::save::getParameter("turbo_steps"));
+    turboReportTime = std::chrono::high_resolution_clock::now();
 
-    font.loadFont("fonts/pause_menu.toml");
+    font.loadFont(&context, "fonts/pause_menu.toml");
+    markStartupPhase("font");
 
-    startTime = std::chrono::high_resolution_clock::now();
-    screenStateMachine.init();
+    screenStateMachine.init(&context);
+    markStartupPhase("screen");
+    TA::printLog("startup:%s", startupTimeline.c_str());
+    TA::pacing::resetTimer();
+}
+
+void TA_Game::markStartupPhase(const char* phase) {
+    auto now = std::chrono::high_resolution_clock::now();
+    long long time = std::chrono::duration_cast<std::chrono::microseconds>(now - startupPhaseTime).count();
+    startupTimeline += " " + std::string(phase) + " " + std::to_string(time) + " us";
+    startupPhaseTime = now;
+}
+
+void TA_Game::updateStartup() {
+    auto getTime = [&]() {
+        auto now = std::chrono::high_resolution_clock::now();
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(now - startupTime).count());
+    };
+    if(!firstFrameDone) {
+        firstFrameDone = true;
+        TA::printLog("startup: first frame after %lld us", getTime());
+    }
+    if(!preloadDone && TA::resmgr::updatePreload(preloadBudgetNS)) {
+        preloadDone = true;
+        TA::printLog("startup: preloads done after %lld us", getTime());
+    }
 }
 
 void TA_Game::initSDL() {
     SDL_SetHint(SDL_HINT_CHECK_OBJECT_VALIDITY, "0");
-    if(!SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_JOYSTICK | SDL_INIT_HAPTIC | SDL_INIT_GAMEPAD |
-                 SDL_INIT_EVENTS | SDL_INIT_SENSOR)) {
+    // haptic and sensor are initialized by TA::gamepad::prepare once a device appears
+    if(!SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_JOYSTICK | SDL_INIT_GAMEPAD | SDL_INIT_EVENTS)) {
         TA::handleSDLError("%s", "SDL init failed");
     }
+    markStartupPhase("sdl");
     if(Mix_Init(MIX_INIT_OGG) != MIX_INIT_OGG) {
         TA::handleSDLError("%s", "SDL_mixer init failed");
     }
+    // sound_buffer is the requested device buffer in sample frames, smaller trades underruns for latency
+    // the latency shown by the profiler is estimated from the buffer sizes, not measured at the output
+    std::string bufferFrames = std::to_string(TA::save::getParameter("sound_buffer"));
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, bufferFrames.c_str());
     SDL_AudioSpec audioSpec;
-    audioSpec.channels = TA_SOUND_CHANNEL_MAX;
+    audioSpec.channels = 2;
     audioSpec.format = MIX_DEFAULT_FORMAT;
-    audioSpec.freq = 44100;
+    audioSpec.freq = soundFrequency;
     if(!Mix_OpenAudio(0, &audioSpec)) {
         TA::handleSDLError("%s", "Mix_OpenAudio failed");
     }
+    TA::sound::init();
+    TA::musicCache::init();
     SDL_HideCursor();
+    markStartupPhase("audio");
 }
 
 void TA_Game::createWindow() {
@@ -57,8 +111,7 @@ void TA_Game::createWindow() {
 
     updateWindowSize();
     SDL_SetRenderDrawBlendMode(TA::renderer, SDL_BLENDMODE_BLEND);
-    int vsync = TA::save::getParameter("vsync");
-    SDL_SetRenderVSync(TA::renderer, (vsync == 2 ? -1 : vsync));
+    TA::pacing::init();
 }
 
 void TA_Game::toggleFullscreen() {
@@ -79,13 +132,41 @@ void TA_Game::updateWindowSize() {
     }
 
     SDL_GetWindowSize(TA::window, &windowWidth, &windowHeight);
-    TA::screenWidth = baseHeight * windowWidth / windowHeight * pixelAR;
-    TA::screenHeight = baseHeight;
-    TA::scaleFactor = (windowWidth + TA::screenWidth - 1) / TA::screenWidth;
+    context.screenWidth = baseHeight * windowWidth / windowHeight * pixelAR;
+    context.screenHeight = baseHeight;
+
+    // with an integer scale and nearest filtering the copy from the target texture is 1:1, so draw to the window
+    directPresent = TA::save::getParameter("direct_present") && TA::save::getParameter("scale_mode") == 0 &&
+                    TA::save::getParameter("pixel_ar") == 0 && windowHeight >= baseHeight &&
+                    windowHeight % baseHeight == 0;
+    if(directPresent) {
+        TA::scaleFactor = windowHeight / baseHeight;
+        viewport.w = context.screenWidth * TA::scaleFactor;
+        viewport.h = windowHeight;
+        viewport.x = (windowWidth - viewport.w) / 2;
+        viewport.y = 0;
+    } else {
+        TA::scaleFactor = (windowWidth + context.screenWidth - 1) / context.screenWidth;
+    }
+
+    // the cpu renderer draws at native resolution and applies the scale itself at present
+    if(TA::cpuRenderer::isEnabled()) {
+        renderScale = TA::scaleFactor;
+        TA::scaleFactor = 1;
+    }
+
+    if(directPresent || TA::cpuRenderer::isEnabled()) {
+        if(targetTexture != nullptr) {
+            SDL_DestroyTexture(targetTexture);
+            targetTexture = nullptr;
+            targetWidth = targetHeight = 0;
+        }
+        return;
+    }
 
-    if(targetWidth < TA::screenWidth * TA::scaleFactor || targetHeight < TA::screenHeight * TA::scaleFactor) {
-        targetWidth = std::max(targetWidth, TA::screenWidth * TA::scaleFactor);
-        targetHeight = std::max(targetHeight, TA::screenHeight * TA::scaleFactor);
+    if(targetWidth != context.screenWidth * TA::scaleFactor || targetHeight != context.screenHeight * TA::scaleFactor) {
+        targetWidth = context.screenWidth * TA::scaleFactor;
+        targetHeight = context.screenHeight * TA::scaleFactor;
 
         if(targetTexture != nullptr) {
             SDL_DestroyTexture(targetTexture);
@@ -111,14 +192,36 @@ bool TA_Game::process() {
         if(event.type == SDL_EVENT_QUIT) {
             return false;
         }
-        if(event.type == SDL_EVENT_FINGER_DOWN || event.type == SDL_EVENT_FINGER_MOTION ||
+        if((event.type == SDL_EVENT_KEY_DOWN && !event.key.repeat) || event.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN ||
+            event.type == SDL_EVENT_FINGER_DOWN) {
+            if(inputEventTime == 0 || event.common.timestamp < inputEventTime) {
+                inputEventTime = event.common.timestamp;
+            }
+            inputEvents++;
+        }
+
+        if(event.type == SDL_EVENT_KEY_DOWN || event.type == SDL_EVENT_KEY_UP) {
+            TA::keyboard::handleEvent(event.key);
+        } else if(event.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN || event.type == SDL_EVENT_GAMEPAD_BUTTON_UP) {
+            TA::gamepad::handleButtonEvent(event.gbutton);
+        } else if(event.type == SDL_EVENT_GAMEPAD_AXIS_MOTION) {
+            TA::gamepad::handleAxisEvent(event.gaxis);
+        } else if(event.type == SDL_EVENT_FINGER_DOWN || event.type == SDL_EVENT_FINGER_MOTION ||
             event.type == SDL_EVENT_FINGER_UP) {
-            TA::touchscreen::handleEvent(event.tfinger);
+            TA::touchscreen::handleEvent(&context, event.tfinger);
+        } else if(event.type == SDL_EVENT_JOYSTICK_ADDED) {
+            TA::gamepad::prepare();
         } else if(event.type == SDL_EVENT_GAMEPAD_ADDED || event.type == SDL_EVENT_GAMEPAD_REMOVED) {
             TA::gamepad::handleEvent(event.gdevice);
+        } else if(event.type == SDL_EVENT_WINDOW_DISPLAY_CHANGED) {
+            TA::pacing::updatePeriod();
         }
     }
 
+    if(TA::save::getParameter("frame_time") && TA::keyboard::isScancodeJustPressed(SDL_SCANCODE_F9)) {
+        TA::pacing::dump(TA::save::getDataDirectory() / "frame_times.txt");
+    }
+
     if(TA::keyboard::isScancodePressed(SDL_SCANCODE_RALT) && TA::keyboard::isScancodePressed(SDL_SCANCODE_RETURN) &&
         (TA::keyboard::isScancodeJustPressed(SDL_SCANCODE_RALT) ||
             TA::keyboard::isScancodeJustPressed(SDL_SCANCODE_RETURN))) {
@@ -131,21 +234,20 @@ bool TA_Game::process() {
 }
 
 void TA_Game::update() {
-    currentTime = std::chrono::high_resolution_clock::now();
-    TA::elapsedTime =
-        static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - startTime).count()) /
-        1e9F * 60;
-
-    TA::elapsedTime = std::min(TA::elapsedTime, maxElapsedTime);
-    // TA::elapsedTime /= 10;
-    startTime = currentTime;
+    if(turboSteps != 0) {
+        updateTurbo();
+        return;
+    }
 
-    SDL_SetRenderTarget(TA::renderer, targetTexture);
-    SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
-    SDL_RenderClear(TA::renderer);
+    startTime = std::chrono::high_resolution_clock::now();
+    context.elapsedTime = std::min(TA::pacing::startFrame(), maxElapsedTime);
+    // context.elapsedTime /= 10;
+    context.animationClock += context.elapsedTime;
 
+    beginFrame();
     if(screenStateMachine.update()) {
         startTime = std::chrono::high_resolution_clock::now();
+        TA::pacing::resetTimer();
     }
 
     if(TA::save::getParameter("frame_time")) {
@@ -158,22 +260,146 @@ void TA_Game::update() {
             prevFrameTime = frameTimeSum / 60;
             frame = frameTimeSum = 0;
         }
-        font.drawText(TA_Point(TA::screenWidth - 36, 24), std::to_string(prevFrameTime));
+        font.drawText(TA_Point(context.screenWidth - 36, 24), std::to_string(prevFrameTime));
+        if(TA::save::getParameter("frame_time") == 2) {
+            drawCounters();
+        } else if(TA::save::getParameter("frame_time") == 3) {
+            drawFrameStats();
+        }
     }
 
-    SDL_SetRenderTarget(TA::renderer, nullptr);
-    SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
-    SDL_RenderClear(TA::renderer);
+    endFrame();
+    updateStartup();
+    updateInputLatency();
+    TA::pacing::waitForNextFrame();
+}
 
-    SDL_FRect srcRect{0, 0, (float)TA::screenWidth * TA::scaleFactor, (float)TA::screenHeight * TA::scaleFactor};
-    SDL_FRect dstRect{0, 0, (float)windowWidth, (float)windowHeight};
-    SDL_RenderTexture(TA::renderer, targetTexture, &srcRect, &dstRect);
+void TA_Game::updateTurbo() {
+    // fixed steps of one 60 Hz frame back to back, only the last step of a displayed frame is drawn
+    // the other steps only update, screens skip their draw passes while rendering is disabled
+    int steps = (turboSteps > 0 ? turboSteps : headlessTurboSteps);
+    for(int step = 0; step < steps && !screenStateMachine.isQuitNeeded(); step++) {
+        bool displayed = (turboSteps > 0 && step == steps - 1);
+        context.elapsedTime = 1;
+        context.animationClock += context.elapsedTime;
+        context.renderingEnabled = displayed;
+        if(displayed) {
+            beginFrame();
+        }
+        screenStateMachine.update();
+        if(displayed) {
+            endFrame();
+        }
+        turboFrames++;
+    }
+    context.renderingEnabled = true;
+    updateStartup();
+
+    auto now = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(now - turboReportTime).count();
+    if(seconds >= 1) {
+        TA::printLog("turbo: %.0f simulated frames per second", turboFrames / seconds);
+        turboReportTime = now;
+        turboFrames = 0;
+    }
+}
+
+void TA_Game::beginFrame() {
+    TA::profiler::setCounter(TA_COUNTER_DRAW_CALLS, 0);
+    if(TA::cpuRenderer::isEnabled()) {
+        TA::cpuRenderer::beginFrame(context.screenWidth, context.screenHeight);
+    } else {
+        if(directPresent) {
+            SDL_SetRenderTarget(TA::renderer, nullptr);
+            SDL_SetRenderViewport(TA::renderer, &viewport);
+        } else {
+            SDL_SetRenderTarget(TA::renderer, targetTexture);
+        }
+        SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
+        SDL_RenderClear(TA::renderer);
+    }
+}
+
+void TA_Game::endFrame() {
+    if(TA::cpuRenderer::isEnabled()) {
+        SDL_SetRenderTarget(TA::renderer, nullptr);
+        SDL_SetRenderViewport(TA::renderer, nullptr);
+        SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
+        SDL_RenderClear(TA::renderer);
+
+        SDL_FRect dstRect{0, 0, (float)windowWidth, (float)windowHeight};
+        if(directPresent) {
+            SDL_RectToFRect(&viewport, &dstRect);
+        }
+        TA::cpuRenderer::present(renderScale, dstRect, TA::save::getParameter("scale_mode"));
+    } else if(!directPresent) {
+        SDL_SetRenderTarget(TA::renderer, nullptr);
+        SDL_SetRenderViewport(TA::renderer, nullptr);
+        SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
+        SDL_RenderClear(TA::renderer);
+
+        SDL_FRect srcRect{
+            0, 0, (float)context.screenWidth * TA::scaleFactor, (float)context.screenHeight * TA::scaleFactor};
+        SDL_FRect dstRect{0, 0, (float)windowWidth, (float)windowHeight};
+        SDL_RenderTexture(TA::renderer, targetTexture, &srcRect, &dstRect);
+    }
     SDL_RenderPresent(TA::renderer);
 }
 
+void TA_Game::drawFrameStats() {
+    TA::pacing::Stats stats = TA::pacing::getStats();
+    std::vector<std::string> lines{"p50 " + std::to_string(stats.p50Us), "p95 " + std::to_string(stats.p95Us),
+        "p99 " + std::to_string(stats.p99Us), "max " + std::to_string(stats.maxUs),
+        "missed " + std::to_string(stats.missed)};
+    for(int bucket = 0; bucket < TA::pacing::histogramBuckets; bucket++) {
+        lines.push_back(std::string(TA::pacing::getHistogramLabel(bucket)) + " " +
+                        std::to_string(stats.histogram[bucket]));
+    }
+    for(int line = 0; line < static_cast<int>(lines.size()); line++) {
+        font.drawText(TA_Point(context.screenWidth - 4 - font.getTextWidth(lines[line]), 34 + 10 * line), lines[line]);
+    }
+}
+
+void TA_Game::updateInputLatency() {
+    if(inputEventTime == 0) {
+        return;
+    }
+
+    // time from the earliest press consumed this frame to the return of SDL_RenderPresent
+    long long latency = static_cast<long long>(SDL_GetTicksNS() - inputEventTime) / 1000;
+    TA::profiler::setCounter(TA_COUNTER_INPUT_LATENCY, latency);
+    inputLatencySum += latency;
+    inputLatencyMax = std::max(inputLatencyMax, latency);
+    inputLatencyFrames++;
+
+    if(TA::arguments.contains("--input-latency")) {
+        TA::printLog("input latency %lli us, %i events", latency, inputEvents);
+    }
+    inputEventTime = 0;
+    inputEvents = 0;
+}
+
+void TA_Game::drawCounters() {
+    for(int counter = 0; counter < TA_COUNTER_MAX; counter++) {
+        std::string text = TA::profiler::getCounterName(TA_ProfilerCounter(counter));
+        text += " " + std::to_string(TA::profiler::getCounter(TA_ProfilerCounter(counter)));
+        font.drawText(TA_Point(context.screenWidth - 4 - font.getTextWidth(text), 34 + 10 * counter), text);
+    }
+}
+
 TA_Game::~TA_Game() {
+    if(TA::arguments.contains("--input-latency") && inputLatencyFrames != 0) {
+        TA::printLog("input latency: %i frames, average %lli us, max %lli us", inputLatencyFrames,
+            inputLatencySum / inputLatencyFrames, inputLatencyMax);
+    }
+    if(TA::arguments.contains("--frame-stats")) {
+        TA::pacing::dump(TA::save::getDataDirectory() / "frame_times.txt");
+    }
     TA::save::writeToFile();
     TA::gamepad::quit();
+    TA::musicCache::quit();
+    TA::cpuRenderer::quit();
+    TA::threadPool::quit();
     TA::resmgr::quit();
 
     SDL_DestroyTexture(targetTexture);
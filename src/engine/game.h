@@ -2,7 +2,9 @@
 #define TA_GAME_H
 
 #include <chrono>
+#include <string>
 #include "SDL3/SDL.h"
+#include "context.h"
 #include "font.h"
 #include "screen_state_machine.h"
 
@@ -10,25 +12,50 @@ class TA_Game {
 private:
     const int defaultWindowWidth = 1024, defaultWindowHeight = 576;
     const float minWindowAspectRatio = 1.2, maxWindowAspectRatio = 2.4;
-    const int soundFrequency = 44100, soundChunkSize = 256;
+    const int soundFrequency = 44100;
     const float maxElapsedTime = 4;
+    const int headlessTurboSteps = 60;
+    const Uint64 preloadBudgetNS = 2000000;
 
     void initSDL();
     void createWindow();
     void toggleFullscreen();
     void updateWindowSize();
+    void drawCounters();
+    void drawFrameStats();
+    void updateInputLatency();
+    void updateTurbo();
+    void beginFrame();
+    void endFrame();
+    void markStartupPhase(const char* phase);
+    void updateStartup();
 
-    std::chrono::time_point<std::chrono::high_resolution_clock> startTime, currentTime;
+    std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
+    TA_Context context;
     TA_ScreenStateMachine screenStateMachine;
 
     SDL_Texture* targetTexture = nullptr;
+    SDL_Rect viewport{0, 0, 0, 0};
 
-    int windowWidth, windowHeight, targetWidth = 0, targetHeight = 0;
-    bool vsync = false, fullscreen = true;
+    int windowWidth, windowHeight, targetWidth = 0, targetHeight = 0, renderScale = 1;
+    bool vsync = false, fullscreen = true, directPresent = false;
 
     TA_Font font;
     int frame = 0, frameTimeSum = 0, prevFrameTime = 0;
 
+    Uint64 inputEventTime = 0;
+    long long inputLatencySum = 0, inputLatencyMax = 0;
+    int inputEvents = 0, inputLatencyFrames = 0;
+
+    // startup is logged as one line of per-phase microseconds, then the first frame and the end of preloads
+    std::chrono::time_point<std::chrono::high_resolution_clock> startupTime, startupPhaseTime;
+    std::string startupTimeline;
+    bool firstFrameDone = false, preloadDone = false;
+
+    // turbo_steps simulates that many frames per displayed one, a negative value never displays
+    std::chrono::time_point<std::chrono::high_resolution_clock> turboReportTime;
+    int turboSteps = 0, turboFrames = 0;
+
 public:
     TA_Game();
     ~TA_Game();
@@ -3,7 +3,7 @@
 #include "save.h"
 
 void TA_GameScreen::init() {
-    const toml::value& table = TA::resmgr::loadToml(TA::levelPath + ".toml");
+    const toml::value& table = TA::resmgr::loadToml(context->levelPath + ".toml");
     if(table.contains("level") && table.at("level").contains("mode") && table.at("level").at("mode").is_string()) {
         mode = table.at("level").at("mode").as_string();
     } else {
@@ -20,13 +20,19 @@ void TA_GameScreen::init() {
         links.character = &character;
     }
 
+    levelContext.load(context, context->levelPath, isSeaFox);
+    camera.setContext(context);
+    camera.setFlightLevel(levelContext.flightLevel);
+
+    links.context = context;
+    links.level = &levelContext;
     links.tilemap = &tilemap;
     links.camera = &camera;
     links.objectSet = &objectSet;
     links.hud = &hud;
     links.controller = &controller;
 
-    controller.load();
+    controller.load(context);
     controller.setMode(TA_ONSCREEN_CONTROLLER_GAME);
 
     if(isSeaFox) {
@@ -41,10 +47,10 @@ void TA_GameScreen::init() {
     }
 
     objectSet.setLinks(links);
-    tilemap.load(TA::levelPath + ".tmx");
+    tilemap.load(context, context->levelPath + ".tmx");
     tilemap.setCamera(&camera);
     hud.load(links);
-    objectSet.load(TA::levelPath + ".toml");
+    objectSet.load(context->levelPath + ".toml");
 
     if(isSeaFox) {
         seaFox.setSpawnPoint(objectSet.getCharacterSpawnPoint(), objectSet.getCharacterSpawnFlip());
@@ -52,13 +58,13 @@ void TA_GameScreen::init() {
         character.setSpawnPoint(objectSet.getCharacterSpawnPoint(), objectSet.getCharacterSpawnFlip());
     }
 
-    TA::previousLevelPath = TA::levelPath;
-    timer = TA::save::getSaveParameter("time");
+    context->previousLevelPath = context->levelPath;
+    timer = TA::save::getSaveParameter(context, "time");
 }
 
 TA_ScreenState TA_GameScreen::update() {
-    timer += TA::elapsedTime;
-    TA::save::setSaveParameter("time", timer);
+    timer += context->elapsedTime;
+    TA::save::setSaveParameter(context, "time", timer);
 
     controller.update();
     hud.update();
@@ -87,6 +93,22 @@ TA_ScreenState TA_GameScreen::update() {
     tilemap.setUpdateAnimation(!hud.isPaused());
     objectSet.setPaused(hud.isPaused());
 
+    if(hud.getTransition() != TA_SCREENSTATE_CURRENT) {
+        return hud.getTransition();
+    }
+    if((!isSeaFox && character.gameOver()) || (isSeaFox && seaFox.gameOver())) {
+        return TA_SCREENSTATE_GAMEOVER;
+    }
+    if(!isSeaFox && character.isTeleported()) {
+        return TA_SCREENSTATE_HOUSE;
+    }
+    if(objectSet.getTransition() != TA_SCREENSTATE_CURRENT) {
+        return objectSet.getTransition();
+    }
+    return TA_SCREENSTATE_CURRENT;
+}
+
+void TA_GameScreen::draw() {
     tilemap.draw(0);
     objectSet.draw(0);
 
@@ -106,20 +128,6 @@ TA_ScreenState TA_GameScreen::update() {
     objectSet.draw(2);
     hud.draw();
     controller.draw();
-
-    if(hud.getTransition() != TA_SCREENSTATE_CURRENT) {
-        return hud.getTransition();
-    }
-    if((!isSeaFox && character.gameOver()) || (isSeaFox && seaFox.gameOver())) {
-        return TA_SCREENSTATE_GAMEOVER;
-    }
-    if(!isSeaFox && character.isTeleported()) {
-        return TA_SCREENSTATE_HOUSE;
-    }
-    if(objectSet.getTransition() != TA_SCREENSTATE_CURRENT) {
-        return objectSet.getTransition();
-    }
-    return TA_SCREENSTATE_CURRENT;
 }
 
 void TA_GameScreen::quit() {}
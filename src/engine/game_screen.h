@@ -6,6 +6,7 @@
 #include "controller.h"
 #include "geometry.h"
 #include "hud.h"
+#include "level_context.h"
 #include "links.h"
 #include "object_set.h"
 #include "screen.h"
@@ -22,6 +23,7 @@ private:
     TA_ObjectSet objectSet;
     TA_Links links;
     TA_Hud hud;
+    TA_LevelContext levelContext;
 
     std::string mode;
     bool isSeaFox = false;
@@ -32,6 +34,7 @@ private:
 public:
     void init() override;
     TA_ScreenState update() override;
+    void draw() override;
     void quit() override;
 };
 
@@ -1,10 +1,11 @@
 #include "gamepad.h"
 #include <array>
+#include <vector>
 #include "save.h"
 #include "tools.h"
 
 namespace TA::gamepad {
-    void updateMapping();
+    void reset();
     bool isDpadPressed();
     TA_Point getDpadDirectionVector();
     TA_Point getStickDirectionVector();
@@ -13,9 +14,12 @@ namespace TA::gamepad {
     std::array<SDL_GamepadButton, TA_DIRECTION_MAX> directionMapping;
 
     SDL_Gamepad* controller = nullptr;
-    std::array<bool, SDL_GAMEPAD_BUTTON_COUNT> pressed, justPressed;
+    std::array<bool, SDL_GAMEPAD_BUTTON_COUNT> pressed{}, justPressed{};
+    std::vector<int> justPressedButtons;
+    TA_Point stick;
     bool isConnected = false;
     bool isOncePressed = false;
+    bool prepared = false;
 }
 
 bool TA::gamepad::connected() {
@@ -36,7 +40,22 @@ void TA::gamepad::handleEvent(SDL_GamepadDeviceEvent event) {
     }
 }
 
+void TA::gamepad::prepare() {
+    if(prepared) {
+        return;
+    }
+    prepared = true;
+    if(!SDL_InitSubSystem(SDL_INIT_HAPTIC | SDL_INIT_SENSOR)) {
+        TA::printWarning("failed to init haptic and sensor subsystems: %s", SDL_GetError());
+    }
+    // joysticks this maps become gamepads and are announced with SDL_EVENT_GAMEPAD_ADDED
+    if(SDL_AddGamepadMappingsFromFile("gamecontrollerdb.txt") == -1) {
+        TA::printWarning("failed to load gamecontrollerdb.txt: %s", SDL_GetError());
+    }
+}
+
 void TA::gamepad::init(int index) {
+    prepare();
     controller = SDL_OpenGamepad(index);
     if(controller == nullptr) {
         isConnected = false;
@@ -45,8 +64,10 @@ void TA::gamepad::init(int index) {
         isConnected = true;
     }
 
-    SDL_AddGamepadMappingsFromFile("gamecontrollerdb.txt");
     updateMapping();
+    reset();
+    stick.x = static_cast<float>(SDL_GetGamepadAxis(controller, SDL_GAMEPAD_AXIS_LEFTX)) / 32768;
+    stick.y = static_cast<float>(SDL_GetGamepadAxis(controller, SDL_GAMEPAD_AXIS_LEFTY)) / 32768;
 }
 
 void TA::gamepad::updateMapping() {
@@ -65,25 +86,46 @@ void TA::gamepad::updateMapping() {
 }
 
 void TA::gamepad::update() {
-    if(!connected()) {
-        return;
+    for(int button : justPressedButtons) {
+        justPressed[button] = false;
     }
-    updateMapping();
+    justPressedButtons.clear();
+}
 
-    for(int button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; button++) {
-        if(SDL_GetGamepadButton(controller, (SDL_GamepadButton)button)) {
-            if(!pressed[(int)button]) {
-                pressed[(int)button] = justPressed[(int)button] = true;
-                isOncePressed = true;
-            } else {
-                justPressed[(int)button] = false;
-            }
-        } else {
-            pressed[(int)button] = justPressed[(int)button] = false;
+void TA::gamepad::handleButtonEvent(SDL_GamepadButtonEvent event) {
+    if(!connected() || event.which != SDL_GetGamepadID(controller) || event.button >= SDL_GAMEPAD_BUTTON_COUNT) {
+        return;
+    }
+    if(event.down) {
+        if(!pressed[event.button]) {
+            justPressed[event.button] = true;
+            justPressedButtons.push_back(event.button);
+            isOncePressed = true;
         }
+        pressed[event.button] = true;
+    } else {
+        pressed[event.button] = false;
+    }
+}
+
+void TA::gamepad::handleAxisEvent(SDL_GamepadAxisEvent event) {
+    if(!connected() || event.which != SDL_GetGamepadID(controller)) {
+        return;
+    }
+    if(event.axis == SDL_GAMEPAD_AXIS_LEFTX) {
+        stick.x = static_cast<float>(event.value) / 32768;
+    } else if(event.axis == SDL_GAMEPAD_AXIS_LEFTY) {
+        stick.y = static_cast<float>(event.value) / 32768;
     }
 }
 
+void TA::gamepad::reset() {
+    pressed.fill(false);
+    justPressed.fill(false);
+    justPressedButtons.clear();
+    stick = {0, 0};
+}
+
 TA_Point TA::gamepad::getDirectionVector() {
     if(!connected()) {
         return {0, 0};
@@ -97,7 +139,7 @@ TA_Point TA::gamepad::getDirectionVector() {
 
 bool TA::gamepad::isDpadPressed() {
     for(int direction = 0; direction < TA_DIRECTION_MAX; direction++) {
-        if(SDL_GetGamepadButton(controller, directionMapping[direction])) {
+        if(pressed[directionMapping[direction]]) {
             return true;
         }
     }
@@ -137,14 +179,7 @@ TA_Point TA::gamepad::getDpadDirectionVector() {
 }
 
 TA_Point TA::gamepad::getStickDirectionVector() {
-    auto getAxis = [&](float& x, SDL_GamepadAxis index) {
-        x = SDL_GetGamepadAxis(controller, index);
-        x /= 32768;
-    };
-    TA_Point vector;
-    getAxis(vector.x, SDL_GAMEPAD_AXIS_LEFTX);
-    getAxis(vector.y, SDL_GAMEPAD_AXIS_LEFTY);
-    return vector;
+    return stick;
 }
 
 bool TA::gamepad::isPressed(TA_FunctionButton button) {
@@ -172,4 +207,6 @@ void TA::gamepad::rumble(float lowFreqStrength, float highFreqStrength, int time
 
 void TA::gamepad::quit() {
     SDL_CloseGamepad(controller);
+    controller = nullptr;
+    reset();
 }
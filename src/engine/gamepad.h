@@ -8,8 +8,13 @@
 namespace TA {
     namespace gamepad {
         void handleEvent(SDL_GamepadDeviceEvent event);
+        // haptic, sensor and the mapping database are only set up once the first device appears
+        void prepare();
+        void handleButtonEvent(SDL_GamepadButtonEvent event);
+        void handleAxisEvent(SDL_GamepadAxisEvent event);
         void init(int index = 0);
         void update();
+        void updateMapping();
         bool connected();
         bool oncePressed();
         void quit();
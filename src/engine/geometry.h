@@ -3,6 +3,7 @@
 
 #include <SDL3/SDL_intrin.h>
 #include <algorithm>
+#include <array>
 #include <error.h>
 #include <cmath>
 #include <cstddef>
@@ -122,135 +123,196 @@ private:
     alignas(16) float data[4];
 };
 
-class TA_Line {
+// convex polygon with inline storage, edge normals and bounds are computed once so collision checks only take an offset
+class TA_ConvexPolygon {
 public:
-    TA_Line(const TA_Point& p1, const TA_Point& p2)
-        : p1(p1), p2(p2), a(p2.y - p1.y), b(p1.x - p2.x), c((p2.x * p1.y) - (p1.x * p2.y)) {
-        const float k = (c > 0 ? -1.0 : 1.0) / std::sqrt((a * a) + (b * b));
-        a *= k;
-        b *= k;
-        c *= k;
-    }
-
-    [[nodiscard]] const TA_Point& getFirst() const { return p1; }
-    [[nodiscard]] const TA_Point& getSecond() const { return p2; }
-
-    [[nodiscard]] float getDeviation(const TA_Point& point) const { return (a * point.x) + (b * point.y) + c; }
-
-    [[nodiscard]] float getDistance(const TA_Point& point) const { return std::abs(getDeviation(point)); }
+    static constexpr int maxVertices = 8;
 
-    [[nodiscard]] bool intersects(const TA_Line& rv) const {
-        const float s1 = getDeviation(rv.getFirst());
-        const float s2 = getDeviation(rv.getSecond());
-        const float s3 = rv.getDeviation(getFirst());
-        const float s4 = rv.getDeviation(getSecond());
-        return s1 * s2 <= 0 && s3 * s4 <= 0;
-    }
+    TA_ConvexPolygon() = default;
 
-private:
-    TA_Point p1, p2;
-    float a = 0, b = 0, c = 0;
-};
-
-class TA_Polygon {
-public:
-    TA_Polygon() = default;
-
-    TA_Polygon(const TA_Point& topLeft, const TA_Point& bottomRight) { setRectangle(topLeft, bottomRight); }
+    TA_ConvexPolygon(const TA_Point& topLeft, const TA_Point& bottomRight) { setRectangle(topLeft, bottomRight); }
 
     void setRectangle(const TA_Point& topLeft, const TA_Point& bottomRight) {
-        sourceVertexList.clear();
-        sourceVertexList.emplace_back(topLeft);
-        sourceVertexList.emplace_back(bottomRight.x, topLeft.y);
-        sourceVertexList.emplace_back(bottomRight);
-        sourceVertexList.emplace_back(topLeft.x, bottomRight.y);
-        rect = true;
-        updateVertexList();
-    }
-
-    void setPosition(const TA_Point& newPosition) {
-        position = newPosition;
-        updateVertexList();
+        clear();
+        addVertex(topLeft);
+        addVertex({bottomRight.x, topLeft.y});
+        addVertex(bottomRight);
+        addVertex({topLeft.x, bottomRight.y});
     }
 
-    [[nodiscard]] const TA_Point& getPosition() const { return position; }
-
     void addVertex(const TA_Point& vertex) {
-        sourceVertexList.push_back(vertex);
-        updateVertexList();
+        if(count == maxVertices) {
+            TA::handleError("convex polygon has more than %i vertices", maxVertices);
+        }
+        vertices[count] = vertex;
+        count++;
+        update();
+    }
 
-        rect = (vertexList.size() == 4 && TA::equal(getVertex(1).x, getVertex(2).x) &&
-                TA::equal(getVertex(1).y, getVertex(0).y) && TA::equal(getVertex(3).x, getVertex(0).x) &&
-                TA::equal(getVertex(3).y, getVertex(2).y));
+    void clear() {
+        count = 0;
+        rect = false;
     }
 
-    [[nodiscard]] bool inside(const TA_Point& point) const {
+    [[nodiscard]] bool inside(const TA_Point& point, const TA_Point& offset = {0, 0}) const {
+        const TA_Point local = point - offset;
+        if(local.x < topLeft.x || local.x > bottomRight.x || local.y < topLeft.y || local.y > bottomRight.y) {
+            return false;
+        }
         if(isRectangle()) [[likely]] {
-            return getTopLeft().x <= point.x && point.x <= getBottomRight().x && getTopLeft().y <= point.y &&
-                   point.y <= getBottomRight().y;
+            return true;
         }
-
-        const TA_Line ray{point, {1e5, point.y}};
-        int count = 0;
-
-        for(size_t pos = 0; pos < vertexList.size(); pos += 1) {
-            const TA_Line currentLine{vertexList[pos], vertexList[(pos + 1) % vertexList.size()]};
-            if(ray.intersects(currentLine)) {
-                count += 1;
+        for(int pos = 0; pos < count; pos++) {
+            if(normals[pos].x * local.x + normals[pos].y * local.y > maxProjections[pos]) {
+                return false;
             }
         }
-
-        return count % 2 == 1;
+        return true;
     }
 
-    [[nodiscard]] bool intersects(const TA_Rect& rv) const {
-        if(isRectangle()) [[likely]] {
-            return getTopLeft().x < rv.getBottomRight().x && getBottomRight().x > rv.getTopLeft().x &&
-                   getTopLeft().y < rv.getBottomRight().y && getBottomRight().y > rv.getTopLeft().y;
+    // separating axis test, touching counts as intersecting for everything except axis-aligned rectangles
+    [[nodiscard]] bool intersects(const TA_Rect& rv, const TA_Point& offset = {0, 0}) const {
+        if(empty()) [[unlikely]] {
+            return false;
         }
 
-        if(empty()) [[unlikely]] {
+        const TA_Point rvTopLeft = rv.getTopLeft() - offset;
+        const TA_Point rvBottomRight = rv.getBottomRight() - offset;
+        if(isRectangle()) [[likely]] {
+            return topLeft.x < rvBottomRight.x && bottomRight.x > rvTopLeft.x && topLeft.y < rvBottomRight.y &&
+                   bottomRight.y > rvTopLeft.y;
+        }
+        if(topLeft.x > rvBottomRight.x || bottomRight.x < rvTopLeft.x || topLeft.y > rvBottomRight.y ||
+            bottomRight.y < rvTopLeft.y) {
             return false;
         }
 
-        for(int pos1 = 0; pos1 < size(); pos1++) {
-            const TA_Line line1 = {getVertex(pos1), getVertex((pos1 + 1) % size())};
-            for(int pos2 = 0; pos2 < 4; pos2++) {
-                const TA_Line line2 = {rv.getVertex(pos2), rv.getVertex((pos2 + 1) % 4)};
-                if(line1.intersects(line2)) {
-                    return true;
-                }
+        const TA_Point center = (rvTopLeft + rvBottomRight) * 0.5;
+        const TA_Point extent = (rvBottomRight - rvTopLeft) * 0.5;
+        for(int pos = 0; pos < count; pos++) {
+            const float projection = normals[pos].x * center.x + normals[pos].y * center.y;
+            const float radius = std::abs(normals[pos].x) * extent.x + std::abs(normals[pos].y) * extent.y;
+            if(projection - radius > maxProjections[pos] || projection + radius < minProjections[pos]) {
+                return false;
             }
         }
+        return true;
+    }
 
-        if(rv.inside(getVertex(0))) {
-            return true;
-        }
-        if(inside(rv.getVertex(0))) {
-            return true;
+    [[nodiscard]] int size() const { return count; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+    [[nodiscard]] bool isRectangle() const { return rect; }
+
+    [[nodiscard]] const TA_Point& getVertex(int pos) const { return vertices[pos]; }
+    [[nodiscard]] const TA_Point& getTopLeft() const { return topLeft; }
+    [[nodiscard]] const TA_Point& getBottomRight() const { return bottomRight; }
+
+    [[nodiscard]] static bool isConvex(const std::vector<TA_Point>& vertices) {
+        const size_t size = vertices.size();
+        bool positive = false, negative = false;
+        for(size_t pos = 0; pos < size; pos++) {
+            const float cross = getCross(vertices[pos], vertices[(pos + 1) % size], vertices[(pos + 2) % size]);
+            positive |= cross > TA::epsilon;
+            negative |= cross < -TA::epsilon;
         }
-        return false;
+        return !(positive && negative);
     }
 
-    [[nodiscard]] size_t size() const { return vertexList.size(); }
-    [[nodiscard]] bool empty() const { return size() == 0; }
-    [[nodiscard]] bool isRectangle() const { return rect; }
+    // splits a simple polygon into convex parts, convex polygons are kept as is and concave ones are ear clipped
+    [[nodiscard]] static std::vector<TA_ConvexPolygon> split(std::vector<TA_Point> vertices) {
+        std::vector<TA_ConvexPolygon> parts;
+        auto addPart = [&](const std::vector<TA_Point>& partVertices) {
+            TA_ConvexPolygon& part = parts.emplace_back();
+            for(const TA_Point& vertex : partVertices) {
+                part.addVertex(vertex);
+            }
+        };
+
+        if(vertices.size() <= maxVertices && isConvex(vertices)) {
+            addPart(vertices);
+            return parts;
+        }
 
-    [[nodiscard]] const TA_Point& getVertex(const size_t& pos) const { return vertexList[pos]; }
-    [[nodiscard]] const TA_Point& getTopLeft() const { return getVertex(0); }
-    [[nodiscard]] const TA_Point& getBottomRight() const { return getVertex(2); }
+        float area = 0;
+        for(size_t pos = 0; pos < vertices.size(); pos++) {
+            const TA_Point& current = vertices[pos];
+            const TA_Point& next = vertices[(pos + 1) % vertices.size()];
+            area += current.x * next.y - next.x * current.y;
+        }
+
+        while(vertices.size() > 3) {
+            const size_t size = vertices.size();
+            size_t ear = size;
+            for(size_t pos = 0; pos < size && ear == size; pos++) {
+                const TA_Point& prev = vertices[(pos + size - 1) % size];
+                const TA_Point& next = vertices[(pos + 1) % size];
+                if(getCross(prev, vertices[pos], next) * area <= 0) {
+                    continue;
+                }
+                TA_ConvexPolygon triangle;
+                triangle.addVertex(prev);
+                triangle.addVertex(vertices[pos]);
+                triangle.addVertex(next);
+                bool empty = true;
+                for(size_t other = 0; other < size && empty; other++) {
+                    if(other != pos && other != (pos + 1) % size && other != (pos + size - 1) % size) {
+                        empty = !triangle.inside(vertices[other]);
+                    }
+                }
+                if(empty) {
+                    ear = pos;
+                }
+            }
+            if(ear == size) {
+                TA::handleError("failed to split polygon into convex parts");
+            }
+            addPart({vertices[(ear + size - 1) % size], vertices[ear], vertices[(ear + 1) % size]});
+            vertices.erase(vertices.begin() + static_cast<std::ptrdiff_t>(ear));
+        }
+        addPart(vertices);
+        return parts;
+    }
 
 private:
-    std::vector<TA_Point> vertexList;
-    std::vector<TA_Point> sourceVertexList;
-    TA_Point position;
+    std::array<TA_Point, maxVertices> vertices;
+    std::array<TA_Point, maxVertices> normals;
+    std::array<float, maxVertices> minProjections{}, maxProjections{};
+    TA_Point topLeft, bottomRight;
+    int count = 0;
     bool rect = false;
 
-    void updateVertexList() {
-        vertexList = sourceVertexList;
-        for(TA_Point& vertex : vertexList) {
-            vertex = vertex + position;
+    static float getCross(const TA_Point& first, const TA_Point& second, const TA_Point& third) {
+        return (second.x - first.x) * (third.y - second.y) - (second.y - first.y) * (third.x - second.x);
+    }
+
+    void update() {
+        topLeft = bottomRight = vertices[0];
+        TA_Point center{0, 0};
+        for(int pos = 0; pos < count; pos++) {
+            topLeft = {std::min(topLeft.x, vertices[pos].x), std::min(topLeft.y, vertices[pos].y)};
+            bottomRight = {std::max(bottomRight.x, vertices[pos].x), std::max(bottomRight.y, vertices[pos].y)};
+            center += vertices[pos];
         }
+        center = center * (1.0F / static_cast<float>(count));
+
+        for(int pos = 0; pos < count; pos++) {
+            const TA_Point& first = vertices[pos];
+            const TA_Point& second = vertices[(pos + 1) % count];
+            TA_Point normal{second.y - first.y, first.x - second.x};
+            if(normal.x * (center.x - first.x) + normal.y * (center.y - first.y) > 0) {
+                normal = normal * -1;
+            }
+            normals[pos] = normal;
+            minProjections[pos] = maxProjections[pos] = normal.x * first.x + normal.y * first.y;
+            for(int other = 0; other < count; other++) {
+                const float projection = normal.x * vertices[other].x + normal.y * vertices[other].y;
+                minProjections[pos] = std::min(minProjections[pos], projection);
+                maxProjections[pos] = std::max(maxProjections[pos], projection);
+            }
+        }
+
+        rect = (count == 4 && TA::equal(vertices[1].x, vertices[2].x) && TA::equal(vertices[1].y, vertices[0].y) &&
+                TA::equal(vertices[3].x, vertices[0].x) && TA::equal(vertices[3].y, vertices[2].y));
     }
 };
 
@@ -271,7 +333,7 @@ private:
 
 class TA_Shape {
 public:
-    void setPolygon(const TA_Polygon& polygon) {
+    void setPolygon(const TA_ConvexPolygon& polygon) {
         this->polygon = polygon;
         isCircle = false;
     }
@@ -285,7 +347,7 @@ public:
         if(isCircle) {
             circle.setCenter(point);
         } else {
-            polygon.setPosition(point);
+            position = point;
         }
     }
 
@@ -298,12 +360,13 @@ public:
         if(isCircle) {
             return circle.inside(point);
         }
-        return polygon.inside(point);
+        return polygon.inside(point, position);
     }
 
 private:
-    TA_Polygon polygon;
+    TA_ConvexPolygon polygon;
     TA_Circle circle;
+    TA_Point position;
     bool isCircle = false;
 };
 
@@ -1,18 +1,126 @@
 #include "hitbox_container.h"
 
+#ifdef SDL_NEON_INTRINSICS
+#include <arm_neon.h>
+#endif
+
+// kernels match TA_Rect::intersects on the same platform: with SSE a query whose right or bottom edge touches a box
+// still counts as intersecting
+
+namespace {
+    constexpr int blockSize = TA_HitboxContainer::blockSize;
+
+    int queryScalar(const float* bounds, const int* types, int blocks, TA_Point topLeft, TA_Point bottomRight) {
+        int flags = 0;
+        for(int block = 0; block < blocks; block++) {
+            const float* current = bounds + (block * 4 * blockSize);
+            for(int lane = 0; lane < blockSize; lane++) {
+#ifdef SDL_SSE_INTRINSICS
+                bool touches = bottomRight.x >= current[lane] && bottomRight.y >= current[blockSize + lane];
+#else
+                bool touches = bottomRight.x > current[lane] && bottomRight.y > current[blockSize + lane];
+#endif
+                if(touches && topLeft.x < current[(2 * blockSize) + lane] &&
+                    topLeft.y < current[(3 * blockSize) + lane]) {
+                    flags |= types[(block * blockSize) + lane];
+                }
+            }
+        }
+        return flags;
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    int querySSE2(const float* bounds, const int* types, int blocks, TA_Point topLeft, TA_Point bottomRight) {
+        const __m128 left = _mm_set1_ps(topLeft.x);
+        const __m128 top = _mm_set1_ps(topLeft.y);
+        const __m128 right = _mm_set1_ps(bottomRight.x);
+        const __m128 bottom = _mm_set1_ps(bottomRight.y);
+        __m128i flags = _mm_setzero_si128();
+
+        for(int block = 0; block < blocks; block++) {
+            const float* current = bounds + (block * 4 * blockSize);
+            for(int lane = 0; lane < blockSize; lane += 4) {
+                __m128 mask = _mm_and_ps(_mm_cmplt_ps(left, _mm_loadu_ps(current + (2 * blockSize) + lane)),
+                    _mm_cmplt_ps(top, _mm_loadu_ps(current + (3 * blockSize) + lane)));
+                mask = _mm_and_ps(mask, _mm_cmpge_ps(right, _mm_loadu_ps(current + lane)));
+                mask = _mm_and_ps(mask, _mm_cmpge_ps(bottom, _mm_loadu_ps(current + blockSize + lane)));
+                __m128i blockTypes =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(types + (block * blockSize) + lane));
+                flags = _mm_or_si128(flags, _mm_and_si128(_mm_castps_si128(mask), blockTypes));
+            }
+        }
+
+        flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, _MM_SHUFFLE(1, 0, 3, 2)));
+        flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(flags);
+    }
+#endif
+
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    SDL_TARGETING("avx2") int queryAVX2(
+        const float* bounds, const int* types, int blocks, TA_Point topLeft, TA_Point bottomRight) {
+        const __m256 left = _mm256_set1_ps(topLeft.x);
+        const __m256 top = _mm256_set1_ps(topLeft.y);
+        const __m256 right = _mm256_set1_ps(bottomRight.x);
+        const __m256 bottom = _mm256_set1_ps(bottomRight.y);
+        __m256i flags = _mm256_setzero_si256();
+
+        for(int block = 0; block < blocks; block++) {
+            const float* current = bounds + (block * 4 * blockSize);
+            __m256 mask = _mm256_and_ps(_mm256_cmp_ps(left, _mm256_loadu_ps(current + (2 * blockSize)), _CMP_LT_OQ),
+                _mm256_cmp_ps(top, _mm256_loadu_ps(current + (3 * blockSize)), _CMP_LT_OQ));
+            mask = _mm256_and_ps(mask, _mm256_cmp_ps(right, _mm256_loadu_ps(current), _CMP_GE_OQ));
+            mask = _mm256_and_ps(mask, _mm256_cmp_ps(bottom, _mm256_loadu_ps(current + blockSize), _CMP_GE_OQ));
+            __m256i blockTypes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(types + (block * blockSize)));
+            flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_castps_si256(mask), blockTypes));
+        }
+
+        __m128i half = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+        half = _mm_or_si128(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_or_si128(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(half);
+    }
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+    int queryNEON(const float* bounds, const int* types, int blocks, TA_Point topLeft, TA_Point bottomRight) {
+        const float32x4_t left = vdupq_n_f32(topLeft.x);
+        const float32x4_t top = vdupq_n_f32(topLeft.y);
+        const float32x4_t right = vdupq_n_f32(bottomRight.x);
+        const float32x4_t bottom = vdupq_n_f32(bottomRight.y);
+        uint32x4_t flags = vdupq_n_u32(0);
+
+        for(int block = 0; block < blocks; block++) {
+            const float* current = bounds + (block * 4 * blockSize);
+            for(int lane = 0; lane < blockSize; lane += 4) {
+                uint32x4_t mask = vandq_u32(vcltq_f32(left, vld1q_f32(current + (2 * blockSize) + lane)),
+                    vcltq_f32(top, vld1q_f32(current + (3 * blockSize) + lane)));
+                mask = vandq_u32(mask, vcgtq_f32(right, vld1q_f32(current + lane)));
+                mask = vandq_u32(mask, vcgtq_f32(bottom, vld1q_f32(current + blockSize + lane)));
+                uint32x4_t blockTypes = vreinterpretq_u32_s32(vld1q_s32(types + (block * blockSize) + lane));
+                flags = vorrq_u32(flags, vandq_u32(mask, blockTypes));
+            }
+        }
+
+        uint32x2_t half = vorr_u32(vget_low_u32(flags), vget_high_u32(flags));
+        return static_cast<int>(vget_lane_u32(half, 0) | vget_lane_u32(half, 1));
+    }
+#endif
+}
+
+TA_HitboxContainer::TA_HitboxContainer() {
+    queryKernel = getQueryKernel(true);
+}
+
 void TA_HitboxContainer::add(const TA_Rect& hitbox, int type) {
     if(type == TA_COLLISION_TRANSPARENT) {
         return;
     }
     collisionTypeMask |= type;
 
-    Element element = {.hitbox = hitbox, .type = type};
-    hitboxes.push_back(element);
-    int id = static_cast<int>(hitboxes.size()) - 1;
-
-    auto addToChunk = [&](Chunk& chunk) {
+    auto addToChunkLazy = [&](Chunk& chunk) {
         lazyClear(chunk);
-        chunk.elements.push_back(id);
+        addToChunk(chunk, hitbox, type);
     };
 
     TA_Point topLeft = hitbox.getTopLeft();
@@ -23,30 +131,48 @@ void TA_HitboxContainer::add(const TA_Rect& hitbox, int type) {
     int bottom = static_cast<int>(bottomRight.y / chunkSize);
 
     if(0 <= top && bottom < sizeChunks && 0 <= left && right < sizeChunks && right - left <= 1 && bottom - top <= 1) {
-        addToChunk(chunks[top][left]);
+        addToChunkLazy(chunks[top][left]);
         if(right != left) {
-            addToChunk(chunks[top][right]);
+            addToChunkLazy(chunks[top][right]);
         }
         if(bottom != top) {
-            addToChunk(chunks[bottom][left]);
+            addToChunkLazy(chunks[bottom][left]);
         }
         if(right != left && bottom != top) {
-            addToChunk(chunks[bottom][right]);
+            addToChunkLazy(chunks[bottom][right]);
         }
     } else {
-        addToChunk(commonChunk);
+        addToChunkLazy(commonChunk);
     }
 }
 
+void TA_HitboxContainer::addToChunk(Chunk& chunk, const TA_Rect& hitbox, int type) {
+    int block = chunk.count / blockSize;
+    int lane = chunk.count % blockSize;
+    if(lane == 0) {
+        chunk.bounds.resize(chunk.bounds.size() + (4 * blockSize), 0);
+        chunk.types.resize(chunk.types.size() + blockSize, 0);
+    }
+
+    float* bounds = &chunk.bounds[block * 4 * blockSize];
+    bounds[lane] = hitbox.getTopLeft().x;
+    bounds[blockSize + lane] = hitbox.getTopLeft().y;
+    bounds[(2 * blockSize) + lane] = hitbox.getBottomRight().x;
+    bounds[(3 * blockSize) + lane] = hitbox.getBottomRight().y;
+    chunk.types[chunk.count] = type;
+    chunk.count++;
+}
+
 int TA_HitboxContainer::getCollisionFlags(const TA_Rect& hitbox) {
     int flags = 0;
+    TA_Point topLeft = hitbox.getTopLeft();
+    TA_Point bottomRight = hitbox.getBottomRight();
 
     auto processChunk = [&](Chunk& chunk) {
         lazyClear(chunk);
-        for(int id : chunk.elements) {
-            if(hitbox.intersects(hitboxes[id].hitbox)) {
-                flags |= hitboxes[id].type;
-            }
+        if(chunk.count != 0) {
+            int blocks = (chunk.count + blockSize - 1) / blockSize;
+            flags |= queryKernel(chunk.bounds.data(), chunk.types.data(), blocks, topLeft, bottomRight);
         }
     };
 
@@ -56,8 +182,6 @@ int TA_HitboxContainer::getCollisionFlags(const TA_Rect& hitbox) {
         }
     };
 
-    TA_Point topLeft = hitbox.getTopLeft();
-    TA_Point bottomRight = hitbox.getBottomRight();
     int left = topLeft.x / chunkSize;
     int top = topLeft.y / chunkSize;
     int right = bottomRight.x / chunkSize;
@@ -82,12 +206,64 @@ void TA_HitboxContainer::lazyClear(Chunk& chunk) {
     if(chunk.updateTime == currentTime) {
         return;
     }
-    chunk.elements.clear();
+    chunk.bounds.clear();
+    chunk.types.clear();
+    chunk.count = 0;
     chunk.updateTime = currentTime;
 }
 
 void TA_HitboxContainer::clear() {
-    hitboxes.clear();
     currentTime++;
     collisionTypeMask = 0;
 }
+
+void TA_HitboxContainer::freeze() {
+    lazyClear(commonChunk);
+    for(auto& row : chunks) {
+        for(Chunk& chunk : row) {
+            lazyClear(chunk);
+        }
+    }
+}
+
+void TA_HitboxContainer::setSimdEnabled(bool enabled) {
+    queryKernel = getQueryKernel(enabled);
+}
+
+TA_HitboxContainer::QueryKernel TA_HitboxContainer::getQueryKernel(bool simd) {
+    if(!simd) {
+        return queryScalar;
+    }
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if(SDL_HasAVX2()) {
+        return queryAVX2;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    return querySSE2;
+#elif defined(SDL_NEON_INTRINSICS)
+    return queryNEON;
+#else
+    return queryScalar;
+#endif
+}
+
+const char* TA_HitboxContainer::getQueryKernelName(bool simd) {
+    QueryKernel kernel = getQueryKernel(simd);
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if(kernel == queryAVX2) {
+        return "avx2";
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if(kernel == querySSE2) {
+        return "sse2";
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if(kernel == queryNEON) {
+        return "neon";
+    }
+#endif
+    return "scalar";
+}
@@ -1,37 +1,50 @@
 #ifndef TA_HITBOX_CONTAINER_H
 #define TA_HITBOX_CONTAINER_H
 
+#include <array>
 #include <vector>
 #include "geometry.h"
 #include "tilemap.h"
 
 class TA_HitboxContainer {
+public:
+    static const int blockSize = 8;
+
+    // bounds hold blockSize lefts, then tops, rights and bottoms for each block; unused slots have type 0
+    using QueryKernel = int (*)(const float* bounds, const int* types, int blocks, TA_Point topLeft,
+        TA_Point bottomRight);
+
 private:
     static const int size = 1e4, chunkSize = 128;
     static const int sizeChunks = (size + chunkSize - 1) / chunkSize;
 
-    struct Element {
-        TA_Rect hitbox;
-        int type;
-    };
-
     struct Chunk {
-        std::vector<int> elements;
+        std::vector<float> bounds;
+        std::vector<int> types;
+        int count = 0;
         int updateTime = 0;
     };
 
     std::array<std::array<Chunk, sizeChunks>, sizeChunks> chunks;
-    std::vector<Element> hitboxes;
     Chunk commonChunk;
+    QueryKernel queryKernel;
     int currentTime = 0, collisionTypeMask = 0;
 
     void lazyClear(Chunk& chunk);
+    static void addToChunk(Chunk& chunk, const TA_Rect& hitbox, int type);
 
 public:
+    TA_HitboxContainer();
     void add(const TA_Rect& hitbox, int type);
     int getCollisionFlags(const TA_Rect& hitbox);
     bool hasCollisionType(TA_CollisionType type) { return collisionTypeMask & type; }
     void clear();
+    // clears stale chunks up front, after this queries don't write and can run from several threads
+    void freeze();
+
+    void setSimdEnabled(bool enabled);
+    static QueryKernel getQueryKernel(bool simd);
+    static const char* getQueryKernelName(bool simd);
 };
 
 #endif // TA_HITBOX_CONTAINER_H
@@ -1,4 +1,5 @@
 #include "keyboard.h"
+#include <vector>
 #include "SDL3/SDL.h"
 #include "save.h"
 
@@ -6,24 +7,34 @@ namespace TA {
     namespace keyboard {
         std::array<SDL_Scancode, TA_BUTTON_MAX> mapping;
         std::array<SDL_Scancode, TA_DIRECTION_MAX> directionMapping;
-        std::array<bool, SDL_SCANCODE_COUNT> pressed, justPressed;
-
-        std::array<bool, SDL_SCANCODE_COUNT> getKeyboardState();
-        void updateMapping();
+        std::array<bool, SDL_SCANCODE_COUNT> pressed{}, justPressed{};
+        std::vector<SDL_Scancode> justPressedKeys;
     }
 }
 
-void TA::keyboard::update() {
+void TA::keyboard::init() {
     updateMapping();
-    std::array<bool, SDL_SCANCODE_COUNT> keyboardState = getKeyboardState();
+}
 
-    for(int button = 0; button < SDL_SCANCODE_COUNT; button++) {
-        if(keyboardState[button]) {
-            justPressed[button] = !pressed[button];
-            pressed[button] = true;
-        } else {
-            pressed[button] = justPressed[button] = false;
+void TA::keyboard::update() {
+    for(SDL_Scancode scancode : justPressedKeys) {
+        justPressed[scancode] = false;
+    }
+    justPressedKeys.clear();
+}
+
+void TA::keyboard::handleEvent(SDL_KeyboardEvent event) {
+    if(event.repeat || event.scancode >= SDL_SCANCODE_COUNT) {
+        return;
+    }
+    if(event.down) {
+        if(!pressed[event.scancode]) {
+            justPressed[event.scancode] = true;
+            justPressedKeys.push_back(event.scancode);
         }
+        pressed[event.scancode] = true;
+    } else {
+        pressed[event.scancode] = false;
     }
 }
 
@@ -42,15 +53,6 @@ void TA::keyboard::updateMapping() {
     directionMapping[TA_DIRECTION_RIGHT] = getMap("right");
 }
 
-std::array<bool, SDL_SCANCODE_COUNT> TA::keyboard::getKeyboardState() {
-    std::array<bool, SDL_SCANCODE_COUNT> state;
-    const bool* keyState = SDL_GetKeyboardState(NULL);
-    for(int button = 0; button < SDL_SCANCODE_COUNT; button++) {
-        state[button] = keyState[button];
-    }
-    return state;
-}
-
 bool TA::keyboard::isPressed(TA_FunctionButton button) {
     return pressed[mapping[button]];
 }
@@ -10,7 +10,9 @@
 namespace TA {
     namespace keyboard {
         void init();
+        void handleEvent(SDL_KeyboardEvent event);
         void update();
+        void updateMapping();
         bool isPressed(TA_FunctionButton button);
         bool isJustPressed(TA_FunctionButton button);
         bool isScancodePressed(SDL_Scancode scancode);
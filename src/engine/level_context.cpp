@@ -0,0 +1,47 @@
+#include "level_context.h"
+#include "resource_manager.h"
+#include "save.h"
+
+void TA_LevelContext::load(TA_Context* context, const std::string& levelPath, bool newSeaFox) {
+    windAsFlow = levelPath.starts_with("maps/ci");
+    flightLevel = (levelPath == "maps/pm/pm4");
+    groundPushables = (levelPath == "maps/pf/pf1");
+    seaFox = newSeaFox;
+
+    const toml::value& table = TA::resmgr::loadToml(levelPath + ".toml");
+    night = false;
+    waterLevel = -64;
+    if(table.contains("level")) {
+        const toml::value& level = table.at("level");
+        if(level.contains("night")) {
+            night = level.at("night").as_boolean();
+        }
+        if(level.contains("water_level") && seaFox) {
+            waterLevel = static_cast<float>(level.at("water_level").as_integer());
+        }
+    }
+
+    updateItems(context);
+}
+
+void TA_LevelContext::updateItems(TA_Context* context) {
+    const int fang = 9;
+    itemMask = TA::save::getSaveParameter(context, "item_mask");
+    for(int slot = 0; slot < itemSlots; slot++) {
+        std::string name = (seaFox ? "seafox_item_slot" : "item_slot") + std::to_string(slot);
+        items[slot] = static_cast<int>(TA::save::getSaveParameter(context, name));
+    }
+
+    emeraldsCount = 0;
+    for(int item = 29; item <= 34; item++) {
+        if(hasItem(item)) {
+            emeraldsCount++;
+        }
+    }
+    fangEquipped = false;
+    if(!seaFox) {
+        for(int item : items) {
+            fangEquipped |= (item == fang);
+        }
+    }
+}
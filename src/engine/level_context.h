@@ -0,0 +1,31 @@
+#ifndef TA_LEVEL_CONTEXT_H
+#define TA_LEVEL_CONTEXT_H
+
+#include <array>
+#include <string>
+#include "context.h"
+
+// facts about the level being played that the simulation checks every frame, resolved once when the level loads
+// instead of comparing level paths and looking up save parameters in hot paths
+struct TA_LevelContext {
+    static constexpr int itemSlots = 4;
+
+    bool windAsFlow = false; // wind areas are water currents that push tails while swimming
+    bool flightLevel = false; // unlimited helitail, no flight bar and a lower camera
+    bool groundPushables = false; // pushable objects collide as if standing on the ground
+    bool seaFox = false;
+    bool night = false;
+    float waterLevel = -64;
+
+    long long itemMask = 0;
+    std::array<int, itemSlots> items{};
+    int emeraldsCount = 0;
+    bool fangEquipped = false;
+
+    void load(TA_Context* context, const std::string& levelPath, bool newSeaFox);
+    // has to be called whenever the item mask or the equipped items change
+    void updateItems(TA_Context* context);
+    bool hasItem(int item) const { return (itemMask & (1ll << item)) != 0; }
+};
+
+#endif // TA_LEVEL_CONTEXT_H
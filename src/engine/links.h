@@ -8,8 +8,11 @@ class TA_Camera;
 class TA_ObjectSet;
 class TA_Controller;
 class TA_Hud;
+struct TA_LevelContext;
+struct TA_Context;
 
 struct TA_Links {
+    TA_Context* context = nullptr;
     TA_Character* character = nullptr;
     TA_SeaFox* seaFox = nullptr;
     TA_Tilemap* tilemap = nullptr;
@@ -17,6 +20,8 @@ struct TA_Links {
     TA_ObjectSet* objectSet = nullptr;
     TA_Controller* controller = nullptr;
     TA_Hud* hud = nullptr;
+    // never null once the links are handed to the object set, the character or the hud, they check it on load
+    TA_LevelContext* level = nullptr;
 };
 
 #endif // TA_LINKS_H
@@ -4,30 +4,25 @@
 
 std::pair<TA_Point, int> TA_ObjectSet::moveAndCollide(
     TA_Point position, TA_Point topLeft, TA_Point bottomRight, TA_Point velocity, int solidFlags, bool ground) {
-    this->position = position;
-    this->topLeft = topLeft;
-    this->bottomRight = bottomRight;
-    this->velocity = velocity;
-    this->solidFlags = solidFlags;
-    this->ground = ground;
-    delta = {0, 0};
-
-    if(!isGoodPosition(position + delta)) [[unlikely]] {
-        popOut(4);
-        if(!isGoodPosition(position + delta)) [[unlikely]] {
-            popOut(32);
-            if(!isGoodPosition(position + delta)) [[unlikely]] {
+    MoveState state{position, topLeft, bottomRight, velocity, {0, 0}, solidFlags, ground};
+
+    if(!isGoodPosition(state, position + state.delta)) [[unlikely]] {
+        popOut(state, 4);
+        if(!isGoodPosition(state, position + state.delta)) [[unlikely]] {
+            popOut(state, 32);
+            if(!isGoodPosition(state, position + state.delta)) [[unlikely]] {
                 return {{0, 0}, TA_COLLISION_ERROR};
             }
         }
     }
 
-    moveByX();
-    moveByY();
-    return {delta, getCollisionFlags(position + delta, topLeft, bottomRight, solidFlags)};
+    moveByX(state);
+    moveByY(state);
+    return {state.delta, getCollisionFlags(position + state.delta, topLeft, bottomRight, solidFlags)};
 }
 
-void TA_ObjectSet::moveByX() {
+void TA_ObjectSet::moveByX(MoveState& state) {
+    auto& [position, topLeft, bottomRight, velocity, delta, solidFlags, ground] = state;
     TA_Rect hitbox;
     if(ground) {
         hitbox.setRectangle(topLeft + TA_Point(0, 1), bottomRight - TA_Point(0, 1));
@@ -59,8 +54,9 @@ void TA_ObjectSet::moveByX() {
     delta.x += velocity.x * left;
 }
 
-void TA_ObjectSet::moveByY() {
-    if(ground && isGoodPosition(position + delta + TA_Point(0, 2))) {
+void TA_ObjectSet::moveByY(MoveState& state) {
+    auto& [position, topLeft, bottomRight, velocity, delta, solidFlags, ground] = state;
+    if(ground && isGoodPosition(state, position + delta + TA_Point(0, 2))) {
         ground = false;
     }
     if(ground) {
@@ -94,10 +90,10 @@ void TA_ObjectSet::moveByY() {
     delta.y += velocity.y * left;
 }
 
-void TA_ObjectSet::popOut(float area) {
+void TA_ObjectSet::popOut(MoveState& state, float area) {
     std::vector<std::pair<float, TA_Point>> directions;
     for(TA_Point add : {TA_Point(-area, 0), TA_Point(area, 0), TA_Point(0, -area), TA_Point(0, area)}) {
-        directions.emplace_back(getFirstGood(add), add);
+        directions.emplace_back(getFirstGood(state, add), add);
     }
 
     int min = 0;
@@ -108,16 +104,16 @@ void TA_ObjectSet::popOut(float area) {
     }
 
     TA_Point add = directions[min].second * directions[min].first;
-    if(isGoodPosition(position + (delta + add))) {
-        delta += add;
+    if(isGoodPosition(state, state.position + (state.delta + add))) {
+        state.delta += add;
     }
 }
 
-float TA_ObjectSet::getFirstGood(TA_Point add) {
+float TA_ObjectSet::getFirstGood(MoveState& state, TA_Point add) {
     float left = 0, right = 1, eps = 0.001;
     while((right - left) * add.length() > eps) {
         float mid = (left + right) / 2;
-        if(isGoodPosition(position + (delta + add * mid))) {
+        if(isGoodPosition(state, state.position + (state.delta + add * mid))) {
             right = mid;
         } else {
             left = mid;
@@ -126,11 +122,11 @@ float TA_ObjectSet::getFirstGood(TA_Point add) {
     return right;
 }
 
-bool TA_ObjectSet::isGoodPosition(TA_Point position) {
+bool TA_ObjectSet::isGoodPosition(MoveState& state, TA_Point position) {
     TA_Rect hitbox;
-    hitbox.setRectangle(topLeft, bottomRight);
+    hitbox.setRectangle(state.topLeft, state.bottomRight);
     hitbox.setPosition(position);
-    return (checkCollision(hitbox) & solidFlags) == 0;
+    return (checkCollision(hitbox) & state.solidFlags) == 0;
 }
 
 int TA_ObjectSet::getCollisionFlags(TA_Point position, TA_Point topLeft, TA_Point bottomRight, int solidFlags) {
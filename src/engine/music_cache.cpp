@@ -0,0 +1,486 @@
+#include "music_cache.h"
+
+#ifdef TA_MUSIC_CACHE
+
+#include <gme/gme.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "SDL3_mixer/SDL_mixer.h"
+#include "error.h"
+#include "filesystem.h"
+#include "profiler.h"
+#include "resource_manager.h"
+#include "save.h"
+#include "thread_pool.h"
+#include "tools.h"
+
+// VGM tracks are rendered to PCM once on the background thread and stored on disk as delta coded samples, later plays
+// decode them in a Mix_HookMusic callback instead of emulating the sound chip on the audio thread
+
+namespace TA::musicCache {
+    struct Track {
+        std::string data;
+        uint32_t frames = 0, loopStart = 0, loopOffset = 0;
+        std::array<int16_t, 2> loopPrevious{};
+        int channels = 2;
+        bool loop = false;
+        double renderNsPerFrame = 0;
+    };
+
+    struct Job {
+        std::string data;
+        uint64_t hash;
+    };
+
+    struct Playback {
+        std::mutex mutex;
+        std::shared_ptr<const Track> track;
+        SDL_AudioStream* stream = nullptr;
+        size_t offset = 0;
+        uint32_t frame = 0;
+        std::array<int16_t, 2> previous{};
+        int playsLeft = 1, fadeFrames = 0, fadeLeft = 0;
+        bool playing = false;
+    };
+
+    constexpr uint32_t magic = 0x434D4154; // TAMC
+    constexpr uint32_t version = 1;
+    constexpr uint32_t sampleRate = 44100;
+    constexpr size_t headerSize = 40;
+    constexpr int blockFrames = 512;
+    constexpr size_t maxLoadedTracks = 3;
+
+    uint64_t getHash(const std::string& data);
+    uint32_t readU32(const std::string& data, size_t pos);
+    void writeU32(std::string& data, uint32_t value);
+    std::filesystem::path getCachePath(uint64_t hash);
+    std::shared_ptr<const Track> loadTrack(uint64_t hash);
+    void queueRender(const std::string& filename, uint64_t hash);
+    void renderTrack(const Job& job);
+    std::string encodeTrack(const std::vector<int16_t>& samples, uint32_t frames, bool loop, uint32_t loopStart,
+        uint32_t renderMicroseconds);
+    int decode(int16_t* output, int frames);
+    void mix(void* userdata, Uint8* stream, int length);
+
+    bool enabled = false, hooked = false;
+    std::filesystem::path cachePath;
+    std::unordered_map<std::string, uint64_t> hashes;
+    std::unordered_map<uint64_t, std::shared_ptr<const Track>> loadedTracks;
+    std::deque<uint64_t> loadedOrder;
+
+    std::unordered_set<uint64_t> queuedHashes;
+
+    Playback playback;
+    std::atomic<int> volume{MIX_MAX_VOLUME};
+    std::atomic<long long> savedNs{0};
+    int silence = 0;
+}
+
+void TA::musicCache::init() {
+    if(TA::arguments.contains("--live-music")) {
+        return;
+    }
+
+    int frequency = 0, channels = 0;
+    SDL_AudioFormat format;
+    if(!Mix_QuerySpec(&frequency, &format, &channels)) {
+        TA::printWarning("music cache disabled, failed to query audio spec: %s", SDL_GetError());
+        return;
+    }
+    SDL_AudioSpec sourceSpec{.format = SDL_AUDIO_S16, .channels = 2, .freq = static_cast<int>(sampleRate)};
+    SDL_AudioSpec targetSpec{.format = format, .channels = channels, .freq = frequency};
+    playback.stream = SDL_CreateAudioStream(&sourceSpec, &targetSpec);
+    if(playback.stream == nullptr) {
+        TA::printWarning("music cache disabled, failed to create audio stream: %s", SDL_GetError());
+        return;
+    }
+    silence = SDL_GetSilenceValueForFormat(format);
+
+    cachePath = TA::save::getDataDirectory() / "music_cache";
+    std::error_code error;
+    std::filesystem::create_directories(cachePath, error);
+    if(error) {
+        TA::printWarning("music cache disabled, failed to create %s", cachePath.string().c_str());
+        return;
+    }
+    enabled = true;
+}
+
+bool TA::musicCache::play(const std::string& filename, int repeat) {
+    stop();
+    if(!enabled || !filename.ends_with(".vgm")) {
+        return false;
+    }
+
+    if(!hashes.contains(filename)) {
+        hashes[filename] = getHash(TA::resmgr::loadAsset(filename));
+    }
+    uint64_t hash = hashes[filename];
+    std::shared_ptr<const Track> track = loadTrack(hash);
+    if(track == nullptr) {
+        queueRender(filename, hash);
+        return false;
+    }
+
+    Mix_HaltMusic();
+    {
+        std::lock_guard<std::mutex> lock(playback.mutex);
+        playback.track = track;
+        playback.offset = playback.frame = 0;
+        playback.previous = {0, 0};
+        playback.playsLeft = (repeat == 0 ? 1 : repeat);
+        playback.fadeFrames = playback.fadeLeft = 0;
+        playback.playing = true;
+        SDL_ClearAudioStream(playback.stream);
+    }
+    Mix_HookMusic(mix, nullptr);
+    hooked = true;
+    return true;
+}
+
+void TA::musicCache::stop() {
+    if(!hooked) {
+        return;
+    }
+    Mix_HookMusic(nullptr, nullptr);
+    hooked = false;
+    std::lock_guard<std::mutex> lock(playback.mutex);
+    playback.playing = false;
+}
+
+void TA::musicCache::update(int newVolume) {
+    volume = newVolume;
+    TA::profiler::setCounter(TA_COUNTER_MUSIC_SAVED, savedNs / 1000000);
+}
+
+bool TA::musicCache::isPlaying() {
+    if(!hooked) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(playback.mutex);
+    return playback.playing;
+}
+
+void TA::musicCache::fadeOut(int milliseconds) {
+    if(milliseconds <= 0) {
+        stop();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(playback.mutex);
+    playback.fadeFrames = playback.fadeLeft = static_cast<int>(milliseconds * sampleRate / 1000);
+}
+
+void TA::musicCache::quit() {
+    stop();
+    if(playback.stream != nullptr) {
+        SDL_DestroyAudioStream(playback.stream);
+        playback.stream = nullptr;
+    }
+    if(enabled && TA::arguments.contains("--debug")) {
+        TA::printLog("music cache: %lli ms of audio thread time saved", savedNs / 1000000);
+    }
+}
+
+uint64_t TA::musicCache::getHash(const std::string& data) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for(char byte : data) {
+        hash = (hash ^ static_cast<unsigned char>(byte)) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+uint32_t TA::musicCache::readU32(const std::string& data, size_t pos) {
+    uint32_t value = 0;
+    for(int byte = 3; byte >= 0; byte--) {
+        value = (value << 8) | static_cast<unsigned char>(data[pos + byte]);
+    }
+    return value;
+}
+
+void TA::musicCache::writeU32(std::string& data, uint32_t value) {
+    for(int byte = 0; byte < 4; byte++) {
+        data.push_back(static_cast<char>((value >> (byte * 8)) & 0xFF));
+    }
+}
+
+std::filesystem::path TA::musicCache::getCachePath(uint64_t hash) {
+    char name[32];
+    SDL_snprintf(name, sizeof(name), "%016llx.tamc", static_cast<unsigned long long>(hash));
+    return cachePath / name;
+}
+
+std::shared_ptr<const TA::musicCache::Track> TA::musicCache::loadTrack(uint64_t hash) {
+    if(loadedTracks.contains(hash)) {
+        return loadedTracks.at(hash);
+    }
+    std::filesystem::path path = getCachePath(hash);
+    if(!TA::filesystem::fileExists(path)) {
+        return nullptr;
+    }
+
+    std::string data = TA::filesystem::readFile(path);
+    if(data.size() < headerSize || readU32(data, 0) != magic || readU32(data, 4) != version ||
+        readU32(data, 8) != sampleRate) {
+        TA::printWarning("ignoring outdated music cache %s", path.string().c_str());
+        return nullptr;
+    }
+
+    auto track = std::make_shared<Track>();
+    track->channels = static_cast<int>(readU32(data, 12));
+    track->frames = readU32(data, 16);
+    track->loop = readU32(data, 20) != 0;
+    track->loopStart = readU32(data, 24);
+    track->loopOffset = readU32(data, 28);
+    uint32_t loopPrevious = readU32(data, 32);
+    track->loopPrevious = {static_cast<int16_t>(loopPrevious & 0xFFFF), static_cast<int16_t>(loopPrevious >> 16)};
+    track->renderNsPerFrame = static_cast<double>(readU32(data, 36)) * 1000 / std::max<uint32_t>(track->frames, 1);
+    track->data = data.substr(headerSize);
+
+    if(loadedOrder.size() >= maxLoadedTracks) {
+        loadedTracks.erase(loadedOrder.front());
+        loadedOrder.pop_front();
+    }
+    loadedTracks[hash] = track;
+    loadedOrder.push_back(hash);
+    return track;
+}
+
+void TA::musicCache::queueRender(const std::string& filename, uint64_t hash) {
+    if(queuedHashes.contains(hash)) {
+        return;
+    }
+    queuedHashes.insert(hash);
+    // the asset is read here, the resource manager is only used from the main thread
+    auto job = std::make_shared<Job>(Job{TA::resmgr::loadAsset(filename), hash});
+    TA::threadPool::runInBackground([job]() { renderTrack(*job); });
+}
+
+void TA::musicCache::renderTrack(const Job& job) {
+    if(job.data.size() < 0x24 || job.data.substr(0, 4) != "Vgm ") {
+        TA::printWarning("music cache: unsupported VGM file");
+        return;
+    }
+
+    // sample counts in the VGM header are at 44100 Hz, the loop is the tail of the track
+    uint32_t frames = readU32(job.data, 0x18);
+    uint32_t loopSamples = readU32(job.data, 0x20);
+    bool loop = readU32(job.data, 0x1C) != 0 && loopSamples != 0 && loopSamples <= frames;
+    uint32_t loopStart = (loop ? frames - loopSamples : 0);
+
+    Music_Emu* emu = nullptr;
+    if(gme_open_data(job.data.data(), static_cast<long>(job.data.size()), &emu, sampleRate) != nullptr) {
+        TA::printWarning("music cache: failed to open VGM file");
+        return;
+    }
+    gme_ignore_silence(emu, 1);
+    gme_set_autoload_playback_limit(emu, 0);
+
+    std::vector<int16_t> samples(static_cast<size_t>(frames) * 2);
+    auto startTime = std::chrono::steady_clock::now();
+    gme_err_t error = gme_start_track(emu, 0);
+    for(uint32_t frame = 0; frame < frames && error == nullptr; frame += blockFrames) {
+        int count = static_cast<int>(std::min<uint32_t>(blockFrames, frames - frame));
+        error = gme_play(emu, count * 2, samples.data() + (static_cast<size_t>(frame) * 2));
+    }
+    auto renderTime = std::chrono::steady_clock::now() - startTime;
+    gme_delete(emu);
+    if(error != nullptr) {
+        TA::printWarning("music cache: failed to render VGM file: %s", error);
+        return;
+    }
+
+    uint32_t renderMicroseconds =
+        static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(renderTime).count());
+    std::string data = encodeTrack(samples, frames, loop, loopStart, renderMicroseconds);
+
+    std::filesystem::path path = getCachePath(job.hash);
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    std::string tempPathStr = tempPath.string();
+    SDL_IOStream* file = SDL_IOFromFile(tempPathStr.c_str(), "wb");
+    if(file == nullptr) {
+        TA::printWarning("music cache: failed to open %s: %s", tempPathStr.c_str(), SDL_GetError());
+        return;
+    }
+    bool written = SDL_WriteIO(file, data.data(), data.size()) == data.size();
+    written = SDL_CloseIO(file) && written;
+
+    std::error_code renameError;
+    if(written) {
+        std::filesystem::rename(tempPath, path, renameError);
+    }
+    if(!written || renameError) {
+        TA::printWarning("music cache: failed to write %s", path.string().c_str());
+        std::filesystem::remove(tempPath, renameError);
+    }
+}
+
+std::string TA::musicCache::encodeTrack(const std::vector<int16_t>& samples, uint32_t frames, bool loop,
+    uint32_t loopStart, uint32_t renderMicroseconds) {
+    int channels = 1;
+    for(uint32_t frame = 0; frame < frames && channels == 1; frame++) {
+        if(samples[frame * 2] != samples[(frame * 2) + 1]) {
+            channels = 2;
+        }
+    }
+
+    std::string data;
+    data.reserve(headerSize + (static_cast<size_t>(frames) * channels * 2));
+    writeU32(data, magic);
+    writeU32(data, version);
+    writeU32(data, sampleRate);
+    writeU32(data, channels);
+    writeU32(data, frames);
+    writeU32(data, loop);
+    writeU32(data, loopStart);
+    data.resize(headerSize);
+
+    // zigzag varints of the difference from the previous sample in the same channel
+    std::array<int16_t, 2> previous{};
+    for(uint32_t frame = 0; frame < frames; frame++) {
+        if(loop && frame == loopStart) {
+            uint32_t loopPrevious =
+                static_cast<uint16_t>(previous[0]) | (static_cast<uint32_t>(static_cast<uint16_t>(previous[1])) << 16);
+            std::string loopHeader;
+            writeU32(loopHeader, static_cast<uint32_t>(data.size() - headerSize));
+            writeU32(loopHeader, loopPrevious);
+            data.replace(28, 8, loopHeader);
+        }
+        for(int channel = 0; channel < channels; channel++) {
+            int16_t sample = samples[(frame * 2) + channel];
+            auto delta = static_cast<int16_t>(static_cast<uint16_t>(sample) - static_cast<uint16_t>(previous[channel]));
+            auto value = static_cast<uint32_t>(static_cast<uint16_t>((delta << 1) ^ (delta >> 15)));
+            while(value >= 0x80) {
+                data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            data.push_back(static_cast<char>(value));
+            previous[channel] = sample;
+        }
+    }
+
+    std::string renderHeader;
+    writeU32(renderHeader, renderMicroseconds);
+    data.replace(36, 4, renderHeader);
+    return data;
+}
+
+int TA::musicCache::decode(int16_t* output, int frames) {
+    const Track& track = *playback.track;
+    int decoded = 0;
+
+    while(decoded < frames) {
+        if(playback.frame >= track.frames) {
+            if(track.frames == 0 || (playback.playsLeft != -1 && --playback.playsLeft <= 0)) {
+                break;
+            }
+            playback.frame = (track.loop ? track.loopStart : 0);
+            playback.offset = (track.loop ? track.loopOffset : 0);
+            playback.previous = (track.loop ? track.loopPrevious : std::array<int16_t, 2>{});
+        }
+
+        for(int channel = 0; channel < track.channels; channel++) {
+            uint32_t value = 0;
+            int shift = 0;
+            unsigned char byte = 0x80;
+            while((byte & 0x80) != 0 && playback.offset < track.data.size()) {
+                byte = static_cast<unsigned char>(track.data[playback.offset++]);
+                value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                shift += 7;
+            }
+            auto delta = static_cast<uint16_t>((value >> 1) ^ (~(value & 1) + 1));
+            playback.previous[channel] =
+                static_cast<int16_t>(static_cast<uint16_t>(playback.previous[channel]) + delta);
+        }
+
+        output[decoded * 2] = playback.previous[0];
+        output[(decoded * 2) + 1] = playback.previous[track.channels - 1];
+        playback.frame++;
+        decoded++;
+    }
+
+    int currentVolume = volume;
+    for(int frame = 0; frame < decoded; frame++) {
+        int gain = currentVolume;
+        if(playback.fadeFrames != 0) {
+            gain = gain * playback.fadeLeft / playback.fadeFrames;
+            playback.fadeLeft = std::max(0, playback.fadeLeft - 1);
+        }
+        output[frame * 2] = static_cast<int16_t>(output[frame * 2] * gain / MIX_MAX_VOLUME);
+        output[(frame * 2) + 1] = static_cast<int16_t>(output[(frame * 2) + 1] * gain / MIX_MAX_VOLUME);
+    }
+    if(playback.fadeFrames != 0 && playback.fadeLeft == 0) {
+        playback.playing = false;
+    }
+    return decoded;
+}
+
+void TA::musicCache::mix(void* /*userdata*/, Uint8* stream, int length) {
+    Uint64 startCounter = SDL_GetPerformanceCounter();
+    std::lock_guard<std::mutex> lock(playback.mutex);
+    std::array<int16_t, blockFrames * 2> buffer;
+    int filled = 0, decodedFrames = 0;
+
+    while(filled < length) {
+        int received = SDL_GetAudioStreamData(playback.stream, stream + filled, length - filled);
+        if(received < 0) {
+            break;
+        }
+        if(received > 0) {
+            filled += received;
+            continue;
+        }
+        if(!playback.playing || playback.track == nullptr) {
+            break;
+        }
+        int frames = decode(buffer.data(), blockFrames);
+        if(frames == 0) {
+            playback.playing = false;
+            SDL_FlushAudioStream(playback.stream);
+            continue;
+        }
+        decodedFrames += frames;
+        SDL_PutAudioStreamData(playback.stream, buffer.data(), frames * 2 * static_cast<int>(sizeof(int16_t)));
+    }
+    if(filled < length) {
+        SDL_memset(stream + filled, silence, length - filled);
+    }
+
+    if(playback.track != nullptr) {
+        Uint64 elapsedCounter = SDL_GetPerformanceCounter() - startCounter;
+        double elapsedNs =
+            static_cast<double>(elapsedCounter) * 1e9 / static_cast<double>(SDL_GetPerformanceFrequency());
+        savedNs += static_cast<long long>((decodedFrames * playback.track->renderNsPerFrame) - elapsedNs);
+    }
+}
+
+#else
+
+void TA::musicCache::init() {}
+
+bool TA::musicCache::play(const std::string& /*filename*/, int /*repeat*/) {
+    return false;
+}
+
+void TA::musicCache::stop() {}
+
+void TA::musicCache::update(int /*volume*/) {}
+
+bool TA::musicCache::isPlaying() {
+    return false;
+}
+
+void TA::musicCache::fadeOut(int /*milliseconds*/) {}
+
+void TA::musicCache::quit() {}
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef TA_MUSIC_CACHE_H
+#define TA_MUSIC_CACHE_H
+
+#include <string>
+
+namespace TA::musicCache {
+    void init();
+    bool play(const std::string& filename, int repeat);
+    void stop();
+    void update(int volume);
+    bool isPlaying();
+    void fadeOut(int milliseconds);
+    void quit();
+}
+
+#endif // TA_MUSIC_CACHE_H
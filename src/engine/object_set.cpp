@@ -45,9 +45,11 @@
 #include "objects/wind.h"
 #include "objects/wood.h"
 #include "pilot.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "save.h"
 #include "sea_fox.h"
+#include "thread_pool.h"
 
 inline float asIntOrFloat(const toml::value& value) {
     if(value.is_floating()) {
@@ -56,11 +58,48 @@ inline float asIntOrFloat(const toml::value& value) {
     return value.as_integer();
 }
 
-TA_Object::TA_Object(TA_ObjectSet* newObjectSet) {
-    objectSet = newObjectSet;
+int TA_ObjectHotStore::allocate(TA_Object* object) {
+    if(freeSlots.empty()) {
+        int firstSlot = static_cast<int>(chunks.size()) * chunkSize;
+        chunks.push_back(std::make_unique<Chunk>());
+        chunks.back()->collisionTypes.fill(TA_COLLISION_TRANSPARENT);
+        // handed out lowest first so live data gathers at the front of the chunks
+        for(int slot = firstSlot + chunkSize - 1; slot >= firstSlot; slot--) {
+            freeSlots.push_back(slot);
+        }
+    }
+    int slot = freeSlots.back();
+    freeSlots.pop_back();
+    getChunk(slot).objects[slot % chunkSize] = object;
+    return slot;
+}
+
+void TA_ObjectHotStore::release(int slot) {
+    Chunk& chunk = getChunk(slot);
+    int pos = slot % chunkSize;
+    chunk.objects[pos] = nullptr;
+    chunk.hitboxes[pos] = TA_Rect();
+    chunk.collisionTypes[pos] = TA_COLLISION_TRANSPARENT;
+    chunk.hitboxVectors[pos] = std::vector<TA_ObjectHitbox>();
+    chunk.positions[pos] = TA_Point();
+    freeSlots.push_back(slot);
+}
+
+TA_Object::TA_Object(TA_ObjectSet* newObjectSet)
+    : objectSet(newObjectSet),
+      hotSlot(newObjectSet->hotStore.allocate(this)),
+      position(newObjectSet->hotStore.getPosition(hotSlot)),
+      hitbox(newObjectSet->hotStore.getHitbox(hotSlot)),
+      collisionType(newObjectSet->hotStore.getCollisionType(hotSlot)),
+      hitboxVector(newObjectSet->hotStore.getHitboxVector(hotSlot)) {
+    context = objectSet->getLinks().context;
     setCamera(objectSet->getLinks().camera);
 }
 
+TA_Object::~TA_Object() {
+    objectSet->hotStore.release(hotSlot);
+}
+
 void TA_Object::updatePosition() {
     setPosition(position);
     hitbox.setPosition(position);
@@ -69,6 +108,15 @@ void TA_Object::updatePosition() {
     }
 }
 
+TA_Rect TA_Object::getActivationRect() {
+    return {position, position + TA_Point(getWidth(), getHeight())};
+}
+
+TA_Rect TA_Object::getDrawRect() {
+    TA_Point spritePosition = TA_Sprite::getPosition();
+    return {spritePosition, spritePosition + TA_Point(getWidth(), getHeight())};
+}
+
 TA_Point TA_Object::getDistanceToCharacter() {
     TA_Point characterPosition = objectSet->getCharacterPosition();
     TA_Point centeredPosition = position + TA_Point(getWidth() / 2, getHeight() / 2);
@@ -84,6 +132,9 @@ void TA_ObjectSet::load(std::string filename) {
 }
 
 void TA_ObjectSet::tryLoad(std::string filename) {
+    debugChecks = TA::arguments.contains("--debug");
+    // the pool may have workers for the cpu renderer alone, updates only use them when asked to
+    parallelUpdate = TA::save::getParameter("update_threads") != 0;
     const toml::value& table = TA::resmgr::loadToml(filename);
     if(table.contains("level") && table.at("level").contains("music")) {
         TA::sound::playMusic(table.at("level").at("music").as_string());
@@ -96,7 +147,7 @@ void TA_ObjectSet::tryLoad(std::string filename) {
             if(spawn.contains("previous")) {
                 currentLevelPath = spawn.at("previous").as_string();
             }
-            if(!firstSpawnPointSet || currentLevelPath == TA::previousLevelPath) {
+            if(!firstSpawnPointSet || currentLevelPath == links.context->previousLevelPath) {
                 spawnPoint = position;
                 spawnFlip = spawn.contains("flip") && spawn.at("flip").as_boolean();
                 firstSpawnPointSet = true;
@@ -104,10 +155,6 @@ void TA_ObjectSet::tryLoad(std::string filename) {
         }
     }
 
-    if(table.contains("level") && table.at("level").contains("water_level") && links.seaFox != nullptr) {
-        waterLevel = table.at("level").at("water_level").as_integer();
-    }
-
     if(table.contains("level") && table.at("level").contains("borders")) {
         std::array<std::string, 4> borders = {"top", "bottom", "left", "right"};
         int mask = 0;
@@ -132,8 +179,15 @@ void TA_ObjectSet::tryLoad(std::string filename) {
         links.camera->setBorderMask(mask);
     }
 
-    if(table.contains("level") && table.at("level").contains("night")) {
-        night = table.at("level").at("night").as_boolean();
+    if(table.contains("level") && table.at("level").contains("streaming")) {
+        streaming = table.at("level").at("streaming").as_boolean();
+    }
+    if(streaming) {
+        streamMargin = static_cast<float>(TA::save::getParameter("stream_margin"));
+        streamRegionsWidth = links.tilemap->getWidth() / streamRegionSize + 1;
+        streamRegionsHeight = links.tilemap->getHeight() / streamRegionSize + 1;
+        streamRegions.resize(streamRegionsWidth * streamRegionsHeight);
+        loadedRegions.assign(streamRegions.size(), false);
     }
 
     if(table.contains("objects") && table.at("objects").contains("static")) {
@@ -146,13 +200,17 @@ void TA_ObjectSet::tryLoad(std::string filename) {
     if(table.contains("objects") && table.at("objects").contains("default")) {
         for(const auto& [name, array] : table.at("objects").at("default").as_table()) {
             for(const auto& object : array.as_array()) {
-                loadObject(name, object);
+                if(streaming) {
+                    addStreamRecord(name, object);
+                } else {
+                    loadObject(name, object);
+                }
             }
         }
     }
 }
 
-void TA_ObjectSet::loadObject(std::string name, toml::value object) {
+TA_Point TA_ObjectSet::getObjectPosition(const toml::value& object) {
     TA_Point position{0, 0};
     if(object.contains("tile_x")) {
         position.x = static_cast<int>(object.at("tile_x").as_integer()) * 16;
@@ -170,6 +228,27 @@ void TA_ObjectSet::loadObject(std::string name, toml::value object) {
     if(object.contains("offset_y")) {
         position.y += static_cast<int>(object.at("offset_y").as_integer());
     }
+    return position;
+}
+
+void TA_ObjectSet::addStreamRecord(const std::string& name, const toml::value& object) {
+    // objects defined by an area are transitions and triggers, they have to exist from the start
+    bool hasPosition = object.contains("x") || object.contains("tile_x");
+    if(!hasPosition || object.contains("left")) {
+        loadObject(name, object);
+        return;
+    }
+
+    TA_Point position = getObjectPosition(object);
+    int regionX = std::clamp(static_cast<int>(position.x) / streamRegionSize, 0, streamRegionsWidth - 1);
+    int regionY = std::clamp(static_cast<int>(position.y) / streamRegionSize, 0, streamRegionsHeight - 1);
+    int region = regionY * streamRegionsWidth + regionX;
+    streamRegions[region].push_back(static_cast<int>(streamRecords.size()));
+    streamRecords.push_back({name, object, region});
+}
+
+void TA_ObjectSet::loadObject(std::string name, toml::value object) {
+    TA_Point position = getObjectPosition(object);
 
     if(name == "breakable_block") {
         bool dropsRing = object.contains("drops_ring") && object.at("drops_ring").as_boolean();
@@ -458,51 +537,393 @@ void TA_ObjectSet::loadObject(std::string name, toml::value object) {
     }
 }
 
+template <typename Function>
+void TA_ObjectSet::forEachLiveObject(Function function) {
+    if(hotStoreEnabled) {
+        hotStore.forEach(function);
+        return;
+    }
+    // the walk objects had before the hot store, every object is loaded through its pointer
+    auto walk = [&](const std::vector<TA_Object*>& list) {
+        for(TA_Object* object : list) {
+            function(object, object->hitbox, object->collisionType, object->hitboxVector);
+        }
+    };
+    walk(objects);
+    walk(sleepingObjects);
+}
+
 void TA_ObjectSet::update() {
     for(TA_Object* currentObject : deleteList) {
         delete currentObject;
     }
+    updateStreaming();
     for(TA_Object* currentObject : spawnedObjects) {
+        currentObject->id = nextObjectId++;
         objects.push_back(currentObject);
     }
     deleteList.clear();
     spawnedObjects.clear();
 
+    updateActivation();
+
+    // every live object is either active or asleep here, and both kinds collide
     hitboxContainer.clear();
-    for(TA_Object* currentObject : objects) {
-        hitboxContainer.add(currentObject->hitbox, currentObject->collisionType);
-        for(TA_Object::HitboxVectorElement& element : currentObject->hitboxVector) {
+    forEachLiveObject([&](TA_Object* /*object*/, const TA_Rect& hitbox, int type,
+        const std::vector<TA_ObjectHitbox>& hitboxVector) {
+        hitboxContainer.add(hitbox, type);
+        for(const TA_ObjectHitbox& element : hitboxVector) {
             hitboxContainer.add(element.hitbox, element.collisionType);
         }
-    }
+    });
+    projectiles.addHitboxes(hitboxContainer);
+    updateContacts();
+    prepareObjects();
 
-    std::vector<TA_Object*> newObjects;
+    // spawns, sounds and save changes all happen here, in the same order as before
+    updatedObjects.clear();
     for(TA_Object* currentObject : objects) {
         if(currentObject->update()) {
-            newObjects.push_back(currentObject);
+            updatedObjects.push_back(currentObject);
         } else {
+            if(currentObject->streamRecord != -1) {
+                streamRecords[currentObject->streamRecord].spawned = nullptr;
+                streamRecords[currentObject->streamRecord].gone = true;
+            }
             deleteList.push_back(currentObject);
         }
     }
-    objects = newObjects;
+    objects.swap(updatedObjects);
+    projectiles.update();
+    particles.update();
+    drawBucketsUpdateNeeded = true;
+
+    peakActiveObjects = std::max(peakActiveObjects, getActiveObjectsCount());
+    TA::profiler::setCounter(TA_COUNTER_ACTIVE_OBJECTS, getActiveObjectsCount());
+    TA::profiler::setCounter(TA_COUNTER_SLEEPING_OBJECTS, getSleepingObjectsCount());
+    TA::profiler::setCounter(TA_COUNTER_PARTICLES, particles.getCount());
+    TA::profiler::setCounter(TA_COUNTER_CONTACTS, contactCount);
+}
+
+void TA_ObjectSet::prepareObjects() {
+    if(!parallelUpdate || TA::threadPool::getThreadCount() == 0) {
+        for(TA_Object* currentObject : objects) {
+            currentObject->prepareUpdate();
+        }
+        return;
+    }
+    hitboxContainer.freeze();
+    TA::threadPool::parallelFor(static_cast<int>(objects.size()), prepareGrain, [&](int begin, int end) {
+        for(int pos = begin; pos < end; pos++) {
+            objects[pos]->prepareUpdate();
+        }
+    });
+}
+
+void TA_ObjectSet::updateContacts() {
+    contactSweep.clear();
+    contactOwners.clear();
+    contactCount = 0;
+
+    forEachLiveObject([&](TA_Object* object, const TA_Rect& hitbox, int type,
+        const std::vector<TA_ObjectHitbox>& hitboxVector) {
+        int owner = static_cast<int>(contactOwners.size());
+        contactOwners.push_back(object);
+        object->contactFlags = 0;
+        object->contacts.clear();
+        contactSweep.add(hitbox, type, owner);
+        for(const TA_ObjectHitbox& element : hitboxVector) {
+            contactSweep.add(element.hitbox, element.collisionType, owner);
+        }
+    });
+    projectiles.forEachHitbox(
+        [&](const TA_Rect& hitbox, int type) { contactSweep.add(hitbox, type, projectileOwner); });
+    addCharacterContacts();
+
+    // the same sides as the polled queries: an object's box queries the container, while getTargetCollisionFlags
+    // asks the character's boxes whether they intersect the object, which only matters for touching edges
+    auto touches = [](const TA_ContactSweep::Entry& receiver, const TA_ContactSweep::Entry& giver) {
+        if(giver.owner == characterOwner) {
+            return TA_ContactSweep::hits(giver, receiver);
+        }
+        return TA_ContactSweep::hits(receiver, giver);
+    };
+    contactSweep.forEachPair([&](const TA_ContactSweep::Entry& first, const TA_ContactSweep::Entry& second) {
+        bool firstTouched = (first.owner >= 0 && touches(first, second));
+        bool secondTouched = (second.owner >= 0 && touches(second, first));
+        if(firstTouched) {
+            addContact(first.owner, second);
+        }
+        if(secondTouched) {
+            addContact(second.owner, first);
+        }
+        if(firstTouched || secondTouched) {
+            contactCount++;
+        }
+    });
+}
+
+void TA_ObjectSet::addContact(int owner, const TA_ContactSweep::Entry& other) {
+    TA_Object* object = contactOwners[owner];
+    TA_Object* otherObject = (other.owner >= 0 ? contactOwners[other.owner] : nullptr);
+    object->contactFlags |= other.type;
+    for(TA_ObjectContact& contact : object->contacts) {
+        if(contact.other == otherObject) {
+            contact.flags |= other.type;
+            return;
+        }
+    }
+    object->contacts.push_back({otherObject, other.type});
+}
+
+void TA_ObjectSet::addCharacterContacts() {
+    // the same sources getTargetCollisionFlags checks
+    if(links.character) {
+        contactSweep.add(*links.character->getHitbox(), TA_COLLISION_CHARACTER, characterOwner);
+    } else if(links.seaFox) {
+        contactSweep.add(*links.seaFox->getHitbox(), TA_COLLISION_CHARACTER, characterOwner);
+    }
+    if(links.character && links.character->isUsingHammer()) {
+        contactSweep.add(*links.character->getHammerHitbox(), TA_COLLISION_ATTACK, characterOwner);
+    }
+    if(links.seaFox) {
+        contactSweep.add(*links.seaFox->getDrillHitbox(), TA_COLLISION_DRILL, characterOwner);
+    }
+}
+
+void TA_ObjectSet::updateActivation() {
+    if(links.camera == nullptr || links.tilemap == nullptr) {
+        return;
+    }
+    if(activationCells.empty()) {
+        activationCellsWidth = links.tilemap->getWidth() / activationCellSize + 1;
+        activationCellsHeight = links.tilemap->getHeight() / activationCellSize + 1;
+        activationCells.resize(activationCellsWidth * activationCellsHeight);
+    }
+
+    TA_Rect keepRect = getCameraRect(sleepMargin);
+    size_t awakeCount = 0;
+    for(TA_Object* currentObject : objects) {
+        TA_ActivationPolicy policy = currentObject->getActivationPolicy();
+        bool shouldSleep = false;
+        if(policy == TA_ACTIVATION_NEAR_CAMERA) {
+            shouldSleep = !getWakeRect(currentObject).intersects(keepRect);
+        } else if(policy == TA_ACTIVATION_TRIGGER) {
+            shouldSleep = !currentObject->triggered;
+        }
+
+        if(shouldSleep) {
+            putToSleep(currentObject);
+        } else {
+            objects[awakeCount++] = currentObject;
+        }
+    }
+    objects.resize(awakeCount);
+
+    wakeList.clear();
+    TA_Rect cameraRect = getCameraRect(0);
+    forEachActivationCell(cameraRect, [&](std::vector<TA_Object*>& cell) {
+        for(TA_Object* currentObject : cell) {
+            if(currentObject->getActivationPolicy() != TA_ACTIVATION_TRIGGER &&
+                currentObject->wakeRect.intersects(cameraRect)) {
+                wakeList.push_back(currentObject);
+            }
+        }
+    });
+
+    TA_Point characterPosition = getCharacterPosition();
+    forEachActivationCell(TA_Rect(characterPosition, characterPosition), [&](std::vector<TA_Object*>& cell) {
+        for(TA_Object* currentObject : cell) {
+            if(currentObject->getActivationPolicy() == TA_ACTIVATION_TRIGGER &&
+                currentObject->wakeRect.inside(characterPosition)) {
+                currentObject->triggered = true;
+                wakeList.push_back(currentObject);
+            }
+        }
+    });
+
+    // wake order must not depend on the cell layout
+    std::sort(wakeList.begin(), wakeList.end(), [](TA_Object* a, TA_Object* b) { return a->id < b->id; });
+    for(TA_Object* currentObject : wakeList) {
+        if(currentObject->sleepingIndex != -1) {
+            wakeUp(currentObject);
+        }
+    }
+}
+
+void TA_ObjectSet::updateStreaming() {
+    if(!streaming || links.camera == nullptr) {
+        return;
+    }
+
+    // regions are released further out than they are loaded, so standing on an edge doesn't churn them
+    TA_Rect loadRect = getCameraRect(streamMargin);
+    TA_Rect keepRect = getCameraRect(streamMargin + streamRegionSize);
+    for(int regionY = 0; regionY < streamRegionsHeight; regionY++) {
+        for(int regionX = 0; regionX < streamRegionsWidth; regionX++) {
+            int region = regionY * streamRegionsWidth + regionX;
+            TA_Point topLeft = TA_Point(regionX, regionY) * streamRegionSize;
+            TA_Rect regionRect(topLeft, topLeft + TA_Point(streamRegionSize, streamRegionSize));
+
+            if(!loadedRegions[region] && regionRect.intersects(loadRect)) {
+                for(int record : streamRegions[region]) {
+                    if(!streamRecords[record].gone && streamRecords[record].spawned == nullptr) {
+                        spawnStreamRecord(record);
+                    }
+                }
+                loadedRegions[region] = true;
+            } else if(loadedRegions[region] && !regionRect.intersects(keepRect)) {
+                // objects still awake out there are reclaimed below once they fall asleep
+                for(int record : streamRegions[region]) {
+                    if(streamRecords[record].spawned != nullptr) {
+                        strandedRecords.push_back(record);
+                    }
+                }
+                loadedRegions[region] = false;
+            }
+        }
+    }
+
+    std::erase_if(strandedRecords, [&](int record) {
+        TA_Object* object = streamRecords[record].spawned;
+        if(object == nullptr || loadedRegions[streamRecords[record].region]) {
+            return true;
+        }
+        if(object->sleepingIndex == -1) {
+            return false;
+        }
+        removeSleeping(object);
+        delete object;
+        streamRecords[record].spawned = nullptr;
+        return true;
+    });
+}
+
+void TA_ObjectSet::spawnStreamRecord(int record) {
+    size_t count = spawnedObjects.size();
+    loadObject(streamRecords[record].name, streamRecords[record].object);
+    if(spawnedObjects.size() > count) {
+        // objects spawned by the object's load come before it
+        spawnedObjects.back()->streamRecord = record;
+        streamRecords[record].spawned = spawnedObjects.back();
+    }
+}
+
+void TA_ObjectSet::putToSleep(TA_Object* object) {
+    object->wakeRect = getWakeRect(object);
+    object->sleepingIndex = static_cast<int>(sleepingObjects.size());
+    sleepingObjects.push_back(object);
+    forEachActivationCell(object->wakeRect, [&](std::vector<TA_Object*>& cell) { cell.push_back(object); });
+}
+
+void TA_ObjectSet::wakeUp(TA_Object* object) {
+    removeSleeping(object);
+    objects.push_back(object);
+}
+
+void TA_ObjectSet::removeSleeping(TA_Object* object) {
+    forEachActivationCell(object->wakeRect, [&](std::vector<TA_Object*>& cell) {
+        auto iterator = std::find(cell.begin(), cell.end(), object);
+        if(iterator != cell.end()) {
+            *iterator = cell.back();
+            cell.pop_back();
+        }
+    });
+
+    sleepingObjects[object->sleepingIndex] = sleepingObjects.back();
+    sleepingObjects[object->sleepingIndex]->sleepingIndex = object->sleepingIndex;
+    sleepingObjects.pop_back();
+    object->sleepingIndex = -1;
+}
+
+TA_Rect TA_ObjectSet::getWakeRect(TA_Object* object) {
+    TA_Rect rect = object->getActivationRect();
+    TA_Point radius{object->getWakeRadius(), object->getWakeRadius()};
+    return {rect.getTopLeft() - radius, rect.getBottomRight() + radius};
+}
+
+TA_Rect TA_ObjectSet::getCameraRect(float margin) {
+    TA_Point cameraPosition = links.camera->getPosition();
+    return {cameraPosition - TA_Point(margin, margin),
+        cameraPosition + TA_Point(links.context->screenWidth + margin, links.context->screenHeight + margin)};
+}
+
+std::vector<TA_Object*>& TA_ObjectSet::getActivationCell(int cellX, int cellY) {
+    return activationCells[cellY * activationCellsWidth + cellX];
+}
+
+template <typename Function>
+void TA_ObjectSet::forEachActivationCell(const TA_Rect& rect, Function function) {
+    auto getCell = [&](float coordinate, int cells) {
+        return std::clamp(static_cast<int>(std::floor(coordinate / activationCellSize)), 0, cells - 1);
+    };
+    int left = getCell(rect.getTopLeft().x, activationCellsWidth);
+    int right = getCell(rect.getBottomRight().x, activationCellsWidth);
+    int top = getCell(rect.getTopLeft().y, activationCellsHeight);
+    int bottom = getCell(rect.getBottomRight().y, activationCellsHeight);
+
+    for(int cellY = top; cellY <= bottom; cellY++) {
+        for(int cellX = left; cellX <= right; cellX++) {
+            function(getActivationCell(cellX, cellY));
+        }
+    }
 }
 
 void TA_ObjectSet::draw(int priority) {
-    if(night && !links.character->isNightVisionApplied()) {
+    if(links.level->night && !links.character->isNightVisionApplied()) {
         return;
     }
+    if(drawBucketsUpdateNeeded) {
+        updateDrawBuckets();
+    }
+    if(priority < 0 || priority >= static_cast<int>(drawBuckets.size())) {
+        return;
+    }
+    for(TA_Object* currentObject : drawBuckets[priority]) {
+        currentObject->draw();
+    }
+    projectiles.draw(priority);
+    particles.draw(priority);
+}
+
+void TA_ObjectSet::updateDrawBuckets() {
+    for(auto& bucket : drawBuckets) {
+        bucket.clear();
+    }
+
+    TA_Rect cameraRect = getCameraRect(5);
+    auto addObject = [&](TA_Object* currentObject) {
+        int priority = currentObject->getDrawPriority();
+        if(priority < 0 || priority >= static_cast<int>(drawBuckets.size())) {
+            return;
+        }
+        if(!currentObject->isCullable() || currentObject->getDrawRect().intersects(cameraRect)) {
+            drawBuckets[priority].push_back(currentObject);
+        }
+    };
     for(TA_Object* currentObject : objects) {
-        if(currentObject->getDrawPriority() == priority) {
-            currentObject->setUpdateAnimation(!isPaused());
-            currentObject->draw();
+        addObject(currentObject);
+    }
+
+    // trigger objects sleep in plain sight and keep colliding, so they stay drawn while their updates wait
+    for(TA_Object* currentObject : sleepingObjects) {
+        if(currentObject->getActivationPolicy() == TA_ACTIVATION_TRIGGER) {
+            addObject(currentObject);
+        } else if(debugChecks && currentObject->collisionType != TA_COLLISION_TRANSPARENT &&
+                  currentObject->hitbox.intersects(cameraRect)) {
+            TA::printWarning("object %i sleeps on screen with a hitbox but isn't drawn", currentObject->id);
         }
     }
+    drawBucketsUpdateNeeded = false;
 }
 
 void TA_ObjectSet::checkCollision(TA_Rect& hitbox, int& flags) {
     flags = links.tilemap->checkCollision(hitbox);
-    flags |= hitboxContainer.getCollisionFlags(hitbox);
+    flags |= getTargetCollisionFlags(hitbox);
+}
 
+int TA_ObjectSet::getTargetCollisionFlags(const TA_Rect& hitbox) {
+    int flags = hitboxContainer.getCollisionFlags(hitbox);
     if(links.character && links.character->getHitbox()->intersects(hitbox)) {
         flags |= TA_COLLISION_CHARACTER;
     } else if(links.seaFox && links.seaFox->getHitbox()->intersects(hitbox)) {
@@ -515,6 +936,7 @@ void TA_ObjectSet::checkCollision(TA_Rect& hitbox, int& flags) {
     if(links.seaFox && links.seaFox->getDrillHitbox()->intersects(hitbox)) {
         flags |= TA_COLLISION_DRILL;
     }
+    return flags;
 }
 
 int TA_ObjectSet::checkCollision(TA_Rect& hitbox) {
@@ -531,48 +953,74 @@ TA_Point TA_ObjectSet::getCharacterPosition() {
 }
 
 void TA_ObjectSet::addRings(int count) {
-    int rings = TA::save::getSaveParameter("rings");
+    int rings = TA::save::getSaveParameter(links.context, "rings");
     rings += count;
     rings = std::min(rings, getMaxRings());
-    TA::save::setSaveParameter("rings", rings);
+    TA::save::setSaveParameter(links.context, "rings", rings);
 }
 
 void TA_ObjectSet::addRingsToMaximum() {
-    TA::save::setSaveParameter("rings", getMaxRings());
+    TA::save::setSaveParameter(links.context, "rings", getMaxRings());
 }
 
-int TA_ObjectSet::getEmeraldsCount() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
-    int count = 0;
-    for(int item = 29; item <= 34; item++) {
-        if(itemMask & (1ll << item)) {
-            count++;
-        }
+void TA_ObjectSet::setPaused(bool enabled) {
+    if(paused == enabled) {
+        return;
+    }
+    paused = enabled;
+    for(TA_Object* currentObject : objects) {
+        currentObject->setPaused(paused);
+    }
+    for(TA_Object* currentObject : sleepingObjects) {
+        currentObject->setPaused(paused);
     }
-    return count;
 }
 
 bool TA_ObjectSet::isVisible(const TA_Rect& hitbox) {
-    TA_Point cameraPosition = links.camera->getPosition();
-    TA_Rect cameraRect;
-    cameraRect.setRectangle(
-        cameraPosition - TA_Point(5, 5), cameraPosition + TA_Point(TA::screenWidth + 5, TA::screenHeight + 5));
-    return cameraRect.intersects(hitbox);
+    return getCameraRect(5).intersects(hitbox);
 }
 
 bool TA_ObjectSet::enemyShouldDropRing() {
-    if(links.character != nullptr) {
-        for(int i = 0; i < 4; i++) {
-            if(TA::save::getSaveParameter("item_slot" + std::to_string(i)) == 9) {
-                return TA::random::next() % 2 == 0;
-            }
-        }
+    if(links.character != nullptr && links.level->fangEquipped) {
+        return TA::random::next(links.context) % 2 == 0;
     }
-    return TA::random::next() % 4 == 0;
+    return TA::random::next(links.context) % 4 == 0;
+}
+
+void TA_ObjectSet::setLinks(TA_Links newLinks) {
+    // objects read the level context through the links without checking it
+    if(newLinks.level == nullptr) {
+        TA::handleError("%s", "object set links have no level context");
+    }
+    links = newLinks;
+    particles.setLinks(newLinks);
+    projectiles.setLinks(newLinks);
+}
+
+std::vector<TA_ObjectState> TA_ObjectSet::getObjectStates() {
+    std::vector<TA_ObjectState> states;
+    auto add = [&](const std::vector<TA_Object*>& list) {
+        for(TA_Object* object : list) {
+            TA_Point topLeft = object->hitbox.getTopLeft(), bottomRight = object->hitbox.getBottomRight();
+            states.push_back({object->id, object->position.x, object->position.y, topLeft.x, topLeft.y, bottomRight.x,
+                bottomRight.y, object->collisionType});
+        }
+    };
+    add(objects);
+    add(sleepingObjects);
+    std::sort(states.begin(), states.end(),
+        [](const TA_ObjectState& first, const TA_ObjectState& second) { return first.id < second.id; });
+    return states;
 }
 
 TA_ObjectSet::~TA_ObjectSet() {
+    if(TA::arguments.contains("--debug")) {
+        TA::printLog("objects: peak active %i, sleeping %i", peakActiveObjects, getSleepingObjectsCount());
+    }
     for(TA_Object* currentObject : objects) {
         delete currentObject;
     }
+    for(TA_Object* currentObject : sleepingObjects) {
+        delete currentObject;
+    }
 }
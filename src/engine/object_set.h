@@ -1,12 +1,18 @@
 #ifndef TA_OBJECT_SET_H
 #define TA_OBJECT_SET_H
 
+#include <array>
+#include <memory>
 #include <toml.hpp>
 #include <vector>
 #include "character.h"
+#include "contact_sweep.h"
 #include "geometry.h"
 #include "hitbox_container.h"
+#include "level_context.h"
 #include "links.h"
+#include "particle_system.h"
+#include "projectile_manager.h"
 #include "screen.h"
 #include "tilemap.h"
 #include "tools.h"
@@ -18,8 +24,77 @@ enum TA_COLLISION_STATE {
     TA_COLLISION_ERROR = (1 << 3)
 };
 
+enum TA_ActivationPolicy {
+    TA_ACTIVATION_ALWAYS, // updated every frame
+    TA_ACTIVATION_NEAR_CAMERA, // sleeps while its wake region is away from the camera
+    TA_ACTIVATION_TRIGGER // sleeps until the character enters its wake region, then stays awake
+};
+
 class TA_ObjectSet;
 enum TA_BombMode : int;
+class TA_Object;
+
+struct TA_ObjectHitbox {
+    TA_Rect hitbox;
+    int collisionType;
+};
+
+struct TA_ObjectContact {
+    TA_Object* other; // nullptr for the character, its tools and projectiles
+    int flags;
+};
+
+// the part of an object two runs of the same level are compared by
+struct TA_ObjectState {
+    int id;
+    float x, y, left, top, right, bottom;
+    int collisionType;
+
+    bool operator==(const TA_ObjectState& rv) const = default;
+};
+
+// the part of an object the object set walks every frame, kept out of the object itself so it stays contiguous
+// every field has an array of its own, so the hitbox rebuild and the contact sweep don't load positions
+class TA_ObjectHotStore {
+private:
+    static constexpr int chunkSize = 256;
+
+    struct Chunk {
+        std::array<TA_Object*, chunkSize> objects{};
+        std::array<TA_Rect, chunkSize> hitboxes;
+        std::array<int, chunkSize> collisionTypes{};
+        std::array<std::vector<TA_ObjectHitbox>, chunkSize> hitboxVectors;
+        std::array<TA_Point, chunkSize> positions;
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int> freeSlots;
+
+    Chunk& getChunk(int slot) { return *chunks[slot / chunkSize]; }
+
+public:
+    int allocate(TA_Object* object);
+    void release(int slot);
+    int getCount() { return static_cast<int>((chunks.size() * chunkSize) - freeSlots.size()); }
+
+    TA_Point& getPosition(int slot) { return getChunk(slot).positions[slot % chunkSize]; }
+    TA_Rect& getHitbox(int slot) { return getChunk(slot).hitboxes[slot % chunkSize]; }
+    int& getCollisionType(int slot) { return getChunk(slot).collisionTypes[slot % chunkSize]; }
+    std::vector<TA_ObjectHitbox>& getHitboxVector(int slot) { return getChunk(slot).hitboxVectors[slot % chunkSize]; }
+
+    // calls function(object, hitbox, collisionType, hitboxVector) for every live object
+    template <typename Function>
+    void forEach(Function function) {
+        for(auto& chunk : chunks) {
+            for(int pos = 0; pos < chunkSize; pos++) {
+                if(chunk->objects[pos] != nullptr) {
+                    function(chunk->objects[pos], chunk->hitboxes[pos], chunk->collisionTypes[pos],
+                        chunk->hitboxVectors[pos]);
+                }
+            }
+        }
+    }
+};
 
 class TA_Object : public TA_Sprite {
     friend class TA_ObjectSet;
@@ -28,53 +103,145 @@ protected:
     virtual void updatePosition();
 
     TA_ObjectSet* objectSet;
-    TA_Point position;
-    TA_Rect hitbox;
-    int collisionType = TA_COLLISION_TRANSPARENT;
 
-    struct HitboxVectorElement {
-        TA_Rect hitbox;
-        int collisionType;
-    };
-    std::vector<HitboxVectorElement> hitboxVector;
+private:
+    int hotSlot;
+
+protected:
+    using HitboxVectorElement = TA_ObjectHitbox;
+
+    TA_Point& position;
+    TA_Rect& hitbox;
+    int& collisionType;
+    std::vector<HitboxVectorElement>& hitboxVector;
+
+    // what touched the object's hitboxes at the start of this frame, excluding the tilemap and the object itself
+    int getContactFlags() { return contactFlags; }
+    // the same contacts with one entry for each object that touched, other is only valid during this frame
+    const std::vector<TA_ObjectContact>& getContacts() { return contacts; }
+
+private:
+    std::vector<TA_ObjectContact> contacts;
+    TA_Rect wakeRect;
+    int id = 0, sleepingIndex = -1, contactFlags = 0, streamRecord = -1;
+    bool triggered = false;
 
 public:
     TA_Object(TA_ObjectSet* newObjectSet);
+    // runs for every active object before any update, on worker threads when update_threads is set
+    // it may read the level and call moveAndCollide, but only write the object's own state
+    // only rings move here so far, every other object still does all of its work in update() on the main thread
+    virtual void prepareUpdate() {}
     virtual bool update() { return false; }
     virtual bool checkCollision(TA_Rect rv) {
         return collisionType != TA_COLLISION_TRANSPARENT && hitbox.intersects(rv);
     }
     virtual int getDrawPriority() { return 0; }
+    virtual TA_ActivationPolicy getActivationPolicy() { return TA_ACTIVATION_ALWAYS; }
+    virtual float getWakeRadius() { return 64; }
+    virtual TA_Rect getActivationRect();
+    virtual bool isCullable() { return true; }
+    virtual TA_Rect getDrawRect();
+    // objects with more than one sprite stop the others' animations too
+    virtual void setPaused(bool paused) { setUpdateAnimation(!paused); }
     TA_Point getDistanceToCharacter();
     virtual void destroy() {}
-    virtual ~TA_Object() = default;
+    virtual ~TA_Object();
 };
 
 class TA_ObjectSet {
+    friend class TA_Object;
+
 private:
     void tryLoad(std::string filename);
     void loadObject(std::string name, toml::value object);
+    static TA_Point getObjectPosition(const toml::value& object);
 
+    static constexpr int activationCellSize = 256, prepareGrain = 32;
+    static constexpr float sleepMargin = 32;
+
+    // activation helpers
+    void updateActivation();
+    void updateDrawBuckets();
+    void putToSleep(TA_Object* object);
+    void wakeUp(TA_Object* object);
+    void removeSleeping(TA_Object* object);
+    TA_Rect getWakeRect(TA_Object* object);
+    TA_Rect getCameraRect(float margin);
+    std::vector<TA_Object*>& getActivationCell(int cellX, int cellY);
+    template <typename Function>
+    void forEachActivationCell(const TA_Rect& rect, Function function);
+
+    // streaming helpers, objects of a streamed level are kept as records until their region gets near the camera
+    // only objects stream, the tilemap, its collision and every record's toml stay loaded for the whole level
+    // objects that never sleep (TA_ACTIVATION_ALWAYS) live on after their region is released
+    static constexpr int streamRegionSize = 512;
+
+    struct StreamRecord {
+        std::string name;
+        toml::value object;
+        int region = 0;
+        TA_Object* spawned = nullptr;
+        bool gone = false;
+    };
+
+    void addStreamRecord(const std::string& name, const toml::value& object);
+    void spawnStreamRecord(int record);
+    void updateStreaming();
+
+    // contact owners below zero aren't objects, they only ever give contacts
+    static constexpr int projectileOwner = -1, characterOwner = -2;
+
+    // calls function(object, hitbox, collisionType, hitboxVector) for every live object
+    template <typename Function>
+    void forEachLiveObject(Function function);
+
+    void updateContacts();
+    void addContact(int owner, const TA_ContactSweep::Entry& other);
+    void prepareObjects();
+    void addCharacterContacts();
+
+    TA_ObjectHotStore hotStore;
+    bool hotStoreEnabled = true;
     std::vector<TA_Object*> objects, spawnedObjects, deleteList;
+    std::vector<TA_Object*> updatedObjects; // the next frame's objects, kept to reuse its capacity
+    std::vector<TA_Object*> sleepingObjects, wakeList;
+    std::array<std::vector<TA_Object*>, 3> drawBuckets;
+    bool drawBucketsUpdateNeeded = true;
+    std::vector<std::vector<TA_Object*>> activationCells;
+    std::vector<StreamRecord> streamRecords;
+    std::vector<std::vector<int>> streamRegions;
+    std::vector<bool> loadedRegions;
+    std::vector<int> strandedRecords; // records of released regions whose objects were still awake
+    int streamRegionsWidth = 0, streamRegionsHeight = 0;
+    float streamMargin = 0;
+    bool streaming = false;
+    int activationCellsWidth = 0, activationCellsHeight = 0;
+    int nextObjectId = 0, peakActiveObjects = 0;
     TA_Links links;
+    TA_ParticleSystem particles;
+    TA_ProjectileManager projectiles;
     TA_HitboxContainer hitboxContainer;
+    TA_ContactSweep contactSweep;
+    std::vector<TA_Object*> contactOwners;
+    long long contactCount = 0;
     TA_Point spawnPoint;
     TA_ScreenState transition = TA_SCREENSTATE_CURRENT;
     bool spawnFlip = false, firstSpawnPointSet = false;
-    bool paused = false;
-    bool night = false;
-    float waterLevel = -64;
+    bool paused = false, debugChecks = false, parallelUpdate = false;
 
-    // moveAndCollide helpers
-    void moveByX();
-    void moveByY();
-    void popOut(float area);
-    float getFirstGood(TA_Point add);
-    bool isGoodPosition(TA_Point position);
+    // moveAndCollide helpers, the state is per call so objects can move from worker threads
+    struct MoveState {
+        TA_Point position, topLeft, bottomRight, velocity, delta;
+        int solidFlags;
+        bool ground;
+    };
 
-    TA_Point position, topLeft, bottomRight, velocity, delta;
-    int solidFlags;
-    bool ground;
+    void moveByX(MoveState& state);
+    void moveByY(MoveState& state);
+    void popOut(MoveState& state, float area);
+    float getFirstGood(MoveState& state, TA_Point add);
+    bool isGoodPosition(MoveState& state, TA_Point position);
 
 public:
     ~TA_ObjectSet();
@@ -82,8 +249,10 @@ public:
     TA_Point getCharacterSpawnPoint() { return spawnPoint; }
     bool getCharacterSpawnFlip() { return spawnFlip; }
 
-    void setLinks(TA_Links newLinks) { links = newLinks; }
+    void setLinks(TA_Links newLinks);
     TA_Links getLinks() { return links; }
+    TA_ParticleSystem& getParticles() { return particles; }
+    TA_ProjectileManager& getProjectiles() { return projectiles; }
 
     void load(std::string filename);
     void update();
@@ -91,6 +260,7 @@ public:
 
     void checkCollision(TA_Rect& hitbox, int& flags);
     int checkCollision(TA_Rect& hitbox);
+    int getTargetCollisionFlags(const TA_Rect& hitbox);
     std::pair<TA_Point, int> moveAndCollide(TA_Point position, TA_Point topLeft, TA_Point bottomRight,
         TA_Point velocity, int solidFlags, bool ground = false);
     int getCollisionFlags(TA_Point position, TA_Point topLeft, TA_Point bottomRight, int solidFlags);
@@ -102,16 +272,23 @@ public:
         if(links.character) links.character->resetInstaShield();
     } // TODO: figure out what it is
     bool isPaused() { return paused; }
-    void setPaused(bool enabled) { paused = enabled; }
+    void setPaused(bool enabled);
     bool isVisible(const TA_Rect& hitbox);
 
-    int getEmeraldsCount();
+    int getEmeraldsCount() { return links.level->emeraldsCount; }
     int getMaxRings() { return 8 + 2 * getEmeraldsCount(); }
     void addRings(int count);
     void addRingsToMaximum();
-    bool isNight() { return night; }
-    void disableNight() { night = false; }
-    float getWaterLevel() { return waterLevel; }
+    bool isNight() { return links.level->night; }
+    void disableNight() { links.level->night = false; }
+    float getWaterLevel() { return links.level->waterLevel; }
+    int getActiveObjectsCount() { return static_cast<int>(objects.size()); }
+    int getSleepingObjectsCount() { return static_cast<int>(sleepingObjects.size()); }
+    bool isStreaming() { return streaming; }
+    // every live object in the order they were spawned, spawns of the current frame aren't there yet
+    std::vector<TA_ObjectState> getObjectStates();
+    // with the hot store off the per frame walks go through the object pointers instead, for benchmarking
+    void setHotStoreEnabled(bool enabled) { hotStoreEnabled = enabled; }
 
     template <class T, typename... P>
     void spawnObject(P... params) {
@@ -1,17 +1,18 @@
 #include "controller.h"
 #include "save.h"
 
-void TA_OnscreenController::load() {
-    sprites[TA_BUTTON_A].load("controls/a_button.png", 20, 22);
-    sprites[TA_BUTTON_B].load("controls/b_button.png", 20, 22);
-
-    arrowSprites[TA_DIRECTION_UP].load("controls/up_button.png", 18, 20);
-    arrowSprites[TA_DIRECTION_DOWN].load("controls/down_button.png", 18, 20);
-    arrowSprites[TA_DIRECTION_LEFT].load("controls/left_button.png", 18, 20);
-    arrowSprites[TA_DIRECTION_RIGHT].load("controls/right_button.png", 18, 20);
-
-    stickSprite.load("controls/stick.png");
-    pointerSprite.load("controls/pointer.png");
+void TA_OnscreenController::load(TA_Context* newContext) {
+    context = newContext;
+    sprites[TA_BUTTON_A].load(context, "controls/a_button.png", 20, 22);
+    sprites[TA_BUTTON_B].load(context, "controls/b_button.png", 20, 22);
+
+    arrowSprites[TA_DIRECTION_UP].load(context, "controls/up_button.png", 18, 20);
+    arrowSprites[TA_DIRECTION_DOWN].load(context, "controls/down_button.png", 18, 20);
+    arrowSprites[TA_DIRECTION_LEFT].load(context, "controls/left_button.png", 18, 20);
+    arrowSprites[TA_DIRECTION_RIGHT].load(context, "controls/right_button.png", 18, 20);
+
+    stickSprite.load(context, "controls/stick.png");
+    pointerSprite.load(context, "controls/pointer.png");
     setAlpha(200);
     updatePositions();
 }
@@ -37,7 +38,7 @@ void TA_OnscreenController::update() {
 }
 
 void TA_OnscreenController::draw() {
-    if(mode == TA_ONSCREEN_CONTROLLER_DISABLED) {
+    if(mode == TA_ONSCREEN_CONTROLLER_DISABLED || !context->renderingEnabled) {
         return;
     }
     if(TA::save::getParameter("hide_onscreen") == 1) {
@@ -64,7 +65,7 @@ void TA_OnscreenController::updateStick() {
     stick.update();
 
     if(stick.isPressed()) {
-        TA_Point center = TA_Point(35, TA::screenHeight - 37);
+        TA_Point center = TA_Point(35, context->screenHeight - 37);
         vector = stick.getTouchPosition() - center;
         vector.x /= stickSprite.getWidth() / 2;
         vector.y /= stickSprite.getHeight() / 2;
@@ -84,16 +85,16 @@ void TA_OnscreenController::updateStick() {
 }
 
 void TA_OnscreenController::updatePositions() {
-    setButtonPosition(TA_BUTTON_A, TA_Point(TA::screenWidth - 35, TA::screenHeight - 25));
-    setButtonPosition(TA_BUTTON_B, TA_Point(TA::screenWidth - 25, TA::screenHeight - 50));
+    setButtonPosition(TA_BUTTON_A, TA_Point(context->screenWidth - 35, context->screenHeight - 25));
+    setButtonPosition(TA_BUTTON_B, TA_Point(context->screenWidth - 25, context->screenHeight - 50));
 
     if(mode == TA_ONSCREEN_CONTROLLER_DPAD) {
-        setArrowButtonPosition(TA_DIRECTION_UP, TA_Point(40, TA::screenHeight - 55));
-        setArrowButtonPosition(TA_DIRECTION_DOWN, TA_Point(40, TA::screenHeight - 25));
-        setArrowButtonPosition(TA_DIRECTION_LEFT, TA_Point(25, TA::screenHeight - 40));
-        setArrowButtonPosition(TA_DIRECTION_RIGHT, TA_Point(55, TA::screenHeight - 40));
+        setArrowButtonPosition(TA_DIRECTION_UP, TA_Point(40, context->screenHeight - 55));
+        setArrowButtonPosition(TA_DIRECTION_DOWN, TA_Point(40, context->screenHeight - 25));
+        setArrowButtonPosition(TA_DIRECTION_LEFT, TA_Point(25, context->screenHeight - 40));
+        setArrowButtonPosition(TA_DIRECTION_RIGHT, TA_Point(55, context->screenHeight - 40));
     } else {
-        TA_Point center = TA_Point(35, TA::screenHeight - 37);
+        TA_Point center = TA_Point(35, context->screenHeight - 37);
         stickSprite.setPosition(center - TA_Point(stickSprite.getWidth() / 2, stickSprite.getHeight() / 2));
         stick.setCircle({center, 60});
     }
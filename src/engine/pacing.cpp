@@ -0,0 +1,199 @@
+#include "pacing.h"
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+#include "SDL3/SDL.h"
+#include "error.h"
+#include "filesystem.h"
+#include "save.h"
+#include "tools.h"
+
+// frames are limited by sleeping until shortly before the deadline and spinning the rest, the spin margin follows the
+// oversleep the OS actually gives us
+
+namespace TA::pacing {
+    constexpr size_t historySize = 600;
+    constexpr Uint64 defaultPeriod = 1000000000 / 60;
+    constexpr Uint64 minSpin = 200000, maxSpin = 2000000;
+    constexpr std::array<Uint64, histogramBuckets - 1> histogramLimits{250000, 500000, 1000000, 2000000, 4000000};
+
+    Uint64 getRefreshPeriod();
+    Uint64 smooth(Uint64 frameTime);
+
+    std::array<Uint64, historySize> history{};
+    size_t historyPos = 0, historyCount = 0;
+    long long missed = 0;
+
+    Uint64 frameStart = 0, deadline = 0, period = defaultPeriod, limitPeriod = 0, spin = 1000000;
+    long long residual = 0;
+    int vsyncMode = 0;
+}
+
+void TA::pacing::init() {
+    setVSync(static_cast<int>(TA::save::getParameter("vsync")));
+    frameStart = deadline = SDL_GetTicksNS();
+}
+
+void TA::pacing::setVSync(int mode) {
+    if(!SDL_SetRenderVSync(TA::renderer, (mode == 2 ? -1 : mode)) && mode == 2) {
+        TA::printWarning("adaptive vsync is not supported, falling back to vsync: %s", SDL_GetError());
+        SDL_SetRenderVSync(TA::renderer, 1);
+        mode = 1;
+    }
+    vsyncMode = mode;
+    updatePeriod();
+}
+
+void TA::pacing::updatePeriod() {
+    Uint64 refreshPeriod = getRefreshPeriod();
+    long long limit = TA::save::getParameter("frame_limit");
+    limitPeriod = (limit > 0 ? 1000000000 / static_cast<Uint64>(limit) : refreshPeriod);
+
+    if(vsyncMode == 0) {
+        period = limitPeriod;
+    } else {
+        period = std::max(limitPeriod, refreshPeriod);
+        if(limitPeriod <= refreshPeriod) {
+            limitPeriod = 0;
+        }
+    }
+    residual = 0;
+}
+
+Uint64 TA::pacing::getRefreshPeriod() {
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(TA::window));
+    if(mode == nullptr || mode->refresh_rate <= 0) {
+        return defaultPeriod;
+    }
+    if(mode->refresh_rate_numerator > 0 && mode->refresh_rate_denominator > 0) {
+        return static_cast<Uint64>(mode->refresh_rate_denominator) * 1000000000 /
+               static_cast<Uint64>(mode->refresh_rate_numerator);
+    }
+    return static_cast<Uint64>(1e9 / mode->refresh_rate);
+}
+
+float TA::pacing::startFrame() {
+    Uint64 now = SDL_GetTicksNS();
+    Uint64 frameTime = now - frameStart;
+    frameStart = now;
+
+    history[historyPos] = frameTime;
+    historyPos = (historyPos + 1) % historySize;
+    historyCount = std::min(historyCount + 1, historySize);
+    if(frameTime > period * 3 / 2) {
+        missed++;
+    }
+
+    return static_cast<float>(smooth(frameTime)) / 1e9F * 60;
+}
+
+Uint64 TA::pacing::smooth(Uint64 frameTime) {
+    // snap to a whole number of periods when close, the remainder is carried so game time doesn't drift
+    long long time = static_cast<long long>(frameTime) + residual;
+    long long periods = std::max(1LL, (time + static_cast<long long>(period / 2)) / static_cast<long long>(period));
+    long long snapped = periods * static_cast<long long>(period);
+    if(std::llabs(time - snapped) > static_cast<long long>(period / 8)) {
+        residual = 0;
+        return frameTime;
+    }
+    residual = time - snapped;
+    return static_cast<Uint64>(snapped);
+}
+
+void TA::pacing::resetTimer() {
+    frameStart = deadline = SDL_GetTicksNS();
+    residual = 0;
+}
+
+void TA::pacing::waitForNextFrame() {
+    if(limitPeriod == 0) {
+        return;
+    }
+
+    Uint64 now = SDL_GetTicksNS();
+    deadline += limitPeriod;
+    if(deadline + limitPeriod < now) {
+        deadline = now;
+        return;
+    }
+    if(deadline <= now) {
+        return;
+    }
+
+    if(deadline - now > spin) {
+        Uint64 sleepTime = deadline - now - spin;
+        SDL_DelayNS(sleepTime);
+        Uint64 slept = SDL_GetTicksNS() - now;
+        Uint64 oversleep = (slept > sleepTime ? slept - sleepTime : 0);
+        spin = std::clamp((spin * 7 + oversleep * 2) / 8, minSpin, maxSpin);
+    }
+    while(SDL_GetTicksNS() < deadline) {
+        SDL_CPUPauseInstruction();
+    }
+}
+
+TA::pacing::Stats TA::pacing::getStats() {
+    Stats stats;
+    stats.frames = static_cast<long long>(historyCount);
+    stats.periodUs = static_cast<long long>(period / 1000);
+    stats.missed = missed;
+    if(historyCount == 0) {
+        return stats;
+    }
+
+    std::vector<Uint64> sorted(history.begin(), history.begin() + static_cast<long>(historyCount));
+    std::sort(sorted.begin(), sorted.end());
+    auto getPercentile = [&](int percent) {
+        return static_cast<long long>(sorted[(sorted.size() - 1) * percent / 100] / 1000);
+    };
+    stats.p50Us = getPercentile(50);
+    stats.p95Us = getPercentile(95);
+    stats.p99Us = getPercentile(99);
+    stats.maxUs = static_cast<long long>(sorted.back() / 1000);
+
+    for(Uint64 frameTime : sorted) {
+        Uint64 jitter = (frameTime > period ? frameTime - period : period - frameTime);
+        int bucket = 0;
+        while(bucket < histogramBuckets - 1 && jitter >= histogramLimits[bucket]) {
+            bucket++;
+        }
+        stats.histogram[bucket]++;
+    }
+    return stats;
+}
+
+const char* TA::pacing::getHistogramLabel(int bucket) {
+    switch(bucket) {
+        case 0:
+            return "<0.25ms";
+        case 1:
+            return "<0.5ms";
+        case 2:
+            return "<1ms";
+        case 3:
+            return "<2ms";
+        case 4:
+            return "<4ms";
+        default:
+            return ">=4ms";
+    }
+}
+
+void TA::pacing::dump(const std::filesystem::path& path) {
+    Stats stats = getStats();
+    std::stringstream output;
+    output << "vsync " << vsyncMode << "\nperiod_us " << stats.periodUs << "\nframes " << stats.frames << "\nmissed "
+           << stats.missed << "\np50_us " << stats.p50Us << "\np95_us " << stats.p95Us << "\np99_us " << stats.p99Us
+           << "\nmax_us " << stats.maxUs << "\n\njitter\n";
+    for(int bucket = 0; bucket < histogramBuckets; bucket++) {
+        output << getHistogramLabel(bucket) << ' ' << stats.histogram[bucket] << '\n';
+    }
+
+    output << "\nframe_times_us\n";
+    for(size_t pos = 0; pos < historyCount; pos++) {
+        output << history[(historyPos + historySize - historyCount + pos) % historySize] / 1000 << '\n';
+    }
+    TA::filesystem::writeFile(path, output.str());
+    TA::printLog("frame times written to %s", path.string().c_str());
+}
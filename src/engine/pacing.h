@@ -0,0 +1,27 @@
+#ifndef TA_PACING_H
+#define TA_PACING_H
+
+#include <array>
+#include <filesystem>
+
+namespace TA::pacing {
+    constexpr int histogramBuckets = 6;
+
+    struct Stats {
+        long long frames = 0, periodUs = 0, p50Us = 0, p95Us = 0, p99Us = 0, maxUs = 0, missed = 0;
+        std::array<long long, histogramBuckets> histogram{};
+    };
+
+    void init();
+    void setVSync(int mode);
+    void updatePeriod();
+    float startFrame();
+    void resetTimer();
+    void waitForNextFrame();
+
+    Stats getStats();
+    const char* getHistogramLabel(int bucket);
+    void dump(const std::filesystem::path& path);
+}
+
+#endif // TA_PACING_H
@@ -0,0 +1,150 @@
+#include "particle_system.h"
+#include <algorithm>
+#include <cmath>
+#include "tools.h"
+
+void TA_ParticleEmitter::load(TA_Context* newContext, const std::filesystem::path& path,
+    const std::string& animationName, float newLifetime, int newDrawPriority, bool newScreenSpace) {
+    if(path.extension() == ".toml") {
+        loadFromToml(newContext, path);
+        setAnimation(animationName);
+    } else {
+        TA_Sprite::load(newContext, path.string());
+    }
+
+    const TA_Animation& animation = getCurrentAnimation();
+    lifetime = newLifetime;
+    if(lifetime < 0) {
+        int frames = static_cast<int>(animation.frames.size());
+        lifetime = static_cast<float>(animation.delay * frames * std::max(1, animation.repeatTimes));
+    }
+    drawPriority = newDrawPriority;
+    screenSpace = newScreenSpace;
+}
+
+void TA_ParticleEmitter::spawn(TA_Point position, TA_Point velocity, TA_Point delta, float newDelay) {
+    x.push_back(position.x);
+    y.push_back(position.y);
+    velocityX.push_back(velocity.x);
+    velocityY.push_back(velocity.y);
+    deltaX.push_back(delta.x);
+    deltaY.push_back(delta.y);
+    delay.push_back(newDelay);
+    timer.push_back(0);
+    frame.push_back(getAnimationFrameAt(0));
+}
+
+void TA_ParticleEmitter::update() {
+    const size_t count = x.size();
+    const float elapsedTime = context->elapsedTime;
+
+    // a particle waits out its delay before it starts moving and aging, written without branches so it vectorizes
+    for(size_t pos = 0; pos < count; pos++) {
+        float active = (delay[pos] < 0 ? 1.0F : 0.0F);
+        float step = elapsedTime * active;
+        velocityX[pos] += deltaX[pos] * step;
+        velocityY[pos] += deltaY[pos] * step;
+        x[pos] += velocityX[pos] * step;
+        y[pos] += velocityY[pos] * step;
+        timer[pos] += step;
+        delay[pos] -= elapsedTime - step;
+    }
+
+    size_t alive = 0;
+    for(size_t pos = 0; pos < count; pos++) {
+        if(timer[pos] >= lifetime) {
+            continue;
+        }
+        x[alive] = x[pos];
+        y[alive] = y[pos];
+        velocityX[alive] = velocityX[pos];
+        velocityY[alive] = velocityY[pos];
+        deltaX[alive] = deltaX[pos];
+        deltaY[alive] = deltaY[pos];
+        delay[alive] = delay[pos];
+        timer[alive] = timer[pos];
+        frame[alive] = getAnimationFrameAt(timer[pos]);
+        alive++;
+    }
+
+    for(auto* array : {&x, &y, &velocityX, &velocityY, &deltaX, &deltaY, &delay, &timer}) {
+        array->resize(alive);
+    }
+    frame.resize(alive);
+}
+
+void TA_ParticleEmitter::drawParticles(TA_Camera* camera) {
+    if(x.empty()) {
+        return;
+    }
+    begin(screenSpace ? nullptr : camera);
+    for(size_t pos = 0; pos < x.size(); pos++) {
+        add({x[pos], y[pos]}, frame[pos]);
+    }
+    end();
+}
+
+TA_ParticleEmitter& TA_ParticleSystem::getEmitter(const std::filesystem::path& path, const std::string& animationName,
+    float lifetime, int drawPriority, bool screenSpace) {
+    std::string key = path.generic_string() + ":" + animationName;
+    auto iterator = emitterMap.find(key);
+    if(iterator != emitterMap.end()) {
+        return *iterator->second;
+    }
+
+    emitters.push_back(std::make_unique<TA_ParticleEmitter>());
+    emitters.back()->load(links.context, path, animationName, lifetime, drawPriority, screenSpace);
+    emitterMap[key] = emitters.back().get();
+    return *emitters.back();
+}
+
+void TA_ParticleSystem::update() {
+    for(auto& emitter : emitters) {
+        emitter->update();
+    }
+}
+
+void TA_ParticleSystem::draw(int priority) {
+    for(auto& emitter : emitters) {
+        if(emitter->getDrawPriority() == priority) {
+            emitter->drawParticles(links.camera);
+        }
+    }
+}
+
+int TA_ParticleSystem::getCount() {
+    int count = 0;
+    for(auto& emitter : emitters) {
+        count += emitter->getCount();
+    }
+    return count;
+}
+
+void TA_ParticleSystem::spawnDebris(
+    const std::string& filename, TA_Point position, TA_Point velocity, TA_Point delta, float delay) {
+    getEmitter(filename, "", debrisLifetime, 0).spawn(position, velocity, delta, delay);
+}
+
+void TA_ParticleSystem::spawnSplash(TA_Point position) {
+    // snap to the water surface, which sits a bit lower in the sea fox levels
+    int top = static_cast<int>((position.y + 6) / 16) * 16 - 6;
+    int bottom = top + 16;
+    if(links.seaFox != nullptr) {
+        top += 3;
+        bottom += 3;
+    }
+    if(std::abs(position.y - static_cast<float>(top)) < std::abs(position.y - static_cast<float>(bottom))) {
+        position.y = static_cast<float>(top);
+    } else {
+        position.y = static_cast<float>(bottom);
+    }
+    getEmitter("objects/splash.toml", "splash", -1, 1).spawn(position, {0, 0}, {0, 0}, -1);
+}
+
+void TA_ParticleSystem::spawnSparkle(TA_Point position) {
+    getEmitter("objects/sparkle.toml", "sparkle", -1, 1).spawn(position, {0, 0}, {0, 0}, -1);
+}
+
+void TA_ParticleSystem::spawnLeaf(TA_Point position, TA_Point velocity, const std::string& animation) {
+    getEmitter("objects/leaf.toml", animation, leafLifetime, 0, true).spawn(position, velocity, {0, 0}, -1);
+}
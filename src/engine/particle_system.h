@@ -0,0 +1,55 @@
+#ifndef TA_PARTICLE_SYSTEM_H
+#define TA_PARTICLE_SYSTEM_H
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "links.h"
+#include "sprite_batch.h"
+
+// particles of one sprite and animation, kept as parallel arrays so update is one pass over plain floats
+class TA_ParticleEmitter : public TA_SpriteBatch {
+public:
+    void load(TA_Context* newContext, const std::filesystem::path& path, const std::string& animationName,
+        float newLifetime, int newDrawPriority, bool newScreenSpace);
+    void spawn(TA_Point position, TA_Point velocity, TA_Point delta, float delay);
+    void update();
+    void drawParticles(TA_Camera* camera);
+    int getDrawPriority() { return drawPriority; }
+    int getCount() { return static_cast<int>(x.size()); }
+
+private:
+    std::vector<float> x, y, velocityX, velocityY, deltaX, deltaY, delay, timer;
+    std::vector<int> frame;
+    float lifetime = 0;
+    int drawPriority = 0;
+    bool screenSpace = false;
+};
+
+class TA_ParticleSystem {
+private:
+    static constexpr float debrisLifetime = 300, leafLifetime = 200;
+
+    TA_ParticleEmitter& getEmitter(const std::filesystem::path& path, const std::string& animationName, float lifetime,
+        int drawPriority, bool screenSpace = false);
+
+    std::vector<std::unique_ptr<TA_ParticleEmitter>> emitters;
+    std::unordered_map<std::string, TA_ParticleEmitter*> emitterMap;
+    TA_Links links;
+
+public:
+    void setLinks(TA_Links newLinks) { links = newLinks; }
+    void update();
+    void draw(int priority);
+    int getCount();
+
+    void spawnDebris(
+        const std::string& filename, TA_Point position, TA_Point velocity, TA_Point delta, float delay = 0);
+    void spawnSplash(TA_Point position);
+    void spawnSparkle(TA_Point position);
+    void spawnLeaf(TA_Point position, TA_Point velocity, const std::string& animation);
+};
+
+#endif // TA_PARTICLE_SYSTEM_H
@@ -0,0 +1,41 @@
+#include "profiler.h"
+#include <array>
+
+namespace TA::profiler {
+    std::array<long long, TA_COUNTER_MAX> counters{};
+}
+
+void TA::profiler::setCounter(TA_ProfilerCounter counter, long long value) {
+    counters[counter] = value;
+}
+
+void TA::profiler::addCounter(TA_ProfilerCounter counter, long long value) {
+    counters[counter] += value;
+}
+
+long long TA::profiler::getCounter(TA_ProfilerCounter counter) {
+    return counters[counter];
+}
+
+const char* TA::profiler::getCounterName(TA_ProfilerCounter counter) {
+    switch(counter) {
+        case TA_COUNTER_ACTIVE_OBJECTS:
+            return "active";
+        case TA_COUNTER_SLEEPING_OBJECTS:
+            return "asleep";
+        case TA_COUNTER_PARTICLES:
+            return "particles";
+        case TA_COUNTER_CONTACTS:
+            return "contacts";
+        case TA_COUNTER_MUSIC_SAVED:
+            return "music saved";
+        case TA_COUNTER_AUDIO_LATENCY:
+            return "est. latency us";
+        case TA_COUNTER_INPUT_LATENCY:
+            return "input us";
+        case TA_COUNTER_DRAW_CALLS:
+            return "draws";
+        default:
+            return "";
+    }
+}
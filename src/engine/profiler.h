@@ -0,0 +1,23 @@
+#ifndef TA_PROFILER_H
+#define TA_PROFILER_H
+
+enum TA_ProfilerCounter {
+    TA_COUNTER_ACTIVE_OBJECTS,
+    TA_COUNTER_SLEEPING_OBJECTS,
+    TA_COUNTER_PARTICLES,
+    TA_COUNTER_CONTACTS,
+    TA_COUNTER_MUSIC_SAVED,
+    TA_COUNTER_AUDIO_LATENCY, // estimated from buffer sizes
+    TA_COUNTER_INPUT_LATENCY,
+    TA_COUNTER_DRAW_CALLS,
+    TA_COUNTER_MAX
+};
+
+namespace TA::profiler {
+    void setCounter(TA_ProfilerCounter counter, long long value);
+    void addCounter(TA_ProfilerCounter counter, long long value);
+    long long getCounter(TA_ProfilerCounter counter);
+    const char* getCounterName(TA_ProfilerCounter counter);
+}
+
+#endif // TA_PROFILER_H
@@ -0,0 +1,195 @@
+#include "projectile_manager.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "explosion.h"
+#include "object_set.h"
+#include "tilemap.h"
+#include "tools.h"
+
+void TA_ProjectileManager::loadType(TA_ProjectileType projectileType) {
+    Type& current = types[projectileType];
+    current.explosionType = TA_EXPLOSION_ENEMY;
+    switch(projectileType) {
+        case TA_PROJECTILE_VULCAN_GUN:
+            current.loadFromToml(links.context, "objects/vulcan_gun_bullet.toml");
+            current.setAnimation("bullet");
+            current.explosionSound.load("sound/explosion_small.ogg", TA_SOUND_CHANNEL_SFX2);
+            current.explosionOffset = {5, 5};
+            current.explosionType = TA_EXPLOSION_CHARACTER;
+            current.existTime = 15;
+            current.solidFlags = TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_TARGET;
+            current.collisionType = TA_COLLISION_ATTACK;
+            break;
+        case TA_PROJECTILE_SNIPER:
+            current.loadFromToml(links.context, "objects/sniper_bullet.toml");
+            current.explosionOffset = {5, 6};
+            current.explodeOnCharacterOnly = true;
+            break;
+        case TA_PROJECTILE_HEAVY_GUN:
+            current.loadFromToml(links.context, "objects/heavy_gun_bullet.toml");
+            current.explosionOffset = {5, 6};
+            current.explodeOnCharacterOnly = true;
+            break;
+        case TA_PROJECTILE_PILOT:
+            current.loadFromToml(links.context, "objects/pilot_bullet.toml");
+            current.setAnimation("bullet");
+            current.explosionOffset = {4, 4};
+            current.explodeOnCharacterOnly = true;
+            break;
+        case TA_PROJECTILE_DR_FUKUROKOV_LAZER:
+            current.loadFromToml(links.context, "objects/dr_fukurokov/lazer.toml");
+            current.explosionOffset = {7, 0};
+            break;
+        case TA_PROJECTILE_MECHA_GOLEM:
+            current.loadFromToml(links.context, "objects/mecha_golem/bullet.toml");
+            current.setAnimation("bullet");
+            current.explosionSound.load("sound/explosion_small.ogg", TA_SOUND_CHANNEL_SFX3);
+            current.explosionOffset = {7, 0};
+            current.solidFlags = TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_CHARACTER;
+            break;
+        default:
+            TA::handleError("unknown projectile type %i", projectileType);
+    }
+    current.loaded = true;
+}
+
+void TA_ProjectileManager::spawn(TA_ProjectileType projectileType, TA_Point position, TA_Point velocity) {
+    if(!types[projectileType].loaded) {
+        loadType(projectileType);
+    }
+    spawned.push_back({projectileType, position, velocity});
+}
+
+TA_Rect TA_ProjectileManager::getHitbox(size_t pos) {
+    TA_Point position{x[pos], y[pos]};
+    Type& current = types[type[pos]];
+    return {position, position + TA_Point(current.getWidth(), current.getHeight())};
+}
+
+void TA_ProjectileManager::addHitboxes(TA_HitboxContainer& hitboxContainer) {
+    forEachHitbox([&](const TA_Rect& hitbox, int collisionType) { hitboxContainer.add(hitbox, collisionType); });
+}
+
+void TA_ProjectileManager::update() {
+    size_t alive = 0;
+    for(size_t pos = 0; pos < x.size(); pos++) {
+        Type& current = types[type[pos]];
+        timer[pos] += links.context->elapsedTime;
+        if(current.existTime >= 0 && timer[pos] > current.existTime) {
+            continue;
+        }
+
+        TA_Rect start = getHitbox(pos);
+        TA_Point motion{velocityX[pos] * links.context->elapsedTime, velocityY[pos] * links.context->elapsedTime};
+        int flags = 0;
+        float time = sweep(start, motion, current.solidFlags, flags);
+        x[pos] += motion.x * time;
+        y[pos] += motion.y * time;
+
+        TA_Rect end = getHitbox(pos);
+        TA_Point sweptTopLeft{std::min(start.getTopLeft().x, end.getTopLeft().x),
+            std::min(start.getTopLeft().y, end.getTopLeft().y)};
+        TA_Point sweptBottomRight{std::max(start.getBottomRight().x, end.getBottomRight().x),
+            std::max(start.getBottomRight().y, end.getBottomRight().y)};
+        TA_Rect swept{sweptTopLeft, sweptBottomRight};
+        flags |= links.objectSet->getTargetCollisionFlags(swept);
+        if((flags & current.solidFlags) != 0) {
+            destroy(pos, flags);
+            continue;
+        }
+
+        x[alive] = x[pos];
+        y[alive] = y[pos];
+        velocityX[alive] = velocityX[pos];
+        velocityY[alive] = velocityY[pos];
+        timer[alive] = timer[pos];
+        type[alive] = type[pos];
+        alive++;
+    }
+
+    for(auto* array : {&x, &y, &velocityX, &velocityY, &timer}) {
+        array->resize(alive);
+    }
+    type.resize(alive);
+
+    // like spawned objects, new projectiles join on the next frame
+    for(const Spawn& spawn : spawned) {
+        x.push_back(spawn.position.x);
+        y.push_back(spawn.position.y);
+        velocityX.push_back(spawn.velocity.x);
+        velocityY.push_back(spawn.velocity.y);
+        timer.push_back(0);
+        type.push_back(spawn.type);
+    }
+    spawned.clear();
+}
+
+float TA_ProjectileManager::sweep(const TA_Rect& hitbox, TA_Point motion, int solidFlags, int& flags) {
+    if(links.tilemap == nullptr) {
+        return 1;
+    }
+
+    // DDA over a grid no coarser than a tile or the hitbox itself, consecutive checks overlap so nothing is skipped
+    const TA_Point topLeft = hitbox.getTopLeft(), bottomRight = hitbox.getBottomRight();
+    auto getAxis = [](float lead, float delta, float cellSize, float& next, float& step) {
+        if(TA::equal(delta, 0)) {
+            next = step = std::numeric_limits<float>::infinity();
+            return;
+        }
+        float boundary = (delta > 0 ? (std::floor(lead / cellSize) + 1) * cellSize
+                                    : (std::ceil(lead / cellSize) - 1) * cellSize);
+        step = cellSize / std::abs(delta);
+        next = std::abs(boundary - lead) / std::abs(delta);
+    };
+
+    float nextX, stepX, nextY, stepY;
+    float cellWidth = std::clamp(bottomRight.x - topLeft.x, 1.0F, static_cast<float>(links.tilemap->getTileWidth()));
+    float cellHeight = std::clamp(bottomRight.y - topLeft.y, 1.0F, static_cast<float>(links.tilemap->getTileHeight()));
+    getAxis((motion.x > 0 ? bottomRight.x : topLeft.x), motion.x, cellWidth, nextX, stepX);
+    getAxis((motion.y > 0 ? bottomRight.y : topLeft.y), motion.y, cellHeight, nextY, stepY);
+
+    while(true) {
+        float time = std::min({nextX, nextY, 1.0F});
+        flags = links.tilemap->checkCollision(TA_Rect(topLeft + motion * time, bottomRight + motion * time));
+        if((flags & solidFlags) != 0 || time >= 1) {
+            return time;
+        }
+        if(nextX <= time) {
+            nextX += stepX;
+        }
+        if(nextY <= time) {
+            nextY += stepY;
+        }
+    }
+}
+
+void TA_ProjectileManager::destroy(size_t pos, int flags) {
+    Type& current = types[type[pos]];
+    if(current.explodeOnCharacterOnly && (flags & TA_COLLISION_CHARACTER) == 0) {
+        return;
+    }
+    links.objectSet->spawnObject<TA_Explosion>(
+        TA_Point(x[pos], y[pos]) - current.explosionOffset, 0, static_cast<TA_ExplosionType>(current.explosionType));
+    if(!current.explosionSound.empty()) {
+        current.explosionSound.play();
+    }
+}
+
+void TA_ProjectileManager::draw(int priority) {
+    if(priority != drawPriority || x.empty()) {
+        return;
+    }
+    for(int current = 0; current < TA_PROJECTILE_MAX; current++) {
+        if(!types[current].loaded) {
+            continue;
+        }
+        types[current].begin(links.camera);
+        for(size_t pos = 0; pos < x.size(); pos++) {
+            if(type[pos] == current) {
+                types[current].add({x[pos], y[pos]}, types[current].getAnimationFrameAt(timer[pos]));
+            }
+        }
+        types[current].end();
+    }
+}
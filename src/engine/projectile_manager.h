@@ -0,0 +1,69 @@
+#ifndef TA_PROJECTILE_MANAGER_H
+#define TA_PROJECTILE_MANAGER_H
+
+#include <array>
+#include <vector>
+#include "geometry.h"
+#include "hitbox_container.h"
+#include "links.h"
+#include "sound.h"
+#include "sprite_batch.h"
+
+enum TA_ProjectileType {
+    TA_PROJECTILE_VULCAN_GUN,
+    TA_PROJECTILE_SNIPER,
+    TA_PROJECTILE_HEAVY_GUN,
+    TA_PROJECTILE_PILOT,
+    TA_PROJECTILE_DR_FUKUROKOV_LAZER,
+    TA_PROJECTILE_MECHA_GOLEM,
+    TA_PROJECTILE_MAX
+};
+
+// all straight-flying bullets in flat arrays, moved by sweeping the hitbox through the collision grid so fast bullets
+// can't skip thin tiles, then checked against targets with one query over the swept area
+class TA_ProjectileManager {
+private:
+    class Type : public TA_SpriteBatch {
+    public:
+        TA_Sound explosionSound;
+        TA_Point explosionOffset;
+        float existTime = -1;
+        int solidFlags = TA_COLLISION_SOLID | TA_COLLISION_CHARACTER, collisionType = TA_COLLISION_DAMAGE;
+        int explosionType = 0;
+        bool explodeOnCharacterOnly = false, loaded = false;
+    };
+
+    struct Spawn {
+        TA_ProjectileType type;
+        TA_Point position, velocity;
+    };
+
+    static constexpr int drawPriority = 1;
+
+    void loadType(TA_ProjectileType type);
+    float sweep(const TA_Rect& hitbox, TA_Point motion, int solidFlags, int& flags);
+    void destroy(size_t pos, int flags);
+    TA_Rect getHitbox(size_t pos);
+
+    std::array<Type, TA_PROJECTILE_MAX> types;
+    std::vector<float> x, y, velocityX, velocityY, timer;
+    std::vector<TA_ProjectileType> type;
+    std::vector<Spawn> spawned;
+    TA_Links links;
+
+public:
+    void setLinks(TA_Links newLinks) { links = newLinks; }
+    void spawn(TA_ProjectileType type, TA_Point position, TA_Point velocity);
+    void addHitboxes(TA_HitboxContainer& hitboxContainer);
+    template <typename Function>
+    void forEachHitbox(Function function) {
+        for(size_t pos = 0; pos < x.size(); pos++) {
+            function(getHitbox(pos), types[type[pos]].collisionType);
+        }
+    }
+    void update();
+    void draw(int priority);
+    int getCount() { return static_cast<int>(x.size()); }
+};
+
+#endif // TA_PROJECTILE_MANAGER_H
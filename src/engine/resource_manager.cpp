@@ -1,6 +1,8 @@
 #include "resource_manager.h"
+#include <mutex>
 #include <unordered_map>
 #include "SDL3_image/SDL_image.h"
+#include "cpu_renderer.h"
 #include "error.h"
 #include "filesystem.h"
 #include "tools.h"
@@ -20,6 +22,10 @@ namespace TA::resmgr {
     void preloadTextures();
     void preloadChunks();
 
+    // preloads are spread over the first frames so the title screen doesn't wait for them
+    std::vector<std::filesystem::path> preloadQueue;
+    size_t preloadPosition = 0;
+
     std::unordered_map<std::string, std::filesystem::path> overrides;
     int totalMods = 0;
     int loadedMods = 0;
@@ -29,6 +35,10 @@ namespace TA::resmgr {
     std::unordered_map<std::string, Mix_Chunk*> chunkMap;
     std::unordered_map<std::string, std::string> assetMap;
     std::unordered_map<std::string, toml::value> tomlMap;
+
+    // caches are shared by every context, entries never move once added so returned references stay valid
+    // textures still have to be created on the main thread, before other threads look them up
+    std::mutex cacheMutex;
 }
 
 void TA::resmgr::load() {
@@ -37,6 +47,19 @@ void TA::resmgr::load() {
     preloadChunks();
 }
 
+bool TA::resmgr::updatePreload(Uint64 budgetNS) {
+    Uint64 start = SDL_GetTicksNS();
+    while(preloadPosition < preloadQueue.size() && SDL_GetTicksNS() - start < budgetNS) {
+        const std::filesystem::path& path = preloadQueue[preloadPosition++];
+        if(path.extension() == ".png") {
+            loadTexture(path);
+        } else {
+            loadChunk(path);
+        }
+    }
+    return preloadPosition >= preloadQueue.size();
+}
+
 void TA::resmgr::loadMods() {
 #ifdef __ANDROID__
     if(SDL_GetAndroidExternalStorageState() !=
@@ -121,7 +144,7 @@ void TA::resmgr::preloadTextures() {
         "rock", "splash", "walker_bullet"};
 
     for(std::string name : names) {
-        loadTexture("objects/" + name + ".png");
+        preloadQueue.push_back("objects/" + name + ".png");
     }
 }
 
@@ -131,11 +154,12 @@ void TA::resmgr::preloadChunks() {
         "select", "shoot", "switch", "teleport"};
 
     for(std::string name : names) {
-        loadChunk("sound/" + name + ".ogg");
+        preloadQueue.push_back("sound/" + name + ".ogg");
     }
 }
 
 SDL_Texture* TA::resmgr::loadTexture(std::filesystem::path path) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
     path = getAssetPath(path);
 
     if(!textureMap.count(path.generic_string())) {
@@ -144,12 +168,19 @@ SDL_Texture* TA::resmgr::loadTexture(std::filesystem::path path) {
         if(surface == nullptr) {
             TA::handleSDLError("%s", "failed to load image");
         }
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(TA::renderer, surface);
+        // the cpu renderer keeps its own (usually indexed) copy, so the texture only names the image there
+        SDL_Texture* texture = nullptr;
+        if(TA::cpuRenderer::isEnabled()) {
+            texture = SDL_CreateTexture(TA::renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        } else {
+            texture = SDL_CreateTextureFromSurface(TA::renderer, surface);
+        }
         if(texture == nullptr) {
             TA::handleSDLError("%s", "failed to create texture from surface");
         }
         SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
         SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+        TA::cpuRenderer::registerTexture(texture, surface);
         textureMap[path.generic_string()] = texture;
         SDL_DestroySurface(surface);
     }
@@ -158,6 +189,7 @@ SDL_Texture* TA::resmgr::loadTexture(std::filesystem::path path) {
 }
 
 Mix_Music* TA::resmgr::loadMusic(std::filesystem::path path) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
     path = getAssetPath(path);
 
     if(!musicMap.count(path.generic_string())) {
@@ -172,6 +204,7 @@ Mix_Music* TA::resmgr::loadMusic(std::filesystem::path path) {
 }
 
 Mix_Chunk* TA::resmgr::loadChunk(std::filesystem::path path) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
     path = getAssetPath(path);
 
     if(!chunkMap.contains(path.generic_string())) {
@@ -186,6 +219,7 @@ Mix_Chunk* TA::resmgr::loadChunk(std::filesystem::path path) {
 }
 
 const std::string& TA::resmgr::loadAsset(std::filesystem::path path) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
     path = getAssetPath(path);
     if(!assetMap.contains(path.generic_string())) {
         assetMap[path.generic_string()] = TA::filesystem::readFile(path);
@@ -194,6 +228,7 @@ const std::string& TA::resmgr::loadAsset(std::filesystem::path path) {
 }
 
 const toml::value& TA::resmgr::loadToml(std::filesystem::path path) {
+    std::lock_guard<std::mutex> lock(cacheMutex);
     path = getAssetPath(path);
     if(!tomlMap.contains(path.generic_string())) {
         try {
@@ -215,6 +250,7 @@ int TA::resmgr::getTotalMods() {
 
 void TA::resmgr::quit() {
     for(std::pair<std::string, SDL_Texture*> element : textureMap) {
+        TA::cpuRenderer::unregisterTexture(element.second);
         SDL_DestroyTexture(element.second);
     }
     for(std::pair<std::string, Mix_Music*> element : musicMap) {
@@ -223,4 +259,7 @@ void TA::resmgr::quit() {
     for(std::pair<std::string, Mix_Chunk*> element : chunkMap) {
         Mix_FreeChunk(element.second);
     }
+    textureMap.clear();
+    musicMap.clear();
+    chunkMap.clear();
 }
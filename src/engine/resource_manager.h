@@ -9,6 +9,8 @@
 namespace TA {
     namespace resmgr {
         void load();
+        // loads queued preloads until budgetNS runs out, returns true once the queue is empty
+        bool updatePreload(Uint64 budgetNS);
         SDL_Texture* loadTexture(std::filesystem::path path);
         Mix_Music* loadMusic(std::filesystem::path path);
         Mix_Chunk* loadChunk(std::filesystem::path path);
@@ -1,4 +1,6 @@
 #include "save.h"
+#include <algorithm>
+#include <array>
 #include <filesystem>
 #include <map>
 #include <sstream>
@@ -10,8 +12,20 @@ namespace TA {
     namespace save {
         void addOptionsFromFile(std::filesystem::path path);
         std::filesystem::path getSaveFileName();
-        std::map<std::string, long long> saveMap;
-        std::string currentSave = "";
+        long long getParameter(const TA_SaveMap& map, std::string_view name);
+        void setParameter(TA_SaveMap& map, std::string_view name, long long value);
+
+        // the game reads save parameters every frame, so keys are built on the stack instead of in a string
+        struct SaveKey {
+            std::array<char, 128> buffer;
+            size_t length = 0;
+
+            [[nodiscard]] std::string_view get() const { return {buffer.data(), length}; }
+        };
+
+        SaveKey getSaveKey(TA_Context* context, std::string_view name, std::string_view saveName);
+
+        TA_SaveMap config;
     }
 }
 
@@ -34,13 +48,13 @@ void TA::save::addOptionsFromFile(std::filesystem::path path) {
     std::string name;
     long long value;
     while(stream >> name >> value) {
-        saveMap[name] = value;
+        config[name] = value;
     }
 }
 
 void TA::save::writeToFile() {
     std::stringstream output;
-    for(auto [key, value] : saveMap) {
+    for(auto [key, value] : config) {
         output << key << ' ' << value << std::endl;
     }
 
@@ -68,40 +82,70 @@ std::filesystem::path TA::save::getSaveFileName() {
 #endif
 }
 
-long long TA::save::getParameter(std::string name) {
-    if(!saveMap.contains(name)) {
-        TA::handleError("unknown parameter %s", name.c_str());
-    }
-    return saveMap[name];
+std::filesystem::path TA::save::getDataDirectory() {
+    return getSaveFileName().parent_path();
+}
+
+TA_SaveMap& TA::save::getConfig() {
+    return config;
+}
+
+long long TA::save::getParameter(std::string_view name) {
+    return getParameter(config, name);
 }
 
-void TA::save::setParameter(std::string name, long long value) {
-    saveMap[name] = value;
+void TA::save::setParameter(std::string_view name, long long value) {
+    setParameter(config, name, value);
 }
 
-void TA::save::setCurrentSave(std::string name) {
-    currentSave = name;
+long long TA::save::getParameter(const TA_SaveMap& map, std::string_view name) {
+    auto iterator = map.find(name);
+    if(iterator == map.end()) {
+        TA::handleError("unknown parameter %s", std::string(name).c_str());
+    }
+    return iterator->second;
 }
 
-long long TA::save::getSaveParameter(std::string name, std::string saveName) {
-    if(saveName == "") {
-        saveName = currentSave;
+void TA::save::setParameter(TA_SaveMap& map, std::string_view name, long long value) {
+    auto iterator = map.find(name);
+    if(iterator == map.end()) {
+        map.emplace(name, value);
+    } else {
+        iterator->second = value;
     }
-    return getParameter(saveName + "/" + name);
 }
 
-void TA::save::setSaveParameter(std::string name, long long value, std::string saveName) {
-    if(saveName == "") {
-        saveName = currentSave;
+void TA::save::setCurrentSave(TA_Context* context, std::string name) {
+    context->currentSave = name;
+}
+
+long long TA::save::getSaveParameter(TA_Context* context, std::string_view name, std::string_view saveName) {
+    return getParameter(*context->saveMap, getSaveKey(context, name, saveName).get());
+}
+
+void TA::save::setSaveParameter(TA_Context* context, std::string_view name, long long value,
+    std::string_view saveName) {
+    setParameter(*context->saveMap, getSaveKey(context, name, saveName).get(), value);
+}
+
+TA::save::SaveKey TA::save::getSaveKey(TA_Context* context, std::string_view name, std::string_view saveName) {
+    std::string_view save = (saveName.empty() ? std::string_view(context->currentSave) : saveName);
+    SaveKey key;
+    if(save.size() + 1 + name.size() > key.buffer.size()) {
+        TA::handleError("save key %s/%s is too long", std::string(save).c_str(), std::string(name).c_str());
     }
-    setParameter(saveName + "/" + name, value);
+    auto end = std::copy(save.begin(), save.end(), key.buffer.begin());
+    *end = '/';
+    end = std::copy(name.begin(), name.end(), end + 1);
+    key.length = static_cast<size_t>(end - key.buffer.begin());
+    return key;
 }
 
-void TA::save::createSave(std::string saveName) {
-    std::map<std::string, long long> newSaveMap = saveMap;
+void TA::save::createSave(TA_Context* context, std::string saveName) {
+    auto newSaveMap = *context->saveMap;
     const std::string defaultSaveName = "default_save/";
 
-    for(auto item : saveMap) {
+    for(auto item : *context->saveMap) {
         if(item.first.length() >= defaultSaveName.length() &&
             item.first.substr(0, defaultSaveName.length()) == defaultSaveName) {
             std::string itemName =
@@ -111,14 +155,14 @@ void TA::save::createSave(std::string saveName) {
         }
     }
 
-    saveMap = newSaveMap;
+    *context->saveMap = newSaveMap;
 }
 
-void TA::save::repairSave(std::string saveName) {
-    std::map<std::string, long long> newSaveMap = saveMap;
+void TA::save::repairSave(TA_Context* context, std::string saveName) {
+    auto newSaveMap = *context->saveMap;
     const std::string defaultSaveName = "default_save/";
 
-    for(auto item : saveMap) {
+    for(auto item : *context->saveMap) {
         if(item.first.length() >= defaultSaveName.length() &&
             item.first.substr(0, defaultSaveName.length()) == defaultSaveName) {
             std::string itemName =
@@ -130,10 +174,10 @@ void TA::save::repairSave(std::string saveName) {
         }
     }
 
-    saveMap = newSaveMap;
+    *context->saveMap = newSaveMap;
 }
 
-bool TA::save::saveExists(int save) {
+bool TA::save::saveExists(TA_Context* context, int save) {
     std::string saveName = "save_" + std::to_string(save);
-    return saveMap.count(saveName + "/item_mask");
+    return context->saveMap->count(saveName + "/item_mask");
 }
@@ -1,20 +1,29 @@
 #ifndef TA_SAVE_H
 #define TA_SAVE_H
 
+#include <filesystem>
 #include <string>
+#include <string_view>
+#include "context.h"
 
 namespace TA {
     namespace save {
         void load();
         void writeToFile();
-        long long getParameter(std::string name);
-        void setParameter(std::string name, long long value);
-        void setCurrentSave(std::string name);
-        long long getSaveParameter(std::string name, std::string saveName = "");
-        void setSaveParameter(std::string name, long long value, std::string saveName = "");
-        void createSave(std::string saveName);
-        void repairSave(std::string saveName);
-        bool saveExists(int save);
+        // settings and saves as stored on disk, shared by the whole process
+        TA_SaveMap& getConfig();
+        long long getParameter(std::string_view name);
+        void setParameter(std::string_view name, long long value);
+
+        // saves are read and written through the save map of a context
+        void setCurrentSave(TA_Context* context, std::string name);
+        long long getSaveParameter(TA_Context* context, std::string_view name, std::string_view saveName = "");
+        void setSaveParameter(TA_Context* context, std::string_view name, long long value,
+            std::string_view saveName = "");
+        void createSave(TA_Context* context, std::string saveName);
+        void repairSave(TA_Context* context, std::string saveName);
+        bool saveExists(TA_Context* context, int save);
+        std::filesystem::path getDataDirectory();
     }
 }
 
@@ -1,7 +1,9 @@
 #ifndef TA_SCREEN_H
 #define TA_SCREEN_H
 
+#include <cstddef>
 #include <utility>
+#include "context.h"
 
 enum TA_ScreenState {
     TA_SCREENSTATE_CURRENT,
@@ -17,9 +19,21 @@ enum TA_ScreenState {
 };
 
 class TA_Screen {
+protected:
+    TA_Context* context = nullptr;
+
 public:
+    void setContext(TA_Context* newContext) { context = newContext; }
     virtual void init() {}
     virtual TA_ScreenState update() { return TA_SCREENSTATE_CURRENT; }
+    // called after update() on steps that are shown, screens without it draw from update()
+    virtual void draw() {}
+
+    // reusable screens are kept alive after being left and get resume() instead of init() on the next visit
+    // at most cached_screens of them are kept, the least recently left one goes first
+    virtual bool isReusable() { return false; }
+    virtual void resume() {}
+
     virtual void quit() {} // TODO: is this really needed?
     virtual ~TA_Screen() = default;
 };
@@ -1,4 +1,6 @@
 #include "screen_state_machine.h"
+#include <algorithm>
+#include <chrono>
 #include "devmenu_screen.h"
 #include "error.h"
 #include "game_over_screen.h"
@@ -10,7 +12,8 @@
 #include "save.h"
 #include "title_screen.h"
 
-void TA_ScreenStateMachine::init() {
+void TA_ScreenStateMachine::init(TA_Context* newContext) {
+    context = newContext;
     if(TA::arguments.count("--devmenu")) {
         currentState = TA_SCREENSTATE_DEVMENU;
         currentScreen = std::make_unique<TA_DevmenuScreen>();
@@ -20,11 +23,15 @@ void TA_ScreenStateMachine::init() {
     }
 
     neededState = TA_SCREENSTATE_CURRENT;
+    currentScreen->setContext(context);
     currentScreen->init();
 }
 
 bool TA_ScreenStateMachine::update() {
     TA_ScreenState returnedState = currentScreen->update();
+    if(context->renderingEnabled) {
+        currentScreen->draw();
+    }
     if(returnedState == TA_SCREENSTATE_QUIT) {
         returnedState = TA_SCREENSTATE_CURRENT;
         quitNeeded = true;
@@ -36,62 +43,120 @@ bool TA_ScreenStateMachine::update() {
     }
     if(neededState == TA_SCREENSTATE_CURRENT) {
         if(transitionTimer > 0) {
-            TA::drawShadow(255 * transitionTimer / transitionTime);
-            transitionTimer -= TA::elapsedTime;
+            TA::drawShadow(context, 255 * transitionTimer / transitionTime);
+            transitionTimer -= context->elapsedTime;
         }
         return false;
     }
 
     if(changeState) {
-        TA::drawShadow(255);
+        TA::drawShadow(context, 255);
         currentScreen->quit();
         TA::save::writeToFile();
 
-        switch(neededState) {
-            case TA_SCREENSTATE_INTRO:
-                currentScreen = std::make_unique<TA_IntroScreen>();
-                break;
-            case TA_SCREENSTATE_TITLE:
-                currentScreen = std::make_unique<TA_TitleScreen>();
-                break;
-            case TA_SCREENSTATE_GAME:
-                currentScreen = std::make_unique<TA_GameScreen>();
-                break;
-            case TA_SCREENSTATE_DEVMENU:
-                currentScreen = std::make_unique<TA_DevmenuScreen>();
-                break;
-            case TA_SCREENSTATE_MAP:
-                currentScreen = std::make_unique<TA_MapScreen>();
-                break;
-            case TA_SCREENSTATE_HOUSE:
-                currentScreen = std::make_unique<TA_HouseScreen>();
-                break;
-            case TA_SCREENSTATE_GAMEOVER:
-                currentScreen = std::make_unique<TA_GameOverScreen>();
-                break;
-            case TA_SCREENSTATE_MAIN_MENU:
-                currentScreen = std::make_unique<TA_MainMenuScreen>();
-                break;
-            default:
-                TA::handleError("%s", "invalid new screen state");
-                break;
+        auto startTime = std::chrono::high_resolution_clock::now();
+        if(currentScreen->isReusable()) {
+            cacheScreen(currentState, std::move(currentScreen));
+        }
+        currentScreen = takeCachedScreen(neededState);
+        bool resumed = (currentScreen != nullptr);
+        if(resumed) {
+            currentScreen->resume();
+        } else {
+            currentScreen = createScreen(neededState);
+            currentScreen->setContext(context);
+            currentScreen->init();
         }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double setupTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        TA::printLog("%s %s screen in %.2f ms", (resumed ? "resumed" : "created"), getStateName(neededState),
+            setupTime);
 
-        currentScreen->init();
         currentState = neededState;
         neededState = TA_SCREENSTATE_CURRENT;
         changeState = false;
         return true;
     }
 
-    transitionTimer = std::max(float(0), transitionTimer) + TA::elapsedTime;
-    TA::drawShadow(255 * transitionTimer / transitionTime);
+    transitionTimer = std::max(float(0), transitionTimer) + context->elapsedTime;
+    TA::drawShadow(context, 255 * transitionTimer / transitionTime);
     if(transitionTimer > transitionTime) {
         changeState = true;
     }
     return false;
 }
 
+std::unique_ptr<TA_Screen> TA_ScreenStateMachine::createScreen(TA_ScreenState state) {
+    switch(state) {
+        case TA_SCREENSTATE_INTRO:
+            return std::make_unique<TA_IntroScreen>();
+        case TA_SCREENSTATE_TITLE:
+            return std::make_unique<TA_TitleScreen>();
+        case TA_SCREENSTATE_GAME:
+            return std::make_unique<TA_GameScreen>();
+        case TA_SCREENSTATE_DEVMENU:
+            return std::make_unique<TA_DevmenuScreen>();
+        case TA_SCREENSTATE_MAP:
+            return std::make_unique<TA_MapScreen>();
+        case TA_SCREENSTATE_HOUSE:
+            return std::make_unique<TA_HouseScreen>();
+        case TA_SCREENSTATE_GAMEOVER:
+            return std::make_unique<TA_GameOverScreen>();
+        case TA_SCREENSTATE_MAIN_MENU:
+            return std::make_unique<TA_MainMenuScreen>();
+        default:
+            TA::handleError("%s", "invalid new screen state");
+            return nullptr;
+    }
+}
+
+std::unique_ptr<TA_Screen> TA_ScreenStateMachine::takeCachedScreen(TA_ScreenState state) {
+    for(auto iterator = screenCache.begin(); iterator != screenCache.end(); iterator++) {
+        if(iterator->state != state) {
+            continue;
+        }
+        // layouts are computed once in init, a screen built for another resolution is rebuilt
+        std::unique_ptr<TA_Screen> screen;
+        if(iterator->screenWidth == context->screenWidth && iterator->screenHeight == context->screenHeight) {
+            screen = std::move(iterator->screen);
+        }
+        screenCache.erase(iterator);
+        return screen;
+    }
+    return nullptr;
+}
+
+void TA_ScreenStateMachine::cacheScreen(TA_ScreenState state, std::unique_ptr<TA_Screen> screen) {
+    size_t limit = static_cast<size_t>(std::max(0LL, TA::save::getParameter("cached_screens")));
+    screenCache.push_back({state, std::move(screen), context->screenWidth, context->screenHeight});
+    while(screenCache.size() > limit) {
+        screenCache.erase(screenCache.begin());
+    }
+}
+
+const char* TA_ScreenStateMachine::getStateName(TA_ScreenState state) {
+    switch(state) {
+        case TA_SCREENSTATE_INTRO:
+            return "intro";
+        case TA_SCREENSTATE_TITLE:
+            return "title";
+        case TA_SCREENSTATE_GAME:
+            return "game";
+        case TA_SCREENSTATE_DEVMENU:
+            return "devmenu";
+        case TA_SCREENSTATE_MAP:
+            return "map";
+        case TA_SCREENSTATE_HOUSE:
+            return "house";
+        case TA_SCREENSTATE_GAMEOVER:
+            return "game over";
+        case TA_SCREENSTATE_MAIN_MENU:
+            return "main menu";
+        default:
+            return "unknown";
+    }
+}
+
 TA_ScreenStateMachine::~TA_ScreenStateMachine() {
     currentScreen->quit();
 }
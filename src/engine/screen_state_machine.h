@@ -2,19 +2,33 @@
 #define TA_SCREEN_STATE_MACHINE_H
 
 #include <memory>
+#include <vector>
 #include "screen.h"
 
 class TA_ScreenStateMachine {
 private:
+    struct CachedScreen {
+        TA_ScreenState state;
+        std::unique_ptr<TA_Screen> screen;
+        int screenWidth, screenHeight;
+    };
+
+    std::unique_ptr<TA_Screen> createScreen(TA_ScreenState state);
+    std::unique_ptr<TA_Screen> takeCachedScreen(TA_ScreenState state);
+    void cacheScreen(TA_ScreenState state, std::unique_ptr<TA_Screen> screen);
+    static const char* getStateName(TA_ScreenState state);
+
     TA_ScreenState currentState, neededState;
     std::unique_ptr<TA_Screen> currentScreen;
+    std::vector<CachedScreen> screenCache; // least recently left first
+    TA_Context* context = nullptr;
     float transitionTimer = 0;
     bool changeState = false, quitNeeded = false;
 
     const float transitionTime = 6;
 
 public:
-    void init();
+    void init(TA_Context* newContext);
     bool update();
     bool isQuitNeeded() { return quitNeeded; }
     ~TA_ScreenStateMachine();
@@ -1,25 +1,22 @@
 #include "sea_fox.h"
 #include "anti_air_missile.h"
-#include "bullet.h"
 #include "controller.h"
 #include "hud.h"
 #include "mine.h"
 #include "object_set.h"
 #include "ring.h"
 #include "save.h"
-#include "sparkle.h"
-#include "splash.h"
 #include "tools.h"
 
 void TA_SeaFox::load(TA_Links links) {
     this->links = links;
 
-    loadFromToml("tails/seafox.toml");
+    loadFromToml(links.context, "tails/seafox.toml");
     setCamera(links.camera);
     setAnimation("idle");
 
     jumpSound.load("sound/jump.ogg", TA_SOUND_CHANNEL_SFX1);
-    damageSound.load("sound/damage.ogg", TA_SOUND_CHANNEL_SFX1);
+    damageSound.load("sound/damage.ogg", TA_SOUND_CHANNEL_SFX1, false, TA_SOUND_PRIORITY_HIGH);
     bulletSound.load("sound/bullet.ogg", TA_SOUND_CHANNEL_SFX3);
     extraSpeedSound.load("sound/extra_speed.ogg", TA_SOUND_CHANNEL_SFX3);
     waterSound.load("sound/water.ogg", TA_SOUND_CHANNEL_SFX1);
@@ -53,7 +50,7 @@ void TA_SeaFox::update() {
             noclip = !noclip;
         }
         if(noclip) {
-            position += links.controller->getDirectionVector() * TA::elapsedTime * 5;
+            position += links.controller->getDirectionVector() * links.context->elapsedTime * 5;
             setPosition(position);
             updateFollowPosition();
             return;
@@ -73,11 +70,11 @@ void TA_SeaFox::update() {
 }
 
 void TA_SeaFox::physicsStep() {
-    auto updateSpeed = [](float& currentSpeed, float neededSpeed, float drag) {
+    auto updateSpeed = [&](float& currentSpeed, float neededSpeed, float drag) {
         if(currentSpeed > neededSpeed) {
-            currentSpeed = std::max(neededSpeed, currentSpeed - drag * TA::elapsedTime);
+            currentSpeed = std::max(neededSpeed, currentSpeed - drag * links.context->elapsedTime);
         } else {
-            currentSpeed = std::min(neededSpeed, currentSpeed + drag * TA::elapsedTime);
+            currentSpeed = std::min(neededSpeed, currentSpeed + drag * links.context->elapsedTime);
         }
     };
 
@@ -108,7 +105,7 @@ void TA_SeaFox::physicsStep() {
     }
 
     if(!underwater) {
-        velocity.y = std::min(float(1), velocity.y + deadGravity * TA::elapsedTime);
+        velocity.y = std::min(float(1), velocity.y + deadGravity * links.context->elapsedTime);
     }
 
     if(groundMode) {
@@ -140,17 +137,17 @@ void TA_SeaFox::physicsStep() {
                 if(jumpReleased) {
                     jumpSpeed = std::max(jumpSpeed, releaseJumpSpeed);
                 }
-                jumpSpeed += gravity * TA::elapsedTime;
+                jumpSpeed += gravity * links.context->elapsedTime;
                 velocity.y = std::min(maxYSpeed, std::max(minJumpSpeed, jumpSpeed));
             } else {
-                velocity.y = std::min(maxYSpeed, velocity.y + gravity * TA::elapsedTime);
+                velocity.y = std::min(maxYSpeed, velocity.y + gravity * links.context->elapsedTime);
             }
         }
     }
 
     if(groundMode) {
         auto [delta, flags] = links.objectSet->moveAndCollide(position, TA_Point(9, 4), TA_Point(23, 30),
-            (velocity + velocityAdd) * TA::elapsedTime, TA_COLLISION_SOLID, ground);
+            (velocity + velocityAdd) * links.context->elapsedTime, TA_COLLISION_SOLID, ground);
         position += delta;
         ground = (flags & TA_GROUND_COLLISION) != 0;
         if((flags & TA_WALL_COLLISION) != 0) {
@@ -158,7 +155,7 @@ void TA_SeaFox::physicsStep() {
         }
     } else {
         auto [delta, flags] = links.objectSet->moveAndCollide(position, TA_Point(9, 4), TA_Point(23, 30),
-            (velocity + velocityAdd) * TA::elapsedTime, TA_COLLISION_SOLID, false);
+            (velocity + velocityAdd) * links.context->elapsedTime, TA_COLLISION_SOLID, false);
         position += delta;
         if((flags & TA_WALL_COLLISION) != 0) {
             velocity.x = 0;
@@ -173,7 +170,7 @@ void TA_SeaFox::physicsStep() {
 
     bool newUnderwater = (position.y + 30 > waterLevel);
     if(newUnderwater != underwater) {
-        links.objectSet->spawnObject<TA_Splash>(position + TA_Point(8, 12));
+        links.objectSet->getParticles().spawnSplash(position + TA_Point(8, 12));
         waterSound.play();
     }
 
@@ -208,9 +205,9 @@ void TA_SeaFox::updateDirection() {
 }
 
 void TA_SeaFox::updateFollowPosition() {
-    followPosition =
-        position + TA_Point(getWidth() / 2, getHeight() / 2) - TA_Point(TA::screenWidth / 2, TA::screenHeight / 2);
-    followPosition.x += (flip ? -1 : 1) * (TA::screenWidth * 0.15);
+    followPosition = position + TA_Point(getWidth() / 2, getHeight() / 2) -
+                     TA_Point(links.context->screenWidth / 2, links.context->screenHeight / 2);
+    followPosition.x += (flip ? -1 : 1) * (links.context->screenWidth * 0.15);
 }
 
 void TA_SeaFox::updateDrill() {
@@ -224,7 +221,7 @@ void TA_SeaFox::updateDrill() {
 
 void TA_SeaFox::updateItem() {
     if(extraSpeedTimer < extraSpeedReleaseTime + extraSpeedAddTime) {
-        extraSpeedTimer += TA::elapsedTime;
+        extraSpeedTimer += links.context->elapsedTime;
     }
     if(extraSpeed) {
         if(!links.controller->isPressed(TA_BUTTON_B) || links.hud->getCurrentItem() != ITEM_EXTRA_SPEED ||
@@ -276,13 +273,13 @@ void TA_SeaFox::updateItem() {
 
 void TA_SeaFox::updateVulcanGun() {
     int prev = vulcanGunTimer / vulcanGunInterval;
-    vulcanGunTimer += TA::elapsedTime;
+    vulcanGunTimer += links.context->elapsedTime;
     int cur = vulcanGunTimer / vulcanGunInterval;
 
     if(prev != cur) {
         TA_Point bulletPosition = position + TA_Point((flip ? 0 : 26), 20);
         TA_Point bulletVelocity = TA_Point((flip ? -4 : 4) + velocity.x, 0);
-        links.objectSet->spawnObject<TA_VulcanGunBullet>(bulletPosition, bulletVelocity);
+        links.objectSet->getProjectiles().spawn(TA_PROJECTILE_VULCAN_GUN, bulletPosition, bulletVelocity);
         bulletSound.play();
     }
 }
@@ -292,16 +289,16 @@ void TA_SeaFox::updateSparkle() {
         return;
     }
 
-    float newSparkleTimer = sparkleTimer + TA::elapsedTime;
+    float newSparkleTimer = sparkleTimer + links.context->elapsedTime;
     if(sparkleTimer < sparklePeriod && sparklePeriod <= newSparkleTimer) {
         int minX = static_cast<int>(position.x);
         int maxX = static_cast<int>(position.x + 26);
         int minY = static_cast<int>(position.y);
         int maxY = static_cast<int>(position.y + 28);
         TA_Point sparklePos;
-        sparklePos.x = minX + TA::random::next() % (maxX - minX + 1);
-        sparklePos.y = minY + TA::random::next() % (maxY - minY + 1);
-        links.objectSet->spawnObject<TA_Sparkle>(sparklePos);
+        sparklePos.x = minX + TA::random::next(links.context) % (maxX - minX + 1);
+        sparklePos.y = minY + TA::random::next(links.context) % (maxY - minY + 1);
+        links.objectSet->getParticles().spawnSparkle(sparklePos);
     }
 
     sparkleTimer = std::fmod(newSparkleTimer, sparklePeriod);
@@ -310,7 +307,7 @@ void TA_SeaFox::updateSparkle() {
 void TA_SeaFox::updateDamage() {
     hitbox.setPosition(position);
     if(invincibleTimer < invincibleTime) {
-        invincibleTimer += TA::elapsedTime;
+        invincibleTimer += links.context->elapsedTime;
         setAlpha(180);
         return;
     }
@@ -328,7 +325,7 @@ void TA_SeaFox::updateDamage() {
             }
         }
         TA::gamepad::rumble(0.75, 0.75, 20);
-        if(TA::save::getSaveParameter("rings") <= 0) {
+        if(TA::save::getSaveParameter(links.context, "rings") <= 0) {
             TA::sound::playMusic("sound/death.vgm", 0);
             setAnimation("dead");
             dead = true;
@@ -341,7 +338,7 @@ void TA_SeaFox::updateDamage() {
 }
 
 void TA_SeaFox::dropRings() {
-    if(TA::save::getSaveParameter("rings") <= 4) {
+    if(TA::save::getSaveParameter(links.context, "rings") <= 4) {
         return;
     }
     TA_Point ringPosition = position + TA_Point(20, 20);
@@ -353,11 +350,11 @@ void TA_SeaFox::dropRings() {
 
 void TA_SeaFox::updateDead() {
     velocity.x = 0;
-    velocity.y += deadGravity * TA::elapsedTime;
-    position = position + velocity * TA::elapsedTime;
+    velocity.y += deadGravity * links.context->elapsedTime;
+    position = position + velocity * links.context->elapsedTime;
     setPosition(position);
 
-    deadTimer += TA::elapsedTime;
+    deadTimer += links.context->elapsedTime;
     flip = (getAnimationFrame() >= 3);
 }
 
@@ -1,27 +1,113 @@
 #include "sound.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
 #include "error.h"
+#include "music_cache.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "save.h"
 
+namespace TA::sound {
+    struct Voice {
+        TA_SoundChannel channel = TA_SOUND_CHANNEL_SFX1;
+        TA_SoundPriority priority = TA_SOUND_PRIORITY_NORMAL;
+        long long playId = 0;
+    };
+
+    // SFX1 holds character and menu sounds that are expected to cut each other off
+    constexpr std::array<int, TA_SOUND_CHANNEL_MAX> channelVoiceLimits{1, 4, 4};
+
+    int allocateVoice(TA_SoundChannel channel, TA_SoundPriority priority);
+    void updateVolume();
+    void updateLatency();
+    void postMix(void* userdata, Uint8* stream, int length);
+
+    std::vector<Voice> voices;
+    long long nextPlayId = 1;
+    int mainVolume = -1, musicVolume = -1, sfxVolume = -1;
+    int frequency = 0, frameSize = 1, deviceFrames = 0;
+    std::atomic<int> mixFrames{0};
+}
+
+void TA::sound::init() {
+    int voiceCount = Mix_AllocateChannels(static_cast<int>(TA::save::getParameter("sound_voices")));
+    voices.assign(voiceCount, Voice());
+
+    SDL_AudioFormat format;
+    int channels = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    frameSize = std::max(1, static_cast<int>(SDL_AUDIO_BYTESIZE(format)) * channels);
+
+    SDL_AudioSpec deviceSpec;
+    if(!SDL_GetAudioDeviceFormat(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &deviceSpec, &deviceFrames)) {
+        deviceFrames = 0;
+    }
+    Mix_SetPostMix(postMix, nullptr);
+    TA::printLog("audio: %i Hz, %i channels, %i frames device buffer (estimated latency %i us), %i voices", frequency,
+        channels, deviceFrames, (frequency == 0 ? 0 : static_cast<int>(deviceFrames * 1000000LL / frequency)),
+        voiceCount);
+}
+
 void TA::sound::playMusic(std::string filename, int repeat) {
+    if(TA::musicCache::play(filename, repeat)) {
+        return;
+    }
     Mix_Music* music = TA::resmgr::loadMusic(filename);
     Mix_PlayMusic(music, repeat);
 }
 
 void TA::sound::update() {
-    Mix_MasterVolume(TA::save::getParameter("main_volume") * 16);
-    Mix_VolumeMusic(TA::save::getParameter("main_volume") * TA::save::getParameter("music_volume"));
-    Mix_Volume(TA_SOUND_CHANNEL_SFX1, TA::save::getParameter("sfx_volume") * 16);
-    Mix_Volume(TA_SOUND_CHANNEL_SFX2, TA::save::getParameter("sfx_volume") * 16);
-    Mix_Volume(TA_SOUND_CHANNEL_SFX3, TA::save::getParameter("sfx_volume") * 16);
+    updateVolume();
+    updateLatency();
+}
+
+void TA::sound::updateVolume() {
+    int newMainVolume = static_cast<int>(TA::save::getParameter("main_volume"));
+    int newMusicVolume = static_cast<int>(TA::save::getParameter("music_volume"));
+    int newSfxVolume = static_cast<int>(TA::save::getParameter("sfx_volume"));
+
+    if(newMainVolume != mainVolume) {
+        Mix_MasterVolume(newMainVolume * 16);
+    }
+    if(newMainVolume != mainVolume || newMusicVolume != musicVolume) {
+        Mix_VolumeMusic(newMainVolume * newMusicVolume);
+    }
+    if(newSfxVolume != sfxVolume) {
+        Mix_Volume(-1, newSfxVolume * 16);
+    }
+
+    mainVolume = newMainVolume;
+    musicVolume = newMusicVolume;
+    sfxVolume = newSfxVolume;
+    TA::musicCache::update(mainVolume * musicVolume);
+}
+
+// an estimate from the device buffer and the last mix size, the time until the device plays it isn't known
+void TA::sound::updateLatency() {
+    if(frequency == 0) {
+        return;
+    }
+    long long latency = static_cast<long long>(deviceFrames + mixFrames) * 1000000 / frequency;
+    TA::profiler::setCounter(TA_COUNTER_AUDIO_LATENCY, latency);
+}
+
+void TA::sound::postMix(void* /*userdata*/, Uint8* /*stream*/, int length) {
+    mixFrames = length / frameSize;
 }
 
 bool TA::sound::isPlaying(TA_SoundChannel channel) {
-    return Mix_Playing(channel);
+    for(int voice = 0; voice < static_cast<int>(voices.size()); voice++) {
+        if(voices[voice].channel == channel && Mix_Playing(voice)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool TA::sound::isMusicPlaying() {
-    return Mix_PlayingMusic();
+    return Mix_PlayingMusic() || TA::musicCache::isPlaying();
 }
 
 void TA::sound::fadeOut(int time) {
@@ -33,25 +119,81 @@ void TA::sound::fadeOut(int time) {
 
 void TA::sound::fadeOutMusic(int time) {
     Mix_FadeOutMusic(time * 1000 / 60);
+    TA::musicCache::fadeOut(time * 1000 / 60);
 }
 
 void TA::sound::fadeOutChannel(TA_SoundChannel channel, int time) {
-    Mix_FadeOutChannel(channel, time * 1000 / 60);
+    for(int voice = 0; voice < static_cast<int>(voices.size()); voice++) {
+        if(voices[voice].channel == channel) {
+            Mix_FadeOutChannel(voice, time * 1000 / 60);
+        }
+    }
 }
 
-void TA_Sound::load(std::string filename, TA_SoundChannel newChannel, bool newLoop) {
+int TA::sound::allocateVoice(TA_SoundChannel channel, TA_SoundPriority priority) {
+    int channelVoices = 0, oldestChannelVoice = -1, freeVoice = -1, stolenVoice = -1;
+    for(int voice = 0; voice < static_cast<int>(voices.size()); voice++) {
+        if(!Mix_Playing(voice)) {
+            if(freeVoice == -1) {
+                freeVoice = voice;
+            }
+            continue;
+        }
+        if(voices[voice].channel == channel) {
+            channelVoices++;
+            if(oldestChannelVoice == -1 || voices[voice].playId < voices[oldestChannelVoice].playId) {
+                oldestChannelVoice = voice;
+            }
+        }
+        if(voices[voice].priority <= priority &&
+            (stolenVoice == -1 || voices[voice].priority < voices[stolenVoice].priority ||
+                (voices[voice].priority == voices[stolenVoice].priority &&
+                    voices[voice].playId < voices[stolenVoice].playId))) {
+            stolenVoice = voice;
+        }
+    }
+
+    if(channelVoices >= channelVoiceLimits[channel]) {
+        return oldestChannelVoice;
+    }
+    if(freeVoice != -1) {
+        return freeVoice;
+    }
+    return stolenVoice;
+}
+
+int TA::sound::playChunk(
+    Mix_Chunk* chunk, TA_SoundChannel channel, TA_SoundPriority priority, bool loop, long long& playId) {
+    int voice = allocateVoice(channel, priority);
+    if(voice == -1) {
+        return -1;
+    }
+    voices[voice] = {.channel = channel, .priority = priority, .playId = nextPlayId++};
+    playId = voices[voice].playId;
+    Mix_PlayChannel(voice, chunk, (loop ? -1 : 0));
+    return voice;
+}
+
+bool TA::sound::isVoiceOwner(int voice, long long playId) {
+    return voice != -1 && voices[voice].playId == playId;
+}
+
+void TA_Sound::load(std::string filename, TA_SoundChannel newChannel, bool newLoop, TA_SoundPriority newPriority) {
     chunk = TA::resmgr::loadChunk(filename);
     channel = newChannel;
     loop = newLoop;
+    priority = newPriority;
 }
 
 void TA_Sound::play() {
     if(chunk == nullptr) {
         return;
     }
-    Mix_PlayChannel(channel, chunk, loop);
+    voice = TA::sound::playChunk(chunk, channel, priority, loop, playId);
 }
 
 void TA_Sound::fadeOut(int time) {
-    Mix_FadeOutChannel(channel, time * 1000 / 60);
+    if(TA::sound::isVoiceOwner(voice, playId)) {
+        Mix_FadeOutChannel(voice, time * 1000 / 60);
+    }
 }
@@ -6,7 +6,10 @@
 
 enum TA_SoundChannel { TA_SOUND_CHANNEL_SFX1, TA_SOUND_CHANNEL_SFX2, TA_SOUND_CHANNEL_SFX3, TA_SOUND_CHANNEL_MAX };
 
+enum TA_SoundPriority { TA_SOUND_PRIORITY_LOW = -1, TA_SOUND_PRIORITY_NORMAL = 0, TA_SOUND_PRIORITY_HIGH = 1 };
+
 namespace TA::sound {
+    void init();
     void playMusic(std::string filename, int repeat = -1);
     void update();
     bool isPlaying(TA_SoundChannel channel);
@@ -14,16 +17,22 @@ namespace TA::sound {
     void fadeOut(int time);
     void fadeOutMusic(int time);
     void fadeOutChannel(TA_SoundChannel channel, int time);
+    int playChunk(Mix_Chunk* chunk, TA_SoundChannel channel, TA_SoundPriority priority, bool loop, long long& playId);
+    bool isVoiceOwner(int voice, long long playId);
 }
 
 class TA_Sound {
 private:
     Mix_Chunk* chunk = nullptr;
     TA_SoundChannel channel = TA_SOUND_CHANNEL_SFX1;
+    TA_SoundPriority priority = TA_SOUND_PRIORITY_NORMAL;
     bool loop = false;
+    int voice = -1;
+    long long playId = 0;
 
 public:
-    void load(std::string filename, TA_SoundChannel channel, bool loop = false);
+    void load(std::string filename, TA_SoundChannel channel, bool loop = false,
+        TA_SoundPriority priority = TA_SOUND_PRIORITY_NORMAL);
     void play();
     void fadeOut(int time);
     void clear() { chunk = nullptr; }
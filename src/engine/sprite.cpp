@@ -2,15 +2,28 @@
 #include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <mutex>
 #include <numeric>
 #include <toml.hpp>
+#include <unordered_map>
 #include <vector>
+#include "cpu_renderer.h"
 #include "error.h"
+#include "profiler.h"
 #include "resource_manager.h"
 #include "tools.h"
 
+namespace {
+    // animation tables are the same for every sprite loaded from one file, so they are parsed once and shared
+    std::unordered_map<std::string, std::shared_ptr<const std::map<std::string, TA_Animation>>> animationCache;
+    std::mutex animationCacheMutex;
+}
+
 void TA_Texture::load(std::string filename) {
     SDLTexture = TA::resmgr::loadTexture(filename);
+    if(TA::cpuRenderer::getTextureSize(SDLTexture, width, height)) {
+        return;
+    }
     float floatWidth, floatHeight;
     SDL_GetTextureSize(SDLTexture, &floatWidth, &floatHeight);
     width = int(floatWidth + 0.5);
@@ -37,7 +50,8 @@ TA_Animation::TA_Animation(int frame) {
     create(std::vector<int>{frame}, 1, -1);
 }
 
-void TA_Sprite::load(std::string filename, int newFrameWidth, int newFrameHeight) {
+void TA_Sprite::load(TA_Context* newContext, std::string filename, int newFrameWidth, int newFrameHeight) {
+    context = newContext;
     texture.load(filename);
     if(newFrameWidth == -1) {
         frameWidth = texture.width;
@@ -48,10 +62,12 @@ void TA_Sprite::load(std::string filename, int newFrameWidth, int newFrameHeight
     }
 
     animation = TA_Animation(0);
+    animationClock = context->animationClock;
     loaded = true;
 }
 
-void TA_Sprite::loadFromToml(std::filesystem::path path) {
+void TA_Sprite::loadFromToml(TA_Context* newContext, std::filesystem::path path) {
+    context = newContext;
     try {
         tryLoadFromToml(path);
     } catch(std::exception& e) {
@@ -74,11 +90,20 @@ void TA_Sprite::tryLoadFromToml(std::filesystem::path path) {
     }
 
     animation = TA_Animation(0);
+    animationClock = context->animationClock;
     loaded = true;
     if(!table.contains("animations")) {
         return;
     }
 
+    std::lock_guard<std::mutex> lock(animationCacheMutex);
+    auto& cachedAnimations = animationCache[path.generic_string()];
+    if(cachedAnimations != nullptr) {
+        loadedAnimations = cachedAnimations;
+        return;
+    }
+
+    auto animations = std::make_shared<std::map<std::string, TA_Animation>>();
     for(const auto& [key, value] : table.at("animations").as_table()) {
         TA_Animation animation;
         if(value.is_integer()) {
@@ -96,8 +121,10 @@ void TA_Sprite::tryLoadFromToml(std::filesystem::path path) {
                 animation.repeatTimes = static_cast<int>(value.at("repeat").as_integer());
             }
         }
-        loadedAnimations[key] = animation;
+        (*animations)[key] = animation;
     }
+    cachedAnimations = animations;
+    loadedAnimations = animations;
 }
 
 void TA_Sprite::draw() {
@@ -109,6 +136,9 @@ void TA_Sprite::drawFrom(SDL_Rect srcRect) {
         return;
     }
     updateAnimation();
+    if(!context->renderingEnabled) {
+        return;
+    }
 
     if(srcRect.x == -1) {
         srcRect.x = (frameWidth * frame) % texture.width;
@@ -135,22 +165,42 @@ void TA_Sprite::drawFrom(SDL_Rect srcRect) {
     dstRect.h = srcRect.h * TA::scaleFactor;
 
     if(!hidden) {
+        TA::profiler::addCounter(TA_COUNTER_DRAW_CALLS, 1);
+    }
+    if(!hidden && TA::cpuRenderer::isEnabled()) {
+        TA::cpuRenderer::drawTexture(texture.SDLTexture, srcRect, dstRect.x, dstRect.y, flip, getColorMod());
+    } else if(!hidden) {
         SDL_SetTextureAlphaMod(texture.SDLTexture, alpha);
+        SDL_SetTextureColorMod(texture.SDLTexture, colorMod.r, colorMod.g, colorMod.b);
         SDL_FlipMode flipFlags = (flip ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE);
         SDL_FRect srcFRect, dstFRect;
         SDL_RectToFRect(&srcRect, &srcFRect);
         SDL_RectToFRect(&dstRect, &dstFRect);
         SDL_RenderTextureRotated(TA::renderer, texture.SDLTexture, &srcFRect, &dstFRect, 0, nullptr, flipFlags);
     }
-    updateAnimationNeeded = true;
+}
+
+SDL_FRect TA_Sprite::getFrameRect(int frame) {
+    SDL_FRect rect;
+    rect.x = static_cast<float>((frameWidth * frame) % texture.width);
+    rect.y = static_cast<float>((frameWidth * frame) / texture.width * frameHeight);
+    rect.w = static_cast<float>(frameWidth);
+    rect.h = static_cast<float>(frameHeight);
+    return rect;
 }
 
 void TA_Sprite::updateAnimation() {
-    if(!doUpdateAnimation || !updateAnimationNeeded) {
+    if(!loaded) {
         return;
     }
-    if(isAnimated()) {
-        animationTimer += TA::elapsedTime;
+    // catch up with the steps since the last call, time passed with updates disabled is dropped
+    float delta = static_cast<float>(context->animationClock - animationClock);
+    animationClock = context->animationClock;
+    if(!doUpdateAnimation) {
+        return;
+    }
+    if(hasRunningAnimation()) {
+        animationTimer += delta;
         animationFrame += static_cast<int>(animationTimer / static_cast<float>(animation.delay));
 
         if(animationFrame >= static_cast<int>(animation.frames.size())) {
@@ -169,12 +219,11 @@ void TA_Sprite::updateAnimation() {
     } else {
         frame = animation.frames[0];
     }
-    updateAnimationNeeded = false;
 }
 
-void TA_Sprite::forceUpdateAnimation() {
-    updateAnimationNeeded = true;
+void TA_Sprite::setUpdateAnimation(bool enabled) {
     updateAnimation();
+    doUpdateAnimation = enabled;
 }
 
 void TA_Sprite::setAnimation(TA_Animation newAnimation) {
@@ -185,11 +234,15 @@ void TA_Sprite::setAnimation(TA_Animation newAnimation) {
     animation = newAnimation;
     animationFrame = 0;
     animationTimer = 0;
+    if(loaded) {
+        // the step that starts an animation counts towards it
+        animationClock = context->animationClock - context->elapsedTime;
+    }
 }
 
 void TA_Sprite::setAnimation(std::string name) {
-    if(loadedAnimations.count(name)) {
-        setAnimation(loadedAnimations[name]);
+    if(loadedAnimations != nullptr && loadedAnimations->contains(name)) {
+        setAnimation(loadedAnimations->at(name));
         animationName = name;
     } else {
         TA::printWarning("unknown animation %s", name.c_str());
@@ -200,10 +253,16 @@ void TA_Sprite::setFrame(int newFrame) {
     setAnimation(TA_Animation(newFrame));
 }
 
-bool TA_Sprite::isAnimated() {
+bool TA_Sprite::hasRunningAnimation() {
     return animation.frames.size() != 1 || animation.delay != 1 || animation.repeatTimes != -1;
 }
 
+bool TA_Sprite::isAnimated() {
+    // objects end their life on this, so it has to see the current step even if the sprite wasn't drawn
+    updateAnimation();
+    return hasRunningAnimation();
+}
+
 void TA_Sprite::setAlpha(int newAlpha) {
     alpha = newAlpha;
     alpha = std::min(alpha, 255);
@@ -217,10 +276,9 @@ void TA_Sprite::setColorMod(int r, int g, int b) {
         x = std::max(x, 0);
         return x;
     };
-    r = normalize(r);
-    g = normalize(g);
-    b = normalize(b);
-    SDL_SetTextureColorMod(texture.SDLTexture, r, g, b);
+    colorMod.r = static_cast<Uint8>(normalize(r));
+    colorMod.g = static_cast<Uint8>(normalize(g));
+    colorMod.b = static_cast<Uint8>(normalize(b));
 }
 
 int TA_Sprite::getAnimationFrame() {
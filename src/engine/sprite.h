@@ -3,10 +3,12 @@
 
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "SDL3/SDL.h"
 #include "camera.h"
+#include "context.h"
 #include "geometry.h"
 
 class TA_Texture {
@@ -37,20 +39,32 @@ private:
     TA_Point position;
     TA_Camera* camera = nullptr;
 
-    std::map<std::string, TA_Animation> loadedAnimations;
+    std::shared_ptr<const std::map<std::string, TA_Animation>> loadedAnimations;
     TA_Animation animation;
     int animationFrame = 0;
     float animationTimer = 0;
-    bool flip = false, hidden = false, updateAnimationNeeded = true, loaded = false;
+    // the context's animation clock this sprite has caught up with
+    double animationClock = 0;
+    bool flip = false, hidden = false, loaded = false;
     bool doUpdateAnimation = true;
     int alpha = 255;
+    SDL_Color colorMod{255, 255, 255, 255};
     std::string animationName;
 
     void tryLoadFromToml(std::filesystem::path path);
+    bool hasRunningAnimation();
+
+protected:
+    // the game the sprite belongs to, set on load
+    TA_Context* context = nullptr;
+
+    const TA_Texture& getTexture() { return texture; }
+    const TA_Animation& getCurrentAnimation() { return animation; }
+    SDL_FRect getFrameRect(int frame);
 
 public:
-    void load(std::string filename, int frameWidth = -1, int frameHeight = -1);
-    void loadFromToml(std::filesystem::path path);
+    void load(TA_Context* newContext, std::string filename, int frameWidth = -1, int frameHeight = -1);
+    void loadFromToml(TA_Context* newContext, std::filesystem::path path);
 
     virtual void draw();
     void drawFrom(SDL_Rect srcRect);
@@ -65,6 +79,8 @@ public:
     int getWidth() { return frameWidth; }
     int getHeight() { return frameHeight; }
     bool getFlip() { return flip; }
+    int getAlpha() { return alpha; }
+    SDL_Color getColorMod() { return {colorMod.r, colorMod.g, colorMod.b, static_cast<Uint8>(alpha)}; }
     TA_Point getPosition() { return position; }
 
     void setAnimation(std::string name);
@@ -75,8 +91,7 @@ public:
     int getCurrentFrame();
     std::string getAnimationName() { return (isAnimated() ? animationName : ""); }
     void updateAnimation();
-    void forceUpdateAnimation();
-    void setUpdateAnimation(bool enabled) { doUpdateAnimation = enabled; }
+    void setUpdateAnimation(bool enabled);
 };
 
 #endif // TA_SPRITE_H
@@ -0,0 +1,72 @@
+#include "sprite_batch.h"
+#include "cpu_renderer.h"
+#include "profiler.h"
+#include "tools.h"
+
+int TA_SpriteBatch::getAnimationFrameAt(float time) {
+    const TA_Animation& animation = getCurrentAnimation();
+    int frames = static_cast<int>(animation.frames.size());
+    int frame = static_cast<int>(time / static_cast<float>(animation.delay));
+    if(animation.repeatTimes != -1 && frame >= frames * animation.repeatTimes) {
+        return animation.frames.back();
+    }
+    return animation.frames[frame % frames];
+}
+
+void TA_SpriteBatch::begin(TA_Camera* camera) {
+    cameraPosition = (camera == nullptr ? TA_Point(0, 0) : camera->getPosition());
+    cameraX = static_cast<int>(cameraPosition.x * TA::scaleFactor + 0.5);
+    cameraY = static_cast<int>(cameraPosition.y * TA::scaleFactor + 0.5);
+    vertices.clear();
+    indices.clear();
+}
+
+void TA_SpriteBatch::add(TA_Point position, int frame) {
+    if(!context->renderingEnabled) {
+        return;
+    }
+    const float width = static_cast<float>(getWidth()), height = static_cast<float>(getHeight());
+    const float screenWidth = static_cast<float>(context->screenWidth);
+    const float screenHeight = static_cast<float>(context->screenHeight);
+    if(position.x <= cameraPosition.x - width || position.x >= cameraPosition.x + screenWidth ||
+        position.y <= cameraPosition.y - height || position.y >= cameraPosition.y + screenHeight) {
+        return;
+    }
+
+    TA::profiler::addCounter(TA_COUNTER_DRAW_CALLS, 1);
+    // same rounding as TA_Sprite so batched sprites line up with regular ones
+    int dstX = static_cast<int>(position.x * TA::scaleFactor + 0.5) - cameraX;
+    int dstY = static_cast<int>(position.y * TA::scaleFactor + 0.5) - cameraY;
+    const TA_Texture& texture = getTexture();
+    SDL_FRect srcRect = getFrameRect(frame);
+    if(TA::cpuRenderer::isEnabled()) {
+        SDL_Rect rect{static_cast<int>(srcRect.x), static_cast<int>(srcRect.y), static_cast<int>(srcRect.w),
+            static_cast<int>(srcRect.h)};
+        TA::cpuRenderer::drawTexture(texture.SDLTexture, rect, dstX, dstY, false, getColorMod());
+        return;
+    }
+
+    SDL_Color mod = getColorMod();
+    const SDL_FColor color{static_cast<float>(mod.r) / 255, static_cast<float>(mod.g) / 255,
+        static_cast<float>(mod.b) / 255, static_cast<float>(mod.a) / 255};
+    float dstLeft = static_cast<float>(dstX), dstTop = static_cast<float>(dstY);
+    float dstRight = dstLeft + (width * TA::scaleFactor), dstBottom = dstTop + (height * TA::scaleFactor);
+    float srcLeft = srcRect.x / static_cast<float>(texture.width);
+    float srcTop = srcRect.y / static_cast<float>(texture.height);
+    float srcRight = (srcRect.x + srcRect.w) / static_cast<float>(texture.width);
+    float srcBottom = (srcRect.y + srcRect.h) / static_cast<float>(texture.height);
+
+    int first = static_cast<int>(vertices.size());
+    vertices.push_back({{dstLeft, dstTop}, color, {srcLeft, srcTop}});
+    vertices.push_back({{dstRight, dstTop}, color, {srcRight, srcTop}});
+    vertices.push_back({{dstRight, dstBottom}, color, {srcRight, srcBottom}});
+    vertices.push_back({{dstLeft, dstBottom}, color, {srcLeft, srcBottom}});
+    indices.insert(indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+}
+
+void TA_SpriteBatch::end() {
+    if(!vertices.empty()) {
+        SDL_RenderGeometry(TA::renderer, getTexture().SDLTexture, vertices.data(), static_cast<int>(vertices.size()),
+            indices.data(), static_cast<int>(indices.size()));
+    }
+}
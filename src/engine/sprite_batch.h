@@ -0,0 +1,23 @@
+#ifndef TA_SPRITE_BATCH_H
+#define TA_SPRITE_BATCH_H
+
+#include <vector>
+#include "camera.h"
+#include "sprite.h"
+
+// draws many copies of one sprite with a single geometry call, each copy has its own position and frame
+class TA_SpriteBatch : public TA_Sprite {
+private:
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    TA_Point cameraPosition;
+    int cameraX = 0, cameraY = 0;
+
+public:
+    int getAnimationFrameAt(float time);
+    void begin(TA_Camera* camera);
+    void add(TA_Point position, int frame);
+    void end();
+};
+
+#endif // TA_SPRITE_BATCH_H
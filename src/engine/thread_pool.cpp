@@ -0,0 +1,192 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "SDL3/SDL.h"
+
+namespace TA::threadPool {
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::pair<int, int>> ranges;
+    };
+
+    bool takeRange(int queue, std::pair<int, int>& range);
+    void runRanges(int queue);
+    void workerLoop(int queue);
+    void backgroundLoop();
+
+    // queue 0 belongs to the thread calling parallelFor, the rest to the workers
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::mutex poolMutex;
+    std::condition_variable startCondition, doneCondition;
+    const std::function<void(int, int)>* job = nullptr;
+    int busyWorkers = 0, generation = 0;
+    bool quitNeeded = false;
+
+    std::thread backgroundThread;
+    std::mutex backgroundMutex;
+    std::condition_variable backgroundCondition;
+    std::deque<std::function<void()>> backgroundTasks;
+    bool backgroundQuitNeeded = false;
+
+    // set while a thread runs ranges, a parallelFor from inside a job runs on that thread alone
+    thread_local bool insideJob = false;
+}
+
+void TA::threadPool::init(int threadCount) {
+    queues.clear();
+    for(int queue = 0; queue <= threadCount; queue++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for(int worker = 1; worker <= threadCount; worker++) {
+        workers.emplace_back(workerLoop, worker);
+    }
+}
+
+int TA::threadPool::getThreadCount() {
+    return static_cast<int>(workers.size());
+}
+
+void TA::threadPool::parallelFor(int count, int grain, const std::function<void(int, int)>& function) {
+    grain = std::max(1, grain);
+    if(workers.empty() || count <= grain || insideJob) {
+        for(int begin = 0; begin < count; begin += grain) {
+            function(begin, std::min(count, begin + grain));
+        }
+        return;
+    }
+
+    // neighbouring ranges go to the same queue, owners take from the front and thieves from the back
+    int rangeCount = (count + grain - 1) / grain;
+    int queueCount = static_cast<int>(queues.size());
+    for(int range = 0; range < rangeCount; range++) {
+        Queue& queue = *queues[static_cast<size_t>(range) * queueCount / rangeCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.emplace_back(range * grain, std::min(count, (range + 1) * grain));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        job = &function;
+        busyWorkers = static_cast<int>(workers.size());
+        generation++;
+    }
+    startCondition.notify_all();
+    insideJob = true;
+    runRanges(0);
+    insideJob = false;
+
+    std::unique_lock<std::mutex> lock(poolMutex);
+    doneCondition.wait(lock, [&]() { return busyWorkers == 0; });
+    job = nullptr;
+}
+
+bool TA::threadPool::takeRange(int queue, std::pair<int, int>& range) {
+    {
+        Queue& own = *queues[queue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if(!own.ranges.empty()) {
+            range = own.ranges.front();
+            own.ranges.pop_front();
+            return true;
+        }
+    }
+
+    int queueCount = static_cast<int>(queues.size());
+    for(int offset = 1; offset < queueCount; offset++) {
+        Queue& other = *queues[(queue + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if(!other.ranges.empty()) {
+            range = other.ranges.back();
+            other.ranges.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TA::threadPool::runRanges(int queue) {
+    std::pair<int, int> range;
+    while(takeRange(queue, range)) {
+        (*job)(range.first, range.second);
+    }
+}
+
+void TA::threadPool::workerLoop(int queue) {
+    int currentGeneration = 0;
+    insideJob = true;
+    while(true) {
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            startCondition.wait(lock, [&]() { return quitNeeded || generation != currentGeneration; });
+            if(quitNeeded) {
+                return;
+            }
+            currentGeneration = generation;
+        }
+        runRanges(queue);
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            busyWorkers--;
+        }
+        doneCondition.notify_one();
+    }
+}
+
+void TA::threadPool::runInBackground(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(backgroundMutex);
+        backgroundTasks.push_back(std::move(task));
+    }
+    if(!backgroundThread.joinable()) {
+        backgroundThread = std::thread(backgroundLoop);
+    }
+    backgroundCondition.notify_one();
+}
+
+void TA::threadPool::backgroundLoop() {
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_LOW);
+    while(true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(backgroundMutex);
+            backgroundCondition.wait(lock, [] { return backgroundQuitNeeded || !backgroundTasks.empty(); });
+            if(backgroundQuitNeeded) {
+                return;
+            }
+            task = std::move(backgroundTasks.front());
+            backgroundTasks.pop_front();
+        }
+        task();
+    }
+}
+
+void TA::threadPool::quit() {
+    {
+        std::lock_guard<std::mutex> lock(backgroundMutex);
+        backgroundQuitNeeded = true;
+        backgroundTasks.clear();
+    }
+    backgroundCondition.notify_all();
+    if(backgroundThread.joinable()) {
+        backgroundThread.join();
+    }
+    backgroundQuitNeeded = false;
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        quitNeeded = true;
+    }
+    startCondition.notify_all();
+    for(std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    queues.clear();
+    quitNeeded = false;
+}
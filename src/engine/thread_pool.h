@@ -0,0 +1,21 @@
+#ifndef TA_THREAD_POOL_H
+#define TA_THREAD_POOL_H
+
+#include <functional>
+
+// worker threads for splitting a loop, each thread starts on its own share of ranges and steals from the others once
+// it runs out; with no workers everything runs on the calling thread
+// jobs get the game state they work on through their captures, a parallelFor from inside a job runs serially
+
+namespace TA::threadPool {
+    void init(int threadCount);
+    int getThreadCount();
+    // calls function(begin, end) for ranges of at most grain indices covering [0, count), returns when all are done
+    void parallelFor(int count, int grain, const std::function<void(int, int)>& function);
+    // queues work nothing waits on, tasks run one at a time in order on a low priority thread of their own
+    // quit drops the tasks that haven't started and waits for the running one
+    void runInBackground(std::function<void()> task);
+    void quit();
+}
+
+#endif // TA_THREAD_POOL_H
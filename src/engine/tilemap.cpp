@@ -7,7 +7,8 @@
 #include "resource_manager.h"
 #include "tools.h"
 
-void TA_Tilemap::load(std::string filename) {
+void TA_Tilemap::load(TA_Context* newContext, std::string filename) {
+    context = newContext;
     this->filename = filename;
     tmx::Map map;
     try {
@@ -71,7 +72,7 @@ void TA_Tilemap::loadTileset(const tmx::Tileset& tiles) {
     std::filesystem::path textureFilename = filename.parent_path() / tiles.image().source();
 
     for(size_t tile = 0; tile < tiles.tileCount(); tile += 1) {
-        tileset[tile].sprite.load(textureFilename.string(), tileWidth, tileHeight);
+        tileset[tile].sprite.load(context, textureFilename.string(), tileWidth, tileHeight);
         tileset[tile].sprite.setFrame(tile);
     }
 
@@ -104,10 +105,10 @@ void TA_Tilemap::loadTileset(const tmx::Tileset& tiles) {
         }
 
         TA_Point start{object.position().x, object.position().y};
-        TA_Polygon polygon;
+        std::vector<TA_Point> vertices;
         for(int i = 0; i < object.polygon().size(); i++) {
             TA_Point cur{object.polygon()[i].x, object.polygon()[i].y};
-            polygon.addVertex(start + cur);
+            vertices.push_back(start + cur);
         }
 
         if(object.hasProperty("type")) {
@@ -123,7 +124,9 @@ void TA_Tilemap::loadTileset(const tmx::Tileset& tiles) {
         } else if(tileset[tile.id()].type == 4) {
             collisionType = TA_COLLISION_SOLID_DOWN;
         }
-        tileset[tile.id()].hitboxes.push_back({polygon, collisionType});
+        for(const TA_ConvexPolygon& polygon : TA_ConvexPolygon::split(vertices)) {
+            tileset[tile.id()].hitboxes.push_back({polygon, collisionType});
+        }
     }
 }
 
@@ -153,9 +156,9 @@ void TA_Tilemap::draw(int priority) {
         if(camera != nullptr && TA::equal(position.x, 0) && TA::equal(position.y, 0)) {
             TA_Point cameraPos = camera->getPosition();
             lx = std::max(0, static_cast<int>(cameraPos.x / tileWidth));
-            rx = static_cast<int>((cameraPos.x + TA::screenWidth) / tileWidth);
+            rx = static_cast<int>((cameraPos.x + context->screenWidth) / tileWidth);
             ly = std::max(0, static_cast<int>(cameraPos.y / tileWidth));
-            ry = static_cast<int>((cameraPos.y + TA::screenHeight) / tileWidth);
+            ry = static_cast<int>((cameraPos.y + context->screenHeight) / tileWidth);
         }
 
         for(int tileX = lx; tileX <= rx; tileX++) {
@@ -172,14 +175,10 @@ void TA_Tilemap::draw(int priority) {
         }
     };
 
+    if(!context->renderingEnabled) {
+        return;
+    }
     if(priority == 0) {
-        if(updateAnimation) {
-            for(size_t tile = 0; tile < tileset.size(); tile += 1) {
-                tileset[tile].sprite.setUpdateAnimation(true);
-                tileset[tile].sprite.forceUpdateAnimation();
-                tileset[tile].sprite.setUpdateAnimation(false);
-            }
-        }
         for(int layer : normalLayers) {
             drawLayer(layer);
         }
@@ -206,7 +205,7 @@ void TA_Tilemap::setLayerAlpha(int layer, int alpha) {
     layerAlpha[layer] = alpha;
 }
 
-int TA_Tilemap::checkCollision(TA_Rect& rect) {
+int TA_Tilemap::checkCollision(const TA_Rect& rect) {
     int minX = std::max(0, static_cast<int>(rect.getTopLeft().x / tileWidth));
     int maxX = rect.getBottomRight().x / tileHeight;
     int minY = std::max(0, static_cast<int>(rect.getTopLeft().y / tileWidth));
@@ -218,9 +217,9 @@ int TA_Tilemap::checkCollision(TA_Rect& rect) {
         if(tileId == -1) {
             return;
         }
-        for(auto& hitbox : tileset[tileId].hitboxes) {
-            hitbox.polygon.setPosition(TA_Point(tileX * tileWidth, tileY * tileHeight));
-            if(hitbox.polygon.intersects(rect)) {
+        TA_Point tilePosition(tileX * tileWidth, tileY * tileHeight);
+        for(const auto& hitbox : tileset[tileId].hitboxes) {
+            if(hitbox.polygon.intersects(rect, tilePosition)) {
                 flags |= hitbox.type;
             }
         }
@@ -244,7 +243,9 @@ int TA_Tilemap::checkCollision(TA_Rect& rect) {
 }
 
 void TA_Tilemap::setUpdateAnimation(bool enabled) {
-    updateAnimation = enabled;
+    for(size_t tile = 0; tile < tileset.size(); tile += 1) {
+        tileset[tile].sprite.setUpdateAnimation(enabled);
+    }
 }
 
 std::vector<TA_Tilemap::Hitbox> TA_Tilemap::getSpikesHitboxVector(int type) {
@@ -274,9 +275,7 @@ TA_Tilemap::Hitbox TA_Tilemap::getSpikesSolidHitbox(int type) {
             bottomRight = {15, 16};
     }
 
-    TA_Polygon polygon;
-    polygon.setRectangle(topLeft, bottomRight);
-    return {polygon, TA_COLLISION_SOLID};
+    return {TA_ConvexPolygon(topLeft, bottomRight), TA_COLLISION_SOLID};
 }
 
 TA_Tilemap::Hitbox TA_Tilemap::getSpikesDamageHitbox(int type) {
@@ -300,7 +299,5 @@ TA_Tilemap::Hitbox TA_Tilemap::getSpikesDamageHitbox(int type) {
             break;
     }
 
-    TA_Polygon polygon;
-    polygon.setRectangle(topLeft, bottomRight);
-    return {polygon, TA_COLLISION_DAMAGE};
+    return {TA_ConvexPolygon(topLeft, bottomRight), TA_COLLISION_DAMAGE};
 }
@@ -35,7 +35,7 @@ enum TA_CollisionType {
 class TA_Tilemap {
 private:
     struct Hitbox {
-        TA_Polygon polygon;
+        TA_ConvexPolygon polygon;
         int type;
     };
 
@@ -54,20 +54,20 @@ private:
 
     std::vector<std::vector<std::vector<int>>> tilemap;
     std::vector<Tile> tileset;
-    std::array<TA_Polygon, 4> borderPolygons;
+    std::array<TA_ConvexPolygon, 4> borderPolygons;
     std::vector<int> collisionLayers;
     std::vector<int> normalLayers;
     std::vector<int> priorityLayers;
     std::vector<int> layerAlpha;
     std::filesystem::path filename;
     TA_Camera* camera = nullptr;
+    TA_Context* context = nullptr;
     TA_Point position;
     int width, height, tileWidth, tileHeight, layerCount;
     int borderMask = 13;
-    bool updateAnimation = true;
 
 public:
-    void load(std::string filename);
+    void load(TA_Context* newContext, std::string filename);
     void draw(int priority);
     void setCamera(TA_Camera* newCamera);
     void setPosition(TA_Point position);
@@ -76,8 +76,10 @@ public:
     void updateBorders();
     int getWidth() { return width * tileWidth; }
     int getHeight() { return height * tileHeight; }
+    int getTileWidth() { return tileWidth; }
+    int getTileHeight() { return tileHeight; }
     int getNumLayers() { return static_cast<int>(tilemap.size()); }
-    int checkCollision(TA_Rect& rect);
+    int checkCollision(const TA_Rect& rect);
     void setUpdateAnimation(bool enabled);
 };
 
@@ -2,31 +2,29 @@
 #include <algorithm>
 #include <fstream>
 #include <limits>
-#include <random>
 #include <vector>
 #include "SDL3/SDL.h"
+#include "cpu_renderer.h"
+#include "profiler.h"
 
 namespace TA {
     SDL_Window* window;
     SDL_Renderer* renderer;
 
-    int screenWidth, screenHeight, scaleFactor;
-    float elapsedTime;
-
-    std::string levelPath = "", previousLevelPath = "";
+    int scaleFactor;
     std::set<std::string> arguments;
 
-    namespace random {
-        std::mt19937_64 gen;
-    }
-
     namespace eventLog {
         std::ifstream input;
         std::ofstream output;
     }
 }
 
-void TA::drawRect(TA_Point topLeft, TA_Point bottomRight, int r, int g, int b, int a) {
+void TA::drawRect(TA_Context* context, TA_Point topLeft, TA_Point bottomRight, int r, int g, int b, int a) {
+    if(!context->renderingEnabled) {
+        return;
+    }
+
     SDL_FRect rect;
     rect.x = topLeft.x * TA::scaleFactor;
     rect.y = topLeft.y * TA::scaleFactor;
@@ -35,24 +33,29 @@ void TA::drawRect(TA_Point topLeft, TA_Point bottomRight, int r, int g, int b, i
 
     a = std::max(a, 0);
     a = std::min(a, 255);
+    TA::profiler::addCounter(TA_COUNTER_DRAW_CALLS, 1);
+    if(TA::cpuRenderer::isEnabled()) {
+        TA::cpuRenderer::fillRect(rect, r, g, b, a);
+        return;
+    }
     SDL_SetRenderDrawColor(TA::renderer, r, g, b, a);
     SDL_RenderFillRect(TA::renderer, &rect);
 }
 
-void TA::drawScreenRect(int r, int g, int b, int a) {
-    drawRect(TA_Point(-16, -16), TA_Point(TA::screenWidth + 16, TA::screenHeight + 16), r, g, b, a);
+void TA::drawScreenRect(TA_Context* context, int r, int g, int b, int a) {
+    drawRect(context, TA_Point(-16, -16), TA_Point(context->screenWidth + 16, context->screenHeight + 16), r, g, b, a);
 }
 
-void TA::drawShadow(int factor) {
-    drawScreenRect(0, 0, 0, factor);
+void TA::drawShadow(TA_Context* context, int factor) {
+    drawScreenRect(context, 0, 0, 0, factor);
 }
 
-void TA::random::init(unsigned long long seed) {
-    gen = std::mt19937_64(seed);
+void TA::random::init(TA_Context* context, unsigned long long seed) {
+    context->random = std::mt19937_64(seed);
 }
 
-long long TA::random::next() {
-    return static_cast<long long>(gen() & ~(1ULL << 63));
+long long TA::random::next(TA_Context* context) {
+    return static_cast<long long>(context->random() & ~(1ULL << 63));
 }
 
 long long TA::random::max() {
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 #include "SDL3/SDL.h"
+#include "context.h"
 #include "geometry.h"
 
 enum TA_Direction { TA_DIRECTION_UP, TA_DIRECTION_DOWN, TA_DIRECTION_LEFT, TA_DIRECTION_RIGHT, TA_DIRECTION_MAX };
@@ -13,20 +14,18 @@ enum TA_Direction { TA_DIRECTION_UP, TA_DIRECTION_DOWN, TA_DIRECTION_LEFT, TA_DI
 enum TA_FunctionButton { TA_BUTTON_A, TA_BUTTON_B, TA_BUTTON_PAUSE, TA_BUTTON_LB, TA_BUTTON_RB, TA_BUTTON_MAX };
 
 namespace TA {
+    // the display is shared by every context, screen size and rendering state live in TA_Context
     extern SDL_Window* window;
     extern SDL_Renderer* renderer;
-
-    extern int screenWidth, screenHeight, scaleFactor;
-    extern float elapsedTime;
+    extern int scaleFactor;
 
     constexpr float pi = 3.14159265358979323846;
 
-    extern std::string levelPath, previousLevelPath;
     extern std::set<std::string> arguments;
 
-    void drawRect(TA_Point topLeft, TA_Point bottomRight, int r, int g, int b, int a);
-    void drawScreenRect(int r, int g, int b, int a);
-    void drawShadow(int factor);
+    void drawRect(TA_Context* context, TA_Point topLeft, TA_Point bottomRight, int r, int g, int b, int a);
+    void drawScreenRect(TA_Context* context, int r, int g, int b, int a);
+    void drawShadow(TA_Context* context, int factor);
     float linearInterpolation(float left, float right, float pos);
     int getBaseHeight(int index);
 
@@ -36,8 +35,8 @@ namespace TA {
     }
 
     namespace random {
-        void init(unsigned long long seed);
-        long long next();
+        void init(TA_Context* context, unsigned long long seed);
+        long long next(TA_Context* context);
         long long max();
     }
 }
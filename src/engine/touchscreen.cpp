@@ -19,13 +19,13 @@ void TA::touchscreen::update() {
     justPressedFingers.clear();
 }
 
-void TA::touchscreen::handleEvent(SDL_TouchFingerEvent event) {
+void TA::touchscreen::handleEvent(TA_Context* context, SDL_TouchFingerEvent event) {
     if(event.type == SDL_EVENT_FINGER_DOWN || event.type == SDL_EVENT_FINGER_MOTION) {
         if(event.type == SDL_EVENT_FINGER_DOWN) {
             justPressedFingers.insert(event.fingerID);
         }
 
-        TA_Point position{event.x * TA::screenWidth, event.y * TA::screenHeight};
+        TA_Point position{event.x * context->screenWidth, event.y * context->screenHeight};
         if(!currentFingers.count(event.fingerID)) {
             currentFingers[event.fingerID].position = currentFingers[event.fingerID].startPosition = position;
         }
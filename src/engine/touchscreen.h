@@ -2,10 +2,11 @@
 #define TA_TOUCHSCREEN_H
 
 #include "SDL3/SDL.h"
+#include "context.h"
 #include "geometry.h"
 
 namespace TA::touchscreen {
-    void handleEvent(SDL_TouchFingerEvent event);
+    void handleEvent(TA_Context* context, SDL_TouchFingerEvent event);
     void update();
     bool isScrolling();
     TA_Point getScrollVector();
@@ -0,0 +1,76 @@
+#include "ui_layer.h"
+#include "cpu_renderer.h"
+#include "error.h"
+#include "profiler.h"
+#include "tools.h"
+
+void TA_UILayer::draw(TA_Context* context, long long newKey, const std::function<void()>& render) {
+    if(!context->renderingEnabled) {
+        return;
+    }
+
+    // the cpu renderer draws at native resolution
+    bool cpu = TA::cpuRenderer::isEnabled();
+    int scale = (cpu ? 1 : TA::scaleFactor);
+    int neededWidth = context->screenWidth * scale, neededHeight = context->screenHeight * scale;
+    if(texture == nullptr || width != neededWidth || height != neededHeight || cpuTexture != cpu) {
+        release();
+        cpuTexture = cpu;
+        width = neededWidth;
+        height = neededHeight;
+        create();
+    }
+
+    if(!valid || key != newKey) {
+        if(cpu) {
+            TA::cpuRenderer::beginCapture();
+            render();
+            TA::cpuRenderer::endCapture(texture);
+        } else {
+            SDL_Texture* target = SDL_GetRenderTarget(TA::renderer);
+            SDL_Rect viewport;
+            SDL_GetRenderViewport(TA::renderer, &viewport);
+            SDL_SetRenderTarget(TA::renderer, texture);
+            SDL_SetRenderViewport(TA::renderer, nullptr);
+            SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
+            SDL_RenderClear(TA::renderer);
+            render();
+            SDL_SetRenderTarget(TA::renderer, target);
+            SDL_SetRenderViewport(TA::renderer, &viewport);
+        }
+        key = newKey;
+        valid = true;
+    }
+
+    TA::profiler::addCounter(TA_COUNTER_DRAW_CALLS, 1);
+    if(cpu) {
+        TA::cpuRenderer::drawTexture(texture, {0, 0, width, height}, 0, 0, false, {255, 255, 255, 255});
+        return;
+    }
+    SDL_FRect dstRect{0, 0, static_cast<float>(width), static_cast<float>(height)};
+    SDL_RenderTexture(TA::renderer, texture, nullptr, &dstRect);
+}
+
+void TA_UILayer::create() {
+    // the cpu renderer keeps the pixels itself, the texture only names the image
+    if(cpuTexture) {
+        texture = SDL_CreateTexture(TA::renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    } else {
+        texture = SDL_CreateTexture(TA::renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    }
+    if(texture == nullptr) {
+        TA::handleSDLError("%s", "failed to create ui layer texture");
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    valid = false;
+}
+
+void TA_UILayer::release() {
+    if(texture == nullptr) {
+        return;
+    }
+    TA::cpuRenderer::unregisterTexture(texture);
+    SDL_DestroyTexture(texture);
+    texture = nullptr;
+}
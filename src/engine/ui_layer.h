@@ -0,0 +1,31 @@
+#ifndef TA_UI_LAYER_H
+#define TA_UI_LAYER_H
+
+#include <functional>
+#include "SDL3/SDL.h"
+#include "context.h"
+
+// the parts of a screen that only change on input, rendered once into a texture and then drawn as a single blit
+// the layer is opaque and covers the whole screen, so it goes first and the animated parts are drawn on top
+class TA_UILayer {
+private:
+    void create();
+    void release();
+
+    SDL_Texture* texture = nullptr;
+    int width = 0, height = 0;
+    long long key = 0;
+    bool valid = false, cpuTexture = false;
+
+public:
+    TA_UILayer() = default;
+    TA_UILayer(const TA_UILayer&) = delete;
+    TA_UILayer& operator=(const TA_UILayer&) = delete;
+    ~TA_UILayer() { release(); }
+
+    // calls render into the layer first if it was invalidated or key differs from the last render
+    void draw(TA_Context* context, long long newKey, const std::function<void()>& render);
+    void invalidate() { valid = false; }
+};
+
+#endif // TA_UI_LAYER_H
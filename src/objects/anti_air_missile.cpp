@@ -1,9 +1,8 @@
 #include "anti_air_missile.h"
 #include "explosion.h"
-#include "splash.h"
 
 void TA_AntiAirMissile::load(TA_Point position) {
-    loadFromToml("objects/anti_air_missile.toml");
+    loadFromToml(context, "objects/anti_air_missile.toml");
     hitbox.setRectangle({2, 2}, {14, 14});
     explosionSound.load("sound/explosion.ogg", TA_SOUND_CHANNEL_SFX3);
     this->position = position;
@@ -37,18 +36,18 @@ void TA_AntiAirMissile::load(TA_Point position) {
 
     float waterLevel = objectSet->getWaterLevel();
     if(position.y < waterLevel && position.y >= waterLevel - 16) {
-        objectSet->spawnObject<TA_Splash>(TA_Point(position.x, waterLevel - 16));
+        objectSet->getParticles().spawnSplash(TA_Point(position.x, waterLevel - 16));
     }
 }
 
 bool TA_AntiAirMissile::update() {
     if(!destroyed) {
         float waterLevel = objectSet->getWaterLevel();
-        if(position.y >= waterLevel && position.y + velocity.y * TA::elapsedTime < waterLevel) {
-            objectSet->spawnObject<TA_Splash>(position - TA_Point(0, 16));
+        if(position.y >= waterLevel && position.y + velocity.y * context->elapsedTime < waterLevel) {
+            objectSet->getParticles().spawnSplash(position - TA_Point(0, 16));
         }
 
-        position = position + velocity * TA::elapsedTime;
+        position = position + velocity * context->elapsedTime;
         updatePosition();
         if((position - objectSet->getCharacterPosition()).length() > 200) {
             return false;
@@ -59,9 +58,9 @@ bool TA_AntiAirMissile::update() {
             // TODO: explosion velocity
             for(int i = 1; i <= 3; i++) {
                 TA_Point explosionPosition =
-                    position + TA_Point(int(TA::random::next() % 7) - 3, int(TA::random::next() % 7) - 3);
+                    position + TA_Point(int(TA::random::next(context) % 7) - 3, int(TA::random::next(context) % 7) - 3);
                 float explosionAngle =
-                    static_cast<float>(TA::random::next()) / static_cast<float>(TA::random::max()) * TA::pi * 2;
+                    static_cast<float>(TA::random::next(context)) / static_cast<float>(TA::random::max()) * TA::pi * 2;
                 TA_Point explosionVelocty = {
                     std::cos(explosionAngle) * explosionSpeed, std::sin(explosionAngle) * explosionSpeed};
                 objectSet->spawnObject<TA_Explosion>(explosionPosition, i * 16, TA_EXPLOSION_NEUTRAL, explosionVelocty);
@@ -70,7 +69,7 @@ bool TA_AntiAirMissile::update() {
             destroyed = true;
         }
     } else {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > 10) {
             return false;
         }
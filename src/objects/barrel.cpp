@@ -1,9 +1,8 @@
 #include "barrel.h"
 #include "explosion.h"
-#include "splash.h"
 
 void TA_Barrel::load(TA_Point position, TA_Point velocity) {
-    loadFromToml("objects/cruiser/barrel.toml");
+    loadFromToml(context, "objects/cruiser/barrel.toml");
     this->position = position;
     this->velocity = velocity;
     hitbox.setRectangle({0, 0}, {8, 8});
@@ -19,18 +18,18 @@ bool TA_Barrel::update() {
     static constexpr float minXsp = 0.5;
 
     float waterLevel = objectSet->getWaterLevel();
-    velocity.y += gravity * TA::elapsedTime;
-    velocity.x -= drag * TA::elapsedTime;
+    velocity.y += gravity * context->elapsedTime;
+    velocity.x -= drag * context->elapsedTime;
     if(position.y >= waterLevel) {
         velocity.y = std::min(velocity.y, maxUnderwaterYsp);
     }
     velocity.x = std::max(velocity.x, minXsp);
 
-    if(position.y + 8 < waterLevel && position.y + 8 + velocity.y * TA::elapsedTime >= waterLevel) {
-        objectSet->spawnObject<TA_Splash>(position - TA_Point(4, 4));
+    if(position.y + 8 < waterLevel && position.y + 8 + velocity.y * context->elapsedTime >= waterLevel) {
+        objectSet->getParticles().spawnSplash(position - TA_Point(4, 4));
     }
 
-    position = position + velocity * TA::elapsedTime;
+    position = position + velocity * context->elapsedTime;
     updatePosition();
 
     if(position.y > 232 || (objectSet->checkCollision(hitbox) & TA_COLLISION_CHARACTER) != 0) {
@@ -4,7 +4,7 @@
 #include "tools.h"
 
 void TA_BatRobot::load(TA_Point newPosition) {
-    loadFromToml("objects/bat_robot.toml");
+    loadFromToml(context, "objects/bat_robot.toml");
     setAnimation("idle");
 
     position = newPosition;
@@ -28,7 +28,7 @@ bool TA_BatRobot::update() {
         case STATE_ACTIVE: {
             setAnimation("active");
             TA_Point characterPosition = objectSet->getCharacterPosition();
-            timer += TA::elapsedTime;
+            timer += context->elapsedTime;
             float centeredX = position.x + 12;
             float deltaY = characterPosition.y - position.y - 8;
             if(timer >= cooldownTime && 0 <= deltaY && deltaY <= 80 && abs(characterPosition.x - centeredX) <= 64) {
@@ -43,9 +43,9 @@ bool TA_BatRobot::update() {
 
         case STATE_ATTACK: {
             setAnimation("attack");
-            velocity.y += gravity * TA::elapsedTime;
-            auto [delta, flags] =
-                objectSet->moveAndCollide(position, {5, 0}, {18, 14}, velocity * TA::elapsedTime, TA_COLLISION_SOLID);
+            velocity.y += gravity * context->elapsedTime;
+            auto [delta, flags] = objectSet->moveAndCollide(
+                position, {5, 0}, {18, 14}, velocity * context->elapsedTime, TA_COLLISION_SOLID);
             position += delta;
             if(flags & TA_GROUND_COLLISION) {
                 velocity.y = std::min(float(0), velocity.y);
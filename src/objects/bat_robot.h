@@ -21,6 +21,8 @@ public:
     using TA_Object::TA_Object;
     void load(TA_Point newPosition);
     bool update() override;
+    TA_ActivationPolicy getActivationPolicy() override { return TA_ACTIVATION_TRIGGER; }
+    float getWakeRadius() override { return 160; }
 };
 
 #endif // TA_BAT_ROBOT_H
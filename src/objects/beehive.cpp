@@ -6,7 +6,7 @@
 #include "tools.h"
 
 void TA_BeeHive::load(TA_Point position) {
-    loadFromToml("objects/beehive.toml");
+    loadFromToml(context, "objects/beehive.toml");
     setAnimation("beehive");
 
     hitbox.setRectangle(TA_Point(2, 2), TA_Point(14, 14));
@@ -22,11 +22,11 @@ bool TA_BeeHive::update() {
             beeCount++;
             timer = 0;
         } else {
-            timer += TA::elapsedTime;
+            timer += context->elapsedTime;
         }
     }
 
-    if(!destroyed && (objectSet->checkCollision(hitbox) & (TA_COLLISION_ATTACK | TA_COLLISION_NAPALM)) != 0) {
+    if(!destroyed && (getContactFlags() & (TA_COLLISION_ATTACK | TA_COLLISION_NAPALM)) != 0) {
         objectSet->spawnObject<TA_StrongBee>(position);
         objectSet->spawnObject<TA_Explosion>(position, 0, TA_EXPLOSION_NEUTRAL);
         destroyed = true;
@@ -41,7 +41,7 @@ bool TA_BeeHive::update() {
 }
 
 void TA_Bee::load(TA_Point position, TA_BeeHive* hive) {
-    loadFromToml("objects/beehive.toml");
+    loadFromToml(context, "objects/beehive.toml");
     setAnimation("bee");
 
     hitbox.setRectangle(TA_Point(4, 4), TA_Point(12, 12));
@@ -51,7 +51,7 @@ void TA_Bee::load(TA_Point position, TA_BeeHive* hive) {
     updatePosition();
 
     flyDownY = position.y + 48;
-    direction = (TA::random::next() % 2 == 0);
+    direction = (TA::random::next(context) % 2 == 0);
     leftCircle = !direction;
 }
 
@@ -72,7 +72,7 @@ bool TA_Bee::update() {
 }
 
 void TA_Bee::updateFlyDown() {
-    position.y += flySpeed * TA::elapsedTime;
+    position.y += flySpeed * context->elapsedTime;
     if(position.y > flyDownY) {
         position.y = flyDownY;
         flyDown = false;
@@ -84,7 +84,7 @@ void TA_Bee::updateFlyDown() {
 void TA_Bee::updateNormal() {
     static constexpr float circleTime = 2 * TA::pi * circleRadius / flySpeed;
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > circleTime) {
         timer -= circleTime;
         leftCircle = !leftCircle;
@@ -109,7 +109,7 @@ void TA_Bee::updateNormal() {
 }
 
 void TA_StrongBee::load(TA_Point position) {
-    loadFromToml("objects/beehive.toml");
+    loadFromToml(context, "objects/beehive.toml");
     setAnimation("strong_bee");
 
     hitbox.setRectangle(TA_Point(4, 4), TA_Point(12, 12));
@@ -121,16 +121,16 @@ void TA_StrongBee::load(TA_Point position) {
 
 bool TA_StrongBee::update() {
     if(timer < idleTime) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         return true;
     }
 
     float neededAngle = getNeedeedAngle();
     float leftDist = std::fmod(angle - neededAngle + TA::pi * 2, TA::pi * 2);
     float rightDist = std::fmod(neededAngle - angle + TA::pi * 2, TA::pi * 2);
-    angle += rotateSpeed * (leftDist < rightDist ? -1 : 1) * TA::elapsedTime;
+    angle += rotateSpeed * (leftDist < rightDist ? -1 : 1) * context->elapsedTime;
     angle = std::fmod(angle + TA::pi * 2, TA::pi * 2);
-    position = position + TA_Point(std::cos(angle), std::sin(angle)) * speed * TA::elapsedTime;
+    position = position + TA_Point(std::cos(angle), std::sin(angle)) * speed * context->elapsedTime;
     setFlip(std::cos(angle) > 0);
     updatePosition();
 
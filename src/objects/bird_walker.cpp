@@ -8,17 +8,17 @@
 #include "tools.h"
 
 void TA_BirdWalker::load(float newFloorY) {
-    if(TA::save::getSaveParameter("boss_mask") & (1ll << 0)) {
+    if(TA::save::getSaveParameter(context, "boss_mask") & (1ll << 0)) {
         return;
     }
 
     floorY = newFloorY;
-    headSprite.loadFromToml("objects/bird_walker/head.toml");
-    headFlashSprite.loadFromToml("objects/bird_walker/head.toml");
-    bodySprite.load("objects/bird_walker/body.png", 40, 32);
-    bodyFlashSprite.load("objects/bird_walker/body.png", 40, 32);
-    feetSprite.loadFromToml("objects/bird_walker/feet.toml");
-    feetFlashSprite.loadFromToml("objects/bird_walker/feet.toml");
+    headSprite.loadFromToml(context, "objects/bird_walker/head.toml");
+    headFlashSprite.loadFromToml(context, "objects/bird_walker/head.toml");
+    bodySprite.load(context, "objects/bird_walker/body.png", 40, 32);
+    bodyFlashSprite.load(context, "objects/bird_walker/body.png", 40, 32);
+    feetSprite.loadFromToml(context, "objects/bird_walker/feet.toml");
+    feetFlashSprite.loadFromToml(context, "objects/bird_walker/feet.toml");
 
     jumpSound.load("sound/jump.ogg", TA_SOUND_CHANNEL_SFX2);
     fallSound.load("sound/fall.ogg", TA_SOUND_CHANNEL_SFX2);
@@ -49,9 +49,9 @@ void TA_BirdWalker::load(float newFloorY) {
     flipHitboxVector.push_back({bodyHitbox, TA_COLLISION_DAMAGE | TA_COLLISION_TARGET});
 
     hitbox.setPosition(TA_Point(0, 0));
-    hitbox.setRectangle(TA_Point(TA::screenWidth + 576, 0), TA_Point(TA::screenWidth + 592, 448));
+    hitbox.setRectangle(TA_Point(context->screenWidth + 576, 0), TA_Point(context->screenWidth + 592, 448));
     collisionType = TA_COLLISION_SOLID;
-    objectSet->getLinks().camera->setLockPosition(TA_Point(576, 64 - ((TA::screenHeight - 144) / 2)));
+    objectSet->getLinks().camera->setLockPosition(TA_Point(576, 64 - ((context->screenHeight - 144) / 2)));
 }
 
 void TA_BirdWalker::updatePosition() {
@@ -100,15 +100,17 @@ void TA_BirdWalker::insertBorderHitboxes() {
     TA_Rect borderHitbox;
     TA_Point cameraPosition = objectSet->getLinks().camera->getPosition();
 
-    borderHitbox.setRectangle(cameraPosition + TA_Point(-16, -16), cameraPosition + TA_Point(0, TA::screenHeight + 16));
+    borderHitbox.setRectangle(
+        cameraPosition + TA_Point(-16, -16), cameraPosition + TA_Point(0, context->screenHeight + 16));
     hitboxVector.push_back({borderHitbox, TA_COLLISION_SOLID});
 
-    borderHitbox.setRectangle(cameraPosition + TA_Point(-16, -16), cameraPosition + TA_Point(TA::screenWidth + 16, 0));
+    borderHitbox.setRectangle(
+        cameraPosition + TA_Point(-16, -16), cameraPosition + TA_Point(context->screenWidth + 16, 0));
     hitboxVector.push_back({borderHitbox, TA_COLLISION_SOLID});
 }
 
 bool TA_BirdWalker::update() {
-    if(TA::save::getSaveParameter("boss_mask") & (1ll << 0)) {
+    if(TA::save::getSaveParameter(context, "boss_mask") & (1ll << 0)) {
         return false;
     }
 
@@ -116,8 +118,9 @@ bool TA_BirdWalker::update() {
         timer = 0;
         aimPosition.y = floorY - 20;
 
-        if(objectSet->getCharacterPosition().x < objectSet->getLinks().camera->getPosition().x + TA::screenWidth / 2) {
-            aimPosition.x = objectSet->getLinks().camera->getPosition().x + TA::screenWidth - aimBorder - 12;
+        if(objectSet->getCharacterPosition().x <
+            objectSet->getLinks().camera->getPosition().x + context->screenWidth / 2) {
+            aimPosition.x = objectSet->getLinks().camera->getPosition().x + context->screenWidth - aimBorder - 12;
         } else {
             aimPosition.x = objectSet->getLinks().camera->getPosition().x + aimBorder;
         }
@@ -125,14 +128,14 @@ bool TA_BirdWalker::update() {
         state = TA_BIRD_WALKER_STATE_AIMING;
     };
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(flashTimer < damageFlashTime * 4) {
-        flashTimer += TA::elapsedTime;
+        flashTimer += context->elapsedTime;
     }
 
     float centeredX = position.x + bodySprite.getWidth() / 2;
     if(TA::sign(int(centeredX - objectSet->getCharacterPosition().x)) == (flip ? 1 : -1)) {
-        jumpTimer += TA::elapsedTime;
+        jumpTimer += context->elapsedTime;
     } else {
         jumpTimer = 0;
     }
@@ -161,7 +164,7 @@ bool TA_BirdWalker::update() {
 
         case TA_BIRD_WALKER_STATE_LANDING: {
             position.x = aimPosition.x - 12;
-            position.y = floorY - std::max(float(0), TA::screenHeight * (1 - timer / flyingTime));
+            position.y = floorY - std::max(float(0), context->screenHeight * (1 - timer / flyingTime));
             if(timer > flyingTime) {
                 timer = 0;
                 feetSprite.setFrame(4);
@@ -204,7 +207,7 @@ bool TA_BirdWalker::update() {
             feetSprite.setAnimation("walk");
             float centeredPosition = position.x + bodySprite.getWidth() / 2;
             float leftBorder = objectSet->getLinks().camera->getPosition().x + walkBorder;
-            float rightBorder = objectSet->getLinks().camera->getPosition().x + TA::screenWidth - walkBorder;
+            float rightBorder = objectSet->getLinks().camera->getPosition().x + context->screenWidth - walkBorder;
 
             if((!flip && centeredPosition < leftBorder) || (flip && centeredPosition > rightBorder) ||
                 currentWalkDistance > walkDistance) {
@@ -215,14 +218,14 @@ bool TA_BirdWalker::update() {
                     headSprite.setAnimation("turn");
                     state = TA_BIRD_WALKER_STATE_LAUGH;
                 } else if((centeredPosition < objectSet->getCharacterPosition().x) == flip &&
-                          TA::random::next() % 3 == 0) {
+                          TA::random::next(context) % 3 == 0) {
                     state = TA_BIRD_WALKER_STATE_FIRE_LONG;
                 } else {
                     state = TA_BIRD_WALKER_STATE_FIRE_SHORT;
                 }
             } else {
-                position.x += walkSpeed * TA::elapsedTime * (flip ? 1 : -1);
-                currentWalkDistance += walkSpeed * TA::elapsedTime;
+                position.x += walkSpeed * context->elapsedTime * (flip ? 1 : -1);
+                currentWalkDistance += walkSpeed * context->elapsedTime;
             }
 
             break;
@@ -233,7 +236,7 @@ bool TA_BirdWalker::update() {
                 if(bulletCounter == shortFireBullets) {
                     state = TA_BIRD_WALKER_STATE_COOL_DOWN;
                 } else {
-                    float angle = float(TA::random::next()) / TA::random::max() * maxFireAngle;
+                    float angle = float(TA::random::next(context)) / TA::random::max() * maxFireAngle;
                     TA_Point velocity(bulletSpeed * cos(angle) * (flip ? 1 : -1), bulletSpeed * sin(angle));
                     objectSet->spawnObject<TA_BirdWalkerBullet>(position + TA_Point((flip ? 30 : -6), -64), velocity);
                     bulletCounter++;
@@ -251,7 +254,7 @@ bool TA_BirdWalker::update() {
                     feetSprite.setFrame(0);
                     state = TA_BIRD_WALKER_STATE_COOL_DOWN;
                 } else {
-                    float angle = float(TA::random::next()) / TA::random::max() * maxFireAngle;
+                    float angle = float(TA::random::next(context)) / TA::random::max() * maxFireAngle;
                     TA_Point velocity(bulletSpeed * cos(angle) * (flip ? 1 : -1), bulletSpeed * sin(angle));
                     objectSet->spawnObject<TA_BirdWalkerBullet>(position + TA_Point((flip ? 30 : -6), -55), velocity);
                     bulletCounter++;
@@ -278,7 +281,7 @@ bool TA_BirdWalker::update() {
         case TA_BIRD_WALKER_STATE_FLYING_UP: {
             if(timer > crouchTime) {
                 feetSprite.setFrame(0);
-                position.y = floorY - TA::screenHeight * (timer - crouchTime) / flyingTime;
+                position.y = floorY - context->screenHeight * (timer - crouchTime) / flyingTime;
             }
             if(timer > crouchTime + flyingTime) {
                 initAiming();
@@ -328,12 +331,12 @@ bool TA_BirdWalker::update() {
                     break;
             }
 
-            int previousStep = (timer - TA::elapsedTime) / deathExplosionDelay;
+            int previousStep = (timer - context->elapsedTime) / deathExplosionDelay;
             int currentStep = timer / deathExplosionDelay;
             if(previousStep != currentStep) {
                 TA_Point explosionPosition;
-                explosionPosition.x = left + TA::random::next() % (right - left + 1) - 8;
-                explosionPosition.y = top + TA::random::next() % (bottom - top + 1) - 8;
+                explosionPosition.x = left + TA::random::next(context) % (right - left + 1) - 8;
+                explosionPosition.y = top + TA::random::next(context) % (bottom - top + 1) - 8;
                 objectSet->spawnObject<TA_Explosion>(explosionPosition);
             }
 
@@ -342,9 +345,9 @@ bool TA_BirdWalker::update() {
                 TA::sound::fadeOutChannel(TA_SOUND_CHANNEL_SFX3, 0);
                 TA::sound::playMusic("sound/pf.vgm");
 
-                long long bossMask = TA::save::getSaveParameter("boss_mask");
+                long long bossMask = TA::save::getSaveParameter(context, "boss_mask");
                 bossMask |= (1ll << 0);
-                TA::save::setSaveParameter("boss_mask", bossMask);
+                TA::save::setSaveParameter(context, "boss_mask", bossMask);
 
                 return false;
             }
@@ -378,7 +381,7 @@ bool TA_BirdWalker::update() {
 
 void TA_BirdWalker::updateDamage() {
     if(invincibleTimeLeft > 0) {
-        invincibleTimeLeft -= TA::elapsedTime;
+        invincibleTimeLeft -= context->elapsedTime;
     } else if(state != TA_BIRD_WALKER_STATE_AIMING && state != TA_BIRD_WALKER_STATE_FLYING_UP &&
               state != TA_BIRD_WALKER_STATE_LANDING && state != TA_BIRD_WALKER_STATE_DEAD) {
         if(objectSet->checkCollision(weakHitbox) & TA_COLLISION_ATTACK) {
@@ -398,10 +401,6 @@ void TA_BirdWalker::updateDamage() {
 }
 
 void TA_BirdWalker::draw() {
-    headSprite.setUpdateAnimation(!objectSet->isPaused());
-    bodySprite.setUpdateAnimation(!objectSet->isPaused());
-    feetSprite.setUpdateAnimation(!objectSet->isPaused());
-
     if(state == TA_BIRD_WALKER_STATE_IDLE) {
         return;
     }
@@ -413,3 +412,10 @@ void TA_BirdWalker::draw() {
     bodyFlashSprite.draw();
     feetFlashSprite.draw();
 }
+
+void TA_BirdWalker::setPaused(bool paused) {
+    TA_Object::setPaused(paused);
+    headSprite.setUpdateAnimation(!paused);
+    bodySprite.setUpdateAnimation(!paused);
+    feetSprite.setUpdateAnimation(!paused);
+}
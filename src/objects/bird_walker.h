@@ -61,6 +61,8 @@ public:
     void load(float newFloorY);
     bool update() override;
     void draw() override;
+    void setPaused(bool paused) override;
+    bool isCullable() override { return false; }
     int getDrawPriority() override { return 1; }
 };
 
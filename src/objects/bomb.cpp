@@ -6,7 +6,7 @@
 #include "tools.h"
 
 void TA_Bomb::load(TA_Point newPosition, bool newDirection, TA_BombMode newMode) {
-    loadFromToml("objects/bomb.toml");
+    loadFromToml(context, "objects/bomb.toml");
     explosionSound.load("sound/explosion.ogg", TA_SOUND_CHANNEL_SFX3);
 
     position = newPosition;
@@ -39,7 +39,7 @@ void TA_Bomb::load(TA_Point newPosition, bool newDirection, TA_BombMode newMode)
 
 bool TA_Bomb::update() {
     bool flag1 = (timer <= moveTime);
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     bool flag2 = (timer >= moveTime);
 
     if(flag1 && flag2) {
@@ -52,7 +52,7 @@ bool TA_Bomb::update() {
     }
 
     if(timer >= moveTime) {
-        velocity.y += grv * speed * speed * TA::elapsedTime;
+        velocity.y += grv * speed * speed * context->elapsedTime;
 
         TA_Point velocityAdd = TA_Point(0, 0);
         if(ground) {
@@ -66,7 +66,7 @@ bool TA_Bomb::update() {
         }
 
         auto [delta, moveFlags] = objectSet->moveAndCollide(position, topLeft, bottomRight,
-            (velocity + velocityAdd) * TA::elapsedTime,
+            (velocity + velocityAdd) * context->elapsedTime,
             TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_PUSHABLE | TA_COLLISION_MOVING_PLATFORM, ground);
         position += delta;
 
@@ -110,7 +110,7 @@ void TA_Bomb::explode() {
     explosionSound.play();
     for(int i = 1; i <= 3; i++) {
         TA_Point explosionPosition =
-            position + TA_Point(int(TA::random::next() % 7) - 3, int(TA::random::next() % 7) - 3);
+            position + TA_Point(int(TA::random::next(context) % 7) - 3, int(TA::random::next(context) % 7) - 3);
         objectSet->spawnObject<TA_Explosion>(explosionPosition, i * 16, TA_EXPLOSION_NEUTRAL);
     }
 }
@@ -142,9 +142,9 @@ bool TA_RemoteBomb::shouldExplode() {
 bool TA_RemoteBomb::update() {
     if(TA::equal(velocity.y, 0)) {
         if(velocity.x > 0) {
-            velocity.x = std::max(float(0), velocity.x - friction * speed * speed * TA::elapsedTime);
+            velocity.x = std::max(float(0), velocity.x - friction * speed * speed * context->elapsedTime);
         } else {
-            velocity.x = std::min(float(0), velocity.x + friction * speed * speed * TA::elapsedTime);
+            velocity.x = std::min(float(0), velocity.x + friction * speed * speed * context->elapsedTime);
         }
     }
 
@@ -184,7 +184,7 @@ void TA_TripleBomb::load(TA_Point newPosition, bool newDirection, TA_BombMode mo
 
 bool TA_TripleBomb::update() {
     if(active) {
-        const float newTimer = timer + TA::elapsedTime;
+        const float newTimer = timer + context->elapsedTime;
         if(timer < explodeInterval && newTimer > explodeInterval) {
             explode();
             timer = newTimer;
@@ -68,6 +68,7 @@ public:
     void load(TA_Point newPosition, bool newDirection, TA_BombMode mode) override;
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     static constexpr float explodeInterval = 7;
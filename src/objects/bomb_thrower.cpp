@@ -8,7 +8,7 @@ void TA_BombThrower::load(TA_Point position, float leftX, float rightX) {
     this->leftX = leftX;
     this->rightX = rightX;
 
-    loadFromToml("objects/bomb_thrower.toml");
+    loadFromToml(context, "objects/bomb_thrower.toml");
     hitbox.setRectangle(TA_Point(1, 2), TA_Point(14, 26));
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
     updatePosition();
@@ -40,7 +40,7 @@ bool TA_BombThrower::update() {
 }
 
 void TA_BombThrower::updateIdle() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     TA_Point distance = getDistanceToCharacter();
 
     if(timer > idleTime && distance.x < 0 && abs(distance.x) <= 160 && abs(distance.y) <= 90) {
@@ -53,7 +53,7 @@ void TA_BombThrower::updateIdle() {
 }
 
 void TA_BombThrower::updateWalkForward() {
-    position.x -= speed * TA::elapsedTime;
+    position.x -= speed * context->elapsedTime;
     TA_Point distance = getDistanceToCharacter();
 
     if(position.x < leftX || ((distance.x < 0 && abs(distance.x) <= 54) && abs(distance.y) <= 48)) {
@@ -82,8 +82,8 @@ void TA_BombThrower::updateAttack() {
 }
 
 void TA_BombThrower::updateWalkBack() {
-    position.x += speed * TA::elapsedTime;
-    timer += TA::elapsedTime;
+    position.x += speed * context->elapsedTime;
+    timer += context->elapsedTime;
 
     if(position.x > rightX || timer > walkBackTime) {
         position.x = std::min(position.x, rightX);
@@ -116,15 +116,15 @@ void TA_BombThrower::destroy() {
 
 void TA_EnemyBomb::load(TA_Point position) {
     this->position = position;
-    TA_Sprite::load("objects/enemy_bomb.png");
+    TA_Sprite::load(context, "objects/enemy_bomb.png");
     hitbox.setRectangle(topLeft - TA_Point(0.5, 0.5), bottomRight + TA_Point(0.5, 0.5));
     collisionType = TA_COLLISION_DAMAGE;
     updatePosition();
 }
 
 bool TA_EnemyBomb::update() {
-    velocity.y += grv * TA::elapsedTime;
-    auto [delta, flags] = objectSet->moveAndCollide(position, topLeft, bottomRight, velocity * TA::elapsedTime,
+    velocity.y += grv * context->elapsedTime;
+    auto [delta, flags] = objectSet->moveAndCollide(position, topLeft, bottomRight, velocity * context->elapsedTime,
         TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_CHARACTER);
     position += delta;
 
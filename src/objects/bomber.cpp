@@ -1,11 +1,10 @@
 #include "bomber.h"
 #include "dead_kukku.h"
 #include "explosion.h"
-#include "splash.h"
 #include "tilemap.h"
 
 void TA_Bomber::load(float aimX, float maxY) {
-    loadFromToml("objects/bomber.toml");
+    loadFromToml(context, "objects/bomber.toml");
     hitbox.setRectangle({2, 2}, {22, 30});
     collisionType = TA_COLLISION_TRANSPARENT;
     this->aimX = aimX;
@@ -58,17 +57,17 @@ void TA_Bomber::updateIdle() {
 }
 
 void TA_Bomber::updateFly() {
-    velocity.y -= gravity * TA::elapsedTime;
+    velocity.y -= gravity * context->elapsedTime;
     if(velocity.y < 0) {
         timer = 0;
         state = State::PRE_ATTACK;
     } else {
-        position += velocity * TA::elapsedTime;
+        position += velocity * context->elapsedTime;
     }
 }
 
 void TA_Bomber::updatePreAttack() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > attackTime) {
         objectSet->spawnObject<TA_BomberBomb>(position + TA_Point(8, 23));
         setAnimation("fly_away");
@@ -78,7 +77,7 @@ void TA_Bomber::updatePreAttack() {
 }
 
 void TA_Bomber::updatePostAttack() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > attackTime) {
         timer = 0;
         state = State::FLY_AWAY;
@@ -86,8 +85,8 @@ void TA_Bomber::updatePostAttack() {
 }
 
 void TA_Bomber::updateFlyAway() {
-    velocity.y -= gravity * TA::elapsedTime;
-    position += velocity * TA::elapsedTime;
+    velocity.y -= gravity * context->elapsedTime;
+    position += velocity * context->elapsedTime;
     if(position.y < objectSet->getLinks().camera->getPosition().y - static_cast<float>(getHeight()) - 1) {
         state = State::IDLE;
     }
@@ -100,22 +99,22 @@ void TA_Bomber::draw() {
 }
 
 void TA_BomberBomb::load(TA_Point position) {
-    loadFromToml("objects/bomber_bomb.toml");
+    loadFromToml(context, "objects/bomber_bomb.toml");
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(4, 8));
     collisionType = TA_COLLISION_DAMAGE;
     this->position = position;
 }
 
 bool TA_BomberBomb::update() {
-    velocity.y = std::min(maxYSpeed, velocity.y + gravity * TA::elapsedTime);
+    velocity.y = std::min(maxYSpeed, velocity.y + gravity * context->elapsedTime);
 
     float waterLevel = objectSet->getWaterLevel();
-    if(position.y + 8 < waterLevel && position.y + 8 + velocity.y * TA::elapsedTime >= waterLevel) {
-        objectSet->spawnObject<TA_Splash>(position - TA_Point(6, 4));
+    if(position.y + 8 < waterLevel && position.y + 8 + velocity.y * context->elapsedTime >= waterLevel) {
+        objectSet->getParticles().spawnSplash(position - TA_Point(6, 4));
     }
 
     auto [delta, flags] = objectSet->moveAndCollide(
-        position, {0, 0}, {4, 8}, velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_CHARACTER);
+        position, {0, 0}, {4, 8}, velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_CHARACTER);
     position += delta;
     if(flags & (TA_GROUND_COLLISION | TA_WALL_COLLISION)) {
         objectSet->spawnObject<TA_Explosion>(position - TA_Point(6, 4), 0, TA_EXPLOSION_ENEMY);
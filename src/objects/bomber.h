@@ -9,6 +9,7 @@ public:
     void load(float aimX, float maxY);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     static constexpr float startYSpeed = 3.2; // TODO: depend on screen height to make it more fair
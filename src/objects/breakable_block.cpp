@@ -1,10 +1,9 @@
 #include "breakable_block.h"
-#include "particle.h"
 #include "ring.h"
 
 void TA_BreakableBlock::load(
     std::string path, std::string particlePath, TA_Point position, bool dropsRing, bool strong) {
-    TA_Sprite::load(path);
+    TA_Sprite::load(context, path);
     this->particlePath = particlePath;
     this->position = position;
     this->dropsRing = dropsRing;
@@ -35,13 +34,13 @@ bool TA_BreakableBlock::update() {
     }
 
     if(shouldBreak) { // TODO: particles positions should depend on block size
-        objectSet->spawnObject<TA_Particle>(
+        objectSet->getParticles().spawnDebris(
             particlePath, position + TA_Point(2, 2), TA_Point(-0.5, -2), TA_Point(0, grv));
-        objectSet->spawnObject<TA_Particle>(
+        objectSet->getParticles().spawnDebris(
             particlePath, position + TA_Point(8, 2), TA_Point(0.5, -2), TA_Point(0, grv));
-        objectSet->spawnObject<TA_Particle>(
+        objectSet->getParticles().spawnDebris(
             particlePath, position + TA_Point(2, 8), TA_Point(-0.5, -0.5), TA_Point(0, grv));
-        objectSet->spawnObject<TA_Particle>(
+        objectSet->getParticles().spawnDebris(
             particlePath, position + TA_Point(8, 8), TA_Point(0.5, -0.5), TA_Point(0, grv));
         objectSet->resetInstaShield();
         if(dropsRing) {
@@ -16,6 +16,7 @@ public:
     void load(std::string path, std::string particlePath, TA_Point position, bool dropsRing, bool strong);
     bool update() override;
     int getDrawPriority() override { return 0; }
+    TA_ActivationPolicy getActivationPolicy() override { return TA_ACTIVATION_NEAR_CAMERA; }
 };
 
 #endif // TA_BREAKABLE_BLOCK_H
@@ -1,10 +1,9 @@
 #include "bridge.h"
-#include "particle.h"
 #include "tilemap.h"
 #include "tools.h"
 
 void TA_Bridge::load(TA_Point newPosition, std::string filename, std::string newParticleFilename) {
-    TA_Sprite::load(filename, 16, 16);
+    TA_Sprite::load(context, filename, 16, 16);
     position = newPosition;
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(16, 16));
     collisionType = TA_COLLISION_SOLID_UP | TA_COLLISION_UNSTABLE;
@@ -26,26 +25,26 @@ bool TA_Bridge::update() {
             break;
 
         case TA_BRIDGE_STATE_DELAY:
-            timer += TA::elapsedTime;
+            timer += context->elapsedTime;
             if(timer > delayTime) {
                 state = TA_BRIDGE_STATE_FALLING;
                 collisionType = TA_COLLISION_TRANSPARENT;
                 TA_Sprite::setFrame(1);
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particleFilename, position + TA_Point(0, 10), TA_Point(0, initialSpeed), TA_Point(0, grv));
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particleFilename, position + TA_Point(10, 10), TA_Point(0, initialSpeed), TA_Point(0, grv), 4);
                 timer = 0;
             }
             break;
 
         case TA_BRIDGE_STATE_FALLING:
-            timer += TA::elapsedTime;
+            timer += context->elapsedTime;
             TA_Sprite::setAlpha(255 - 255 * pow(timer / fallingTime, 6));
             if(timer > fallingTime / 2 && !particlesThrown) {
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particleFilename, position, TA_Point(0, initialSpeed), TA_Point(0, grv));
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particleFilename, position + TA_Point(10, 0), TA_Point(0, initialSpeed), TA_Point(0, grv), 4);
                 particlesThrown = true;
             }
@@ -23,6 +23,9 @@ public:
     using TA_Object::TA_Object;
     void load(TA_Point newPosition, std::string filename, std::string newParticleFilename);
     bool update() override;
+    TA_ActivationPolicy getActivationPolicy() override {
+        return (state == TA_BRIDGE_STATE_IDLE ? TA_ACTIVATION_NEAR_CAMERA : TA_ACTIVATION_ALWAYS);
+    }
 };
 
 #endif // TA_BRIDGE_H
@@ -26,63 +26,4 @@ public:
     bool update() override;
 };
 
-class TA_VulcanGunBullet : public TA_Bullet {
-private:
-    const float existTime = 15;
-
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_TARGET; }
-
-    TA_Sound explosionSound;
-    float timer = 0;
-
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    bool update() override;
-    void onDestroy() override;
-};
-
-class TA_SniperBullet : public TA_Bullet {
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    void onDestroy() override;
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_CHARACTER; }
-};
-
-class TA_HeavyGunBullet : public TA_Bullet {
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    void onDestroy() override;
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_CHARACTER; }
-};
-
-class TA_PilotBullet : public TA_Bullet {
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    void onDestroy() override;
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_CHARACTER; }
-};
-
-class TA_DrFukurokovLazer : public TA_Bullet {
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    void onDestroy() override;
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_CHARACTER; }
-};
-
-class TA_MechaGolemBullet : public TA_Bullet {
-public:
-    using TA_Bullet::TA_Bullet;
-    void load(TA_Point position, TA_Point velocity);
-    void onDestroy() override;
-    int getCollisionFlags() override { return TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_CHARACTER; }
-
-private:
-    TA_Sound explosionSound;
-};
-
 #endif // TA_BULLET_H
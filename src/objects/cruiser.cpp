@@ -7,14 +7,14 @@
 #include "transition.h"
 
 void TA_Cruiser::load() {
-    loadFromToml("objects/cruiser/cruiser.toml");
+    loadFromToml(context, "objects/cruiser/cruiser.toml");
     hitbox.setRectangle({16, 45}, {164, 94});
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
-    position = {TA::screenWidth + 64, 62};
+    position = {context->screenWidth + 64, 62};
 
-    watcherSprite.loadFromToml("objects/cruiser/watcher.toml");
-    leftThrowerSprite.loadFromToml("objects/rock_thrower.toml");
-    rightThrowerSprite.loadFromToml("objects/rock_thrower.toml");
+    watcherSprite.loadFromToml(context, "objects/cruiser/watcher.toml");
+    leftThrowerSprite.loadFromToml(context, "objects/rock_thrower.toml");
+    rightThrowerSprite.loadFromToml(context, "objects/rock_thrower.toml");
     watcherSprite.setCamera(objectSet->getLinks().camera);
     watcherSprite.setAnimation("idle");
     leftThrowerSprite.setCamera(objectSet->getLinks().camera);
@@ -25,16 +25,16 @@ void TA_Cruiser::load() {
     rightThrowerSprite.setFlip(true);
 
     hitboxVector.assign(2, HitboxVectorElement());
-    hitboxVector[0].hitbox.setRectangle({-16, 0}, {0, TA::screenHeight});
+    hitboxVector[0].hitbox.setRectangle({-16, 0}, {0, context->screenHeight});
     hitboxVector[0].collisionType = TA_COLLISION_SOLID;
-    hitboxVector[1].hitbox.setRectangle({0, 0}, {16, TA::screenHeight});
+    hitboxVector[1].hitbox.setRectangle({0, 0}, {16, context->screenHeight});
     hitboxVector[1].collisionType = TA_COLLISION_SOLID;
 
     hitSound.load("sound/hit.ogg", TA_SOUND_CHANNEL_SFX3);
 
     updatePosition();
     updateBorderPosition();
-    lockPosition = {32, 240 - TA::screenHeight};
+    lockPosition = {32, 240 - context->screenHeight};
     objectSet->getLinks().camera->setLockPosition(lockPosition);
 }
 
@@ -61,19 +61,22 @@ bool TA_Cruiser::update() {
 }
 
 void TA_Cruiser::draw() {
-    watcherSprite.setUpdateAnimation(!objectSet->isPaused());
-    leftThrowerSprite.setUpdateAnimation(!objectSet->isPaused());
-    rightThrowerSprite.setUpdateAnimation(!objectSet->isPaused());
-
     TA_Object::draw();
     watcherSprite.draw();
     leftThrowerSprite.draw();
     rightThrowerSprite.draw();
 }
 
+void TA_Cruiser::setPaused(bool paused) {
+    TA_Object::setPaused(paused);
+    watcherSprite.setUpdateAnimation(!paused);
+    leftThrowerSprite.setUpdateAnimation(!paused);
+    rightThrowerSprite.setUpdateAnimation(!paused);
+}
+
 void TA_Cruiser::updateBorderPosition() {
     hitboxVector[0].hitbox.setPosition(lockPosition);
-    hitboxVector[1].hitbox.setPosition(lockPosition + TA_Point(TA::screenWidth, 0));
+    hitboxVector[1].hitbox.setPosition(lockPosition + TA_Point(context->screenWidth, 0));
 }
 
 void TA_Cruiser::updateBirds() {
@@ -83,12 +86,12 @@ void TA_Cruiser::updateBirds() {
 
     if(state == State::ACTIVE && cameraNormalized) {
         if(leftThrowerSprite.getCurrentFrame() == 0 && leftThrowerPrevFrame == 1) {
-            objectSet->spawnObject<TA_Barrel>(
-                leftThrowerSprite.getPosition() + TA_Point(12, 4), TA_Point(1 + 0.1 * (TA::random::next() % 20), -2));
+            objectSet->spawnObject<TA_Barrel>(leftThrowerSprite.getPosition() + TA_Point(12, 4),
+                TA_Point(1 + 0.1 * (TA::random::next(context) % 20), -2));
         }
         if(rightThrowerSprite.getCurrentFrame() == 0 && rightThrowerPrevFrame == 1) {
-            objectSet->spawnObject<TA_Barrel>(
-                rightThrowerSprite.getPosition() + TA_Point(12, 4), TA_Point(1 + 0.1 * (TA::random::next() % 25), -2));
+            objectSet->spawnObject<TA_Barrel>(rightThrowerSprite.getPosition() + TA_Point(12, 4),
+                TA_Point(1 + 0.1 * (TA::random::next(context) % 25), -2));
         }
         leftThrowerPrevFrame = leftThrowerSprite.getCurrentFrame();
         rightThrowerPrevFrame = rightThrowerSprite.getCurrentFrame();
@@ -103,13 +106,13 @@ void TA_Cruiser::updateIdle() {
 }
 
 void TA_Cruiser::updateActive() {
-    position.x += TA::elapsedTime * 1.5F;
+    position.x += context->elapsedTime * 1.5F;
     float center = position.x + 104;
     if(cameraNormalized) {
-        lockPosition.x += TA::elapsedTime * 1.5F;
+        lockPosition.x += context->elapsedTime * 1.5F;
     } else {
-        lockPosition.x += TA::elapsedTime * 2;
-        if(lockPosition.x > center - TA::screenWidth / 2) {
+        lockPosition.x += context->elapsedTime * 2;
+        if(lockPosition.x > center - context->screenWidth / 2) {
             cameraNormalized = true;
         }
     }
@@ -135,9 +138,9 @@ void TA_Cruiser::updateDamage() {
 }
 
 void TA_Cruiser::updateDestroyed() {
-    position.x += speed * TA::elapsedTime;
-    speed = std::max(0.0F, speed - 0.005F * TA::elapsedTime);
-    lockPosition.x += TA::elapsedTime * 1.5F;
+    position.x += speed * context->elapsedTime;
+    speed = std::max(0.0F, speed - 0.005F * context->elapsedTime);
+    lockPosition.x += context->elapsedTime * 1.5F;
 
     objectSet->getLinks().seaFox->setVelocityAdd({1.5, 0});
     objectSet->getLinks().camera->setLockPosition(lockPosition);
@@ -145,12 +148,12 @@ void TA_Cruiser::updateDestroyed() {
 
     if(position.x < lockPosition.x - getWidth() - 32) {
         TA::sound::playMusic("sound/lr.vgm");
-        objectSet->spawnObject<TA_Transition>(lockPosition + TA_Point(TA::screenWidth + 64, 0),
-            lockPosition + TA_Point(TA::screenWidth + 66, TA::screenHeight), 6, false);
+        objectSet->spawnObject<TA_Transition>(lockPosition + TA_Point(context->screenWidth + 64, 0),
+            lockPosition + TA_Point(context->screenWidth + 66, context->screenHeight), 6, false);
         state = State::POST_DESTROYED;
     }
 
-    float newTimer = timer + TA::elapsedTime;
+    float newTimer = timer + context->elapsedTime;
     if(timer < 20 && newTimer >= 20) {
         watcherSprite.setAlpha(0);
         objectSet->spawnObject<TA_DeadKukku>(position + TA_Point(68, 15));
@@ -169,8 +172,8 @@ void TA_Cruiser::updateDestroyed() {
         constexpr int maxX = 176;
         constexpr int minY = 32;
         constexpr int maxY = 80;
-        int x = minX + TA::random::next() % (maxX - minX + 1);
-        int y = minY + TA::random::next() % (maxY - minY + 1);
+        int x = minX + TA::random::next(context) % (maxX - minX + 1);
+        int y = minY + TA::random::next(context) % (maxY - minY + 1);
         objectSet->spawnObject<TA_Explosion>(position + TA_Point(x, y), 0, TA_EXPLOSION_NEUTRAL);
     }
 
@@ -178,7 +181,7 @@ void TA_Cruiser::updateDestroyed() {
 }
 
 void TA_Cruiser::updatePostDestroyed() {
-    lockPosition.x += TA::elapsedTime * 1.5F;
+    lockPosition.x += context->elapsedTime * 1.5F;
     objectSet->getLinks().seaFox->setVelocityAdd({1.5, 0});
     objectSet->getLinks().camera->setLockPosition(lockPosition);
     objectSet->getLinks().camera->forceLockX();
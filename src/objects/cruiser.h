@@ -9,6 +9,8 @@ public:
     void load();
     bool update() override;
     void draw() override;
+    void setPaused(bool paused) override;
+    bool isCullable() override { return false; }
 
 private:
     enum class State { IDLE, ACTIVE, DESTROYED, POST_DESTROYED };
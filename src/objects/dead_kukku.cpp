@@ -4,11 +4,11 @@
 #include "tools.h"
 
 void TA_DeadKukku::load(TA_Point newPosition) {
-    loadFromToml("objects/pf_enemies.toml");
+    loadFromToml(context, "objects/pf_enemies.toml");
     setAnimation("death");
     position = newPosition;
     objectSet->spawnObject<TA_Explosion>(
-        position + TA_Point(float(TA::random::next() % 16) - 4, float(TA::random::next() % 16) - 8), 0,
+        position + TA_Point(float(TA::random::next(context) % 16) - 4, float(TA::random::next(context) % 16) - 8), 0,
         TA_EXPLOSION_NEUTRAL);
     if(objectSet->enemyShouldDropRing()) {
         objectSet->spawnObject<TA_Ring>(position + TA_Point(8, 24), -2.5);
@@ -16,10 +16,10 @@ void TA_DeadKukku::load(TA_Point newPosition) {
 }
 
 bool TA_DeadKukku::update() {
-    velocity.y += grv * TA::elapsedTime;
-    position = position + velocity * TA::elapsedTime;
+    velocity.y += grv * context->elapsedTime;
+    position = position + velocity * context->elapsedTime;
     setPosition(position);
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > deathTime) {
         return false;
     }
@@ -1,10 +1,9 @@
 #include "dr_fukurokov.h"
-#include "bullet.h"
 #include "sound.h"
 #include "tilemap.h"
 
 void TA_DrFukurokov::load(const Properties& properties) {
-    loadFromToml("objects/dr_fukurokov/dr_fukurokov.toml");
+    loadFromToml(context, "objects/dr_fukurokov/dr_fukurokov.toml");
     this->startPosition = properties.startPosition;
     this->controlPosition = properties.controlPosition;
 
@@ -19,28 +18,28 @@ void TA_DrFukurokov::load(const Properties& properties) {
     quickFallSound.load("sound/quick_fall.ogg", TA_SOUND_CHANNEL_SFX1);
 
     mockPosition = objectSet->getCharacterSpawnPoint();
-    characterMock.loadFromToml("tails/tails.toml");
+    characterMock.loadFromToml(context, "tails/tails.toml");
     characterMock.setPosition(mockPosition);
     characterMock.setAnimation("walk");
     characterMock.setCamera(objectSet->getLinks().camera);
     objectSet->getLinks().character->setHide(true);
 
-    platformSprite.loadFromToml("objects/dr_fukurokov/platform.toml");
+    platformSprite.loadFromToml(context, "objects/dr_fukurokov/platform.toml");
     platformSprite.setPosition(properties.platformPosition);
     platformSprite.setCamera(objectSet->getLinks().camera);
 
-    firstGun.sprite.loadFromToml("objects/dr_fukurokov/gun.toml");
+    firstGun.sprite.loadFromToml(context, "objects/dr_fukurokov/gun.toml");
     firstGun.sprite.setCamera(objectSet->getLinks().camera);
     firstGun.leftX = properties.firstGunLeftX;
     firstGun.rightX = properties.firstGunRightX;
     firstGun.position = {properties.firstGunLeftX, properties.firstGunY};
-    secondGun.sprite.loadFromToml("objects/dr_fukurokov/gun.toml");
+    secondGun.sprite.loadFromToml(context, "objects/dr_fukurokov/gun.toml");
     secondGun.sprite.setCamera(objectSet->getLinks().camera);
     secondGun.leftX = properties.secondGunLeftX;
     secondGun.rightX = properties.secondGunRightX;
     secondGun.position = {properties.secondGunLeftX, properties.secondGunY};
 
-    exitBlockerSprite.loadFromToml("objects/dr_fukurokov/exit_blocker.toml");
+    exitBlockerSprite.loadFromToml(context, "objects/dr_fukurokov/exit_blocker.toml");
     exitBlockerSprite.setPosition(properties.exitBlockerPosition);
     exitBlockerSprite.setCamera(objectSet->getLinks().camera);
     hitbox.setRectangle({0, 0}, {exitBlockerSprite.getWidth(), exitBlockerSprite.getHeight()});
@@ -74,13 +73,13 @@ bool TA_DrFukurokov::update() {
         updateGun(secondGun);
     }
 
-    followPosition = mockPosition + TA_Point(22 - TA::screenWidth / 2, 26 - TA::screenHeight / 2);
+    followPosition = mockPosition + TA_Point(22 - context->screenWidth / 2, 26 - context->screenHeight / 2);
     return true;
 }
 
 void TA_DrFukurokov::updateWaitCharacter() {
     float prevX = mockPosition.x;
-    mockPosition.x += TA::elapsedTime * 0.5F;
+    mockPosition.x += context->elapsedTime * 0.5F;
     objectSet->getLinks().camera->setFollowPosition(&followPosition);
 
     if(prevX < position.x - 80 && mockPosition.x >= position.x - 80) {
@@ -97,7 +96,7 @@ void TA_DrFukurokov::updateWaitCharacter() {
 }
 
 void TA_DrFukurokov::updateStep() {
-    position.x -= 0.5F * TA::elapsedTime;
+    position.x -= 0.5F * context->elapsedTime;
     setPosition(position);
 
     if(!isAnimated()) {
@@ -122,9 +121,9 @@ void TA_DrFukurokov::updateCharacterFall() {
     static constexpr float gravity = 0.125;
     static constexpr float maxYSpeed = 3;
 
-    mockYSpeed += gravity * TA::elapsedTime;
+    mockYSpeed += gravity * context->elapsedTime;
     mockYSpeed = std::min(mockYSpeed, maxYSpeed);
-    mockPosition.y += mockYSpeed * TA::elapsedTime;
+    mockPosition.y += mockYSpeed * context->elapsedTime;
     characterMock.setPosition(mockPosition);
 
     TA_Rect mockHitbox;
@@ -159,13 +158,13 @@ void TA_DrFukurokov::updateGun(Gun& gun) {
     static constexpr float cooldown = 120;
 
     if(gun.flip) {
-        gun.position.x -= TA::elapsedTime;
+        gun.position.x -= context->elapsedTime;
         if(gun.position.x < gun.leftX) {
             gun.position.x = gun.leftX;
             gun.flip = false;
         }
     } else {
-        gun.position.x += TA::elapsedTime;
+        gun.position.x += context->elapsedTime;
         if(gun.position.x > gun.rightX) {
             gun.position.x = gun.rightX;
             gun.flip = true;
@@ -173,9 +172,10 @@ void TA_DrFukurokov::updateGun(Gun& gun) {
     }
 
     gun.sprite.setPosition(gun.position);
-    gun.timer += TA::elapsedTime;
+    gun.timer += context->elapsedTime;
     if(gun.timer > cooldown) {
-        objectSet->spawnObject<TA_DrFukurokovLazer>(gun.position + TA_Point(2, 12), TA_Point(0, 3));
+        objectSet->getProjectiles().spawn(
+            TA_PROJECTILE_DR_FUKUROKOV_LAZER, gun.position + TA_Point(2, 12), TA_Point(0, 3));
         gun.timer = 0;
     }
 }
@@ -19,6 +19,7 @@ public:
     void load(const Properties& properties);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     enum class State { WAIT_CHARACTER, STEP, REMOVE_PLATFORM, CHARACTER_FALL, CONTROL, DEFEATED };
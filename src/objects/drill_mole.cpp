@@ -7,7 +7,7 @@ void TA_DrillMole::load(TA_Point position) {
     this->position = position;
     startY = position.y;
 
-    loadFromToml("objects/drill_mole.toml");
+    loadFromToml(context, "objects/drill_mole.toml");
     setAnimation("drill_mole");
 
     hitbox.setRectangle(TA_Point(5, 0), TA_Point(14, 26));
@@ -16,7 +16,7 @@ void TA_DrillMole::load(TA_Point position) {
 }
 
 bool TA_DrillMole::update() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     timer = std::fmod(timer, 2 * (idleTime + moveTime));
     updatePosition();
 
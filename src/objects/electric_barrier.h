@@ -6,6 +6,7 @@ public:
     void load(int top, int left, int bottom, int right, TA_Point switchPosition);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     int top, left, bottom, right;
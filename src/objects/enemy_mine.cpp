@@ -3,10 +3,10 @@
 #include "explosion.h"
 
 void TA_EnemyMine::load(TA_Point position, bool fall) {
-    TA_Sprite::load("objects/enemy_mine.png");
+    TA_Sprite::load(context, "objects/enemy_mine.png");
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(14, 14));
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
-    timer = TA::random::next() % int(interval);
+    timer = TA::random::next(context) % int(interval);
     this->startPosition = this->position = position;
     this->fall = fall;
     smallExplosionSound.load("sound/explosion_small.ogg", TA_SOUND_CHANNEL_SFX3);
@@ -23,12 +23,12 @@ bool TA_EnemyMine::update() {
         return float(1) / (1 + exp(-6 * y));
     };
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     TA_Point delta{(1 - func(timer / interval)) * 4, func(timer / (interval * 2)) * 8};
 
     if(fall) {
-        ysp = std::min(maxYSpeed, ysp + gravity * TA::elapsedTime);
-        position.y += ysp * TA::elapsedTime;
+        ysp = std::min(maxYSpeed, ysp + gravity * context->elapsedTime);
+        position.y += ysp * context->elapsedTime;
     } else {
         position = startPosition + delta;
     }
@@ -2,12 +2,16 @@
 #include "tools.h"
 
 void TA_Explosion::load(TA_Point position, int delay, TA_ExplosionType type, TA_Point velocity) {
-    loadFromToml("objects/explosion.toml");
+    loadFromToml(context, "objects/explosion.toml");
     setAnimation("explosion");
 
     this->position = position;
     this->delay = delay;
     this->velocity = velocity;
+    if(delay > 0) {
+        // the animation runs from when the explosion shows up, not from when it was spawned
+        setUpdateAnimation(false);
+    }
     hitbox.setRectangle(TA_Point(-2, -2), TA_Point(17, 17));
     updatePosition();
 
@@ -22,9 +26,13 @@ void TA_Explosion::load(TA_Point position, int delay, TA_ExplosionType type, TA_
 }
 
 bool TA_Explosion::update() {
-    timer += TA::elapsedTime;
+    if(timer < delay && timer + context->elapsedTime >= delay) {
+        setUpdateAnimation(true);
+        setAnimation("explosion");
+    }
+    timer += context->elapsedTime;
     if(timer >= delay) {
-        position += velocity * TA::elapsedTime;
+        position += velocity * context->elapsedTime;
     }
     updatePosition();
     return isAnimated();
@@ -35,3 +43,10 @@ void TA_Explosion::draw() {
         TA_Sprite::draw();
     }
 }
+
+void TA_Explosion::setPaused(bool paused) {
+    // a delayed explosion keeps its animation stopped until it shows up
+    if(timer >= delay) {
+        TA_Object::setPaused(paused);
+    }
+}
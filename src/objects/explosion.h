@@ -18,6 +18,8 @@ public:
         TA_Point velocity = {0, 0});
     bool update() override;
     void draw() override;
+    void setPaused(bool paused) override;
+    bool isCullable() override { return false; }
     int getDrawPriority() override { return 1; }
 };
 
@@ -5,7 +5,7 @@ void TA_Fire::load(TA_Point position, bool flip) {
     this->position = position;
     this->flip = flip;
 
-    loadFromToml("objects/fire.toml");
+    loadFromToml(context, "objects/fire.toml");
     setFlip(flip);
     collisionType = TA_COLLISION_DAMAGE;
 
@@ -15,7 +15,7 @@ void TA_Fire::load(TA_Point position, bool flip) {
 
 bool TA_Fire::update() {
     if(!isAnimated()) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > waitTime) {
             setAnimation("fire");
             timer = 0;
@@ -54,7 +54,7 @@ void TA_Fire::updateHitbox() {
 }
 
 void TA_Fire::updateAlpha() {
-    alphaTimer += TA::elapsedTime;
+    alphaTimer += context->elapsedTime;
     float factor = TA::linearInterpolation(128, 255, alphaTimer / alphaPeriod);
     TA_Sprite::setAlpha(factor);
 }
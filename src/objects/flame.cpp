@@ -8,15 +8,15 @@ void TA_Flame::load(TA_Point position, float startSpeed) {
     speed = -startSpeed;
     startY = position.y;
 
-    TA_Sprite::load("objects/flame.png");
+    TA_Sprite::load(context, "objects/flame.png");
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(7, 8));
     collisionType = TA_COLLISION_DAMAGE;
     updatePosition();
 }
 
 bool TA_Flame::update() {
-    speed += gravity * TA::elapsedTime;
-    position.y += std::max(-maxSpeed, std::min(maxSpeed, speed)) * TA::elapsedTime;
+    speed += gravity * context->elapsedTime;
+    position.y += std::max(-maxSpeed, std::min(maxSpeed, speed)) * context->elapsedTime;
     updatePosition();
 
     if(position.y > startY) {
@@ -32,7 +32,7 @@ void TA_FlameLauncher::load(TA_Point position, float startSpeed) {
 
 bool TA_FlameLauncher::update() {
     if(active) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > launchPeriod) {
             objectSet->spawnObject<TA_Flame>(position, startSpeed);
             timer = std::fmod(timer, launchPeriod);
@@ -11,6 +11,7 @@ public:
     using TA_Object::TA_Object;
     void load(TA_Point position, std::string texture);
     bool update() override;
+    TA_ActivationPolicy getActivationPolicy() override { return TA_ACTIVATION_NEAR_CAMERA; }
 };
 
 #endif // TA_GRASS_BLOCK_H
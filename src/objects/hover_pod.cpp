@@ -4,7 +4,7 @@
 #include "tools.h"
 
 void TA_HoverPod::load(TA_Point newPosition, int range, bool flip) {
-    loadFromToml("objects/pf_enemies.toml");
+    loadFromToml(context, "objects/pf_enemies.toml");
     setAnimation("hover_pod");
     hitbox.setRectangle(TA_Point(4, 1), TA_Point(20, 30));
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
@@ -32,12 +32,12 @@ bool TA_HoverPod::update() {
     }
 
     if(!direction) {
-        position.x += speed * TA::elapsedTime;
+        position.x += speed * context->elapsedTime;
         if(position.x > rangeRight) {
             direction = true;
         }
     } else {
-        position.x -= speed * TA::elapsedTime;
+        position.x -= speed * context->elapsedTime;
         if(position.x < rangeLeft) {
             direction = false;
         }
@@ -12,10 +12,10 @@ void TA_ItemBox::load(TA_Point position, TA_Point velocity, int itemNumber, std:
     this->itemNumber = itemNumber;
     this->itemName = TA::resmgr::loadToml("hud/item_box_strings.toml").at(itemName).as_string();
 
-    TA_Sprite::load("hud/items.png", 16, 16);
+    TA_Sprite::load(context, "hud/items.png", 16, 16);
     TA_Sprite::setFrame(39);
 
-    sound.load("sound/find_item.ogg", TA_SOUND_CHANNEL_SFX1);
+    sound.load("sound/find_item.ogg", TA_SOUND_CHANNEL_SFX1, false, TA_SOUND_PRIORITY_HIGH);
 
     hitbox.setRectangle(TA_Point(8, 0), TA_Point(9, 16));
     updatePosition();
@@ -50,7 +50,7 @@ bool TA_ItemBox::update() {
 }
 
 bool TA_ItemBox::characterHasThisItem() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     return (itemMask & (1ll << itemNumber)) != 0;
 }
 
@@ -77,10 +77,10 @@ void TA_ItemBox::updateIdle() {
 }
 
 void TA_ItemBox::updateFall() {
-    velocity.y += gravity * TA::elapsedTime;
+    velocity.y += gravity * context->elapsedTime;
     velocity.y = std::min(velocity.y, maxFallSpeed);
     auto [delta, flags] = objectSet->moveAndCollide(position, TA_Point(8, 0), TA_Point(9, 16),
-        velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
+        velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
     position += delta;
 
     if(flags & TA_GROUND_COLLISION) {
@@ -90,7 +90,7 @@ void TA_ItemBox::updateFall() {
 }
 
 void TA_ItemBox::updateUnpack() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > unpackTime) {
         state = STATE_RAISE;
         objectSet->getLinks().character->setRaiseState();
@@ -155,7 +155,7 @@ void TA_ItemBox::updateRaise() {
 }
 
 bool TA_ItemBox::updateHold() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > holdTime) {
         objectSet->getLinks().character->setReleaseState();
         return false;
@@ -164,13 +164,14 @@ bool TA_ItemBox::updateHold() {
 }
 
 void TA_ItemBox::addItemToCharacter() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     itemMask |= (1ll << itemNumber);
-    TA::save::setSaveParameter("item_mask", itemMask);
+    TA::save::setSaveParameter(context, "item_mask", itemMask);
 
     if(itemNumber <= 19) {
         addItemToFirstFreeSlot();
     }
+    objectSet->getLinks().level->updateItems(context);
     if(itemNumber >= 29) {
         objectSet->addRingsToMaximum();
     }
@@ -181,13 +182,13 @@ void TA_ItemBox::addItemToCharacter() {
 void TA_ItemBox::addItemToFirstFreeSlot() {
     int slot = getFirstFreeItemSlot();
     if(slot != -1) {
-        TA::save::setSaveParameter(getItemSlotName(slot), itemNumber);
+        TA::save::setSaveParameter(context, getItemSlotName(slot), itemNumber);
     }
 }
 
 int TA_ItemBox::getFirstFreeItemSlot() {
     int slot = 0;
-    while(slot <= 3 && TA::save::getSaveParameter(getItemSlotName(slot)) != -1) {
+    while(slot <= 3 && TA::save::getSaveParameter(context, getItemSlotName(slot)) != -1) {
         slot++;
     }
     if(slot == 4) {
@@ -208,14 +209,14 @@ int TA_ItemBox::getDrawPriority() {
 }
 
 void TA_ItemLabel::load(TA_Point position, std::string name) {
-    font.loadFont("fonts/item.toml");
+    font.loadFont(context, "fonts/item.toml");
     position.x -= font.getTextWidth(name) / 2 - 8;
     this->position = position;
     this->name = name;
 }
 
 bool TA_ItemLabel::update() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > showTime) {
         return false;
     }
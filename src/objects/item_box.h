@@ -40,6 +40,9 @@ public:
     void load(TA_Point position, TA_Point velocity, int itemNumber, std::string itemName);
     bool update() override;
     int getDrawPriority() override;
+    TA_ActivationPolicy getActivationPolicy() override {
+        return (state == STATE_IDLE ? TA_ACTIVATION_NEAR_CAMERA : TA_ACTIVATION_ALWAYS);
+    }
 };
 
 class TA_ItemLabel : public TA_Object {
@@ -58,6 +61,7 @@ public:
     void load(TA_Point position, std::string name);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
     int getDrawPriority() override { return 2; }
 };
 
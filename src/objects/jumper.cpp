@@ -5,7 +5,7 @@
 
 void TA_Jumper::load(TA_Point position) {
     this->position = position;
-    loadFromToml("objects/jumper.toml");
+    loadFromToml(context, "objects/jumper.toml");
     hitbox.setRectangle(TA_Point(1, 1), TA_Point(15, 31));
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
     updatePosition();
@@ -38,7 +38,7 @@ void TA_Jumper::updateIdle() {
     updateDirection();
 
     if(isCloseToCharacter()) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > idleTime) {
             initAim();
         }
@@ -61,7 +61,7 @@ void TA_Jumper::updateAim() {
 
 void TA_Jumper::setJumpVelocity() {
     int tileDistance = (std::abs(getDistanceToCharacter().x) + 8) / 16;
-    if(tileDistance > 3 && TA::random::next() % 3 == 0) {
+    if(tileDistance > 3 && TA::random::next(context) % 3 == 0) {
         tileDistance = 3;
     }
 
@@ -79,9 +79,9 @@ void TA_Jumper::setJumpVelocity() {
 void TA_Jumper::updateJump() {
     setAnimation("jump");
 
-    velocity.y += gravity * TA::elapsedTime;
+    velocity.y += gravity * context->elapsedTime;
     auto [delta, flags] = objectSet->moveAndCollide(position, TA_Point(4, 1), TA_Point(12, 31),
-        velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
+        velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
     position += delta;
 
     if(flags & TA_CEIL_COLLISION) {
@@ -7,9 +7,9 @@ void TA_LandCutscene::load(TA_Point position, float landY, int selection) {
     this->position = position;
     this->landY = landY;
     this->selection = selection;
-    characterMock.loadFromToml("tails/tails.toml");
+    characterMock.loadFromToml(context, "tails/tails.toml");
     characterMock.setCamera(objectSet->getLinks().camera);
-    seaFoxMock.loadFromToml("tails/seafox.toml");
+    seaFoxMock.loadFromToml(context, "tails/seafox.toml");
     seaFoxMock.setCamera(objectSet->getLinks().camera);
     seaFoxMock.setAnimation("idle");
     jumpSound.load("sound/jump.ogg", TA_SOUND_CHANNEL_SFX1);
@@ -50,13 +50,13 @@ void TA_LandCutscene::updateCorrectX() {
     TA_Point mockPosition = seaFoxMock.getPosition();
 
     if(mockPosition.x < position.x) {
-        mockPosition.x += correctXSpeed * TA::elapsedTime;
+        mockPosition.x += correctXSpeed * context->elapsedTime;
         if(mockPosition.x >= position.x) {
             mockPosition.x = position.x;
             initJump();
         }
     } else {
-        mockPosition.x -= correctXSpeed * TA::elapsedTime;
+        mockPosition.x -= correctXSpeed * context->elapsedTime;
         if(mockPosition.x < position.x) {
             mockPosition.x = position.x;
             initJump();
@@ -76,16 +76,16 @@ void TA_LandCutscene::initJump() {
 }
 
 void TA_LandCutscene::updateJump() {
-    velocity.y += gravity * TA::elapsedTime;
+    velocity.y += gravity * context->elapsedTime;
     TA_Point characterPos = characterMock.getPosition();
 
-    if(characterPos.y < landY && characterPos.y + velocity.y * TA::elapsedTime >= landY) {
-        characterPos += velocity * TA::elapsedTime;
+    if(characterPos.y < landY && characterPos.y + velocity.y * context->elapsedTime >= landY) {
+        characterPos += velocity * context->elapsedTime;
         characterPos.y = landY;
         characterMock.setAnimation("walk");
         state = State::WALK_AWAY;
     } else {
-        characterPos += velocity * TA::elapsedTime;
+        characterPos += velocity * context->elapsedTime;
         characterMock.setAnimation(velocity.y < 0 ? "jump_up" : "jump_down");
     }
 
@@ -94,12 +94,12 @@ void TA_LandCutscene::updateJump() {
 
 void TA_LandCutscene::updateWalkAway() {
     TA_Point characterPos = characterMock.getPosition();
-    characterPos.x += TA::elapsedTime;
+    characterPos.x += context->elapsedTime;
     characterMock.setPosition(characterPos);
 
     if(characterPos.x >= position.x + 96) {
-        TA::save::setSaveParameter("map_selection", selection);
-        TA::save::setSaveParameter("seafox", 0);
+        TA::save::setSaveParameter(context, "map_selection", selection);
+        TA::save::setSaveParameter(context, "seafox", 0);
         objectSet->setTransition(TA_SCREENSTATE_MAP);
     }
 }
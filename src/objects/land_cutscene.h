@@ -6,6 +6,7 @@ public:
     void load(TA_Point position, float landY, int selection);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     static constexpr float correctXSpeed = 0.7;
@@ -6,7 +6,7 @@
 #include "tools.h"
 
 void TA_LargeBomb::load(TA_Point position) {
-    loadFromToml("objects/bomb.toml");
+    loadFromToml(context, "objects/bomb.toml");
     setAnimation("large");
 
     this->position = position;
@@ -18,8 +18,8 @@ void TA_LargeBomb::load(TA_Point position) {
 }
 
 bool TA_LargeBomb::update() {
-    velocity.y += gravity * TA::elapsedTime;
-    auto [delta, flags] = objectSet->moveAndCollide(position, {4, 4}, {12, 16}, velocity * TA::elapsedTime,
+    velocity.y += gravity * context->elapsedTime;
+    auto [delta, flags] = objectSet->moveAndCollide(position, {4, 4}, {12, 16}, velocity * context->elapsedTime,
         TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_PUSHABLE | TA_COLLISION_MOVING_PLATFORM);
 
     position += delta;
@@ -40,10 +40,10 @@ void TA_LargeBomb::explode() {
     objectSet->spawnObject<TA_Explosion>(position, 0, TA_EXPLOSION_LARGE);
 
     for(int i = 1; i <= 3; i++) {
-        TA_Point explosionPosition = position + TA_Point(static_cast<int>(TA::random::next() % 7) - 3,
-                                                    static_cast<int>(TA::random::next() % 7) - 3);
+        TA_Point explosionPosition = position + TA_Point(static_cast<int>(TA::random::next(context) % 7) - 3,
+                                                    static_cast<int>(TA::random::next(context) % 7) - 3);
         float explosionAngle =
-            static_cast<float>(TA::random::next()) / static_cast<float>(TA::random::max()) * TA::pi * 2;
+            static_cast<float>(TA::random::next(context)) / static_cast<float>(TA::random::max()) * TA::pi * 2;
         TA_Point explosionVelocty = {
             std::cos(explosionAngle) * explosionSpeed, std::sin(explosionAngle) * explosionSpeed};
 
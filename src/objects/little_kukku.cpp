@@ -3,7 +3,7 @@
 #include "ring.h"
 
 void TA_LittleKukku::load(TA_Point position) {
-    loadFromToml("objects/little_kukku.toml");
+    loadFromToml(context, "objects/little_kukku.toml");
     hitbox.setRectangle({3, 2}, {13, 16});
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
     this->position = position;
@@ -54,9 +54,9 @@ void TA_LittleKukku::updateCooldown() {
 
 void TA_LittleKukku::updateRun() {
     setAnimation("run");
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     TA_Point newPosition = position;
-    newPosition.x += speed * TA::elapsedTime * (flip ? 1 : -1);
+    newPosition.x += speed * context->elapsedTime * (flip ? 1 : -1);
 
     if(!isGoodPosition(newPosition)) {
         flip = !flip;
@@ -14,14 +14,14 @@ void TA_MechaGolem::load() {
         return;
     }
 
-    headSprite.loadFromToml("objects/mecha_golem/head.toml");
-    headFlashSprite.loadFromToml("objects/mecha_golem/head.toml");
-    bodySprite.load("objects/mecha_golem/body.png");
-    leftFootSprite.load("objects/mecha_golem/feet.png", 16, 11);
-    rightFootSprite.load("objects/mecha_golem/feet.png", 16, 11);
+    headSprite.loadFromToml(context, "objects/mecha_golem/head.toml");
+    headFlashSprite.loadFromToml(context, "objects/mecha_golem/head.toml");
+    bodySprite.load(context, "objects/mecha_golem/body.png");
+    leftFootSprite.load(context, "objects/mecha_golem/feet.png", 16, 11);
+    rightFootSprite.load(context, "objects/mecha_golem/feet.png", 16, 11);
     rightFootSprite.setFrame(1);
-    armSprite.loadFromToml("objects/mecha_golem/arm.toml");
-    armPartSprite.load("objects/mecha_golem/arm_part.png");
+    armSprite.loadFromToml(context, "objects/mecha_golem/arm.toml");
+    armPartSprite.load(context, "objects/mecha_golem/arm_part.png");
 
     TA_Camera* camera = objectSet->getLinks().camera;
     headSprite.setCamera(camera);
@@ -36,8 +36,8 @@ void TA_MechaGolem::load() {
     smallExplosionSound.load("sound/explosion_small.ogg", TA_SOUND_CHANNEL_SFX3);
     explosionSound.load("sound/explosion.ogg", TA_SOUND_CHANNEL_SFX3);
 
-    position = {float(128 + TA::screenWidth - 61), 160};
-    objectSet->getLinks().camera->setLockPosition({128, 192 - TA::screenHeight});
+    position = {float(128 + context->screenWidth - 61), 160};
+    objectSet->getLinks().camera->setLockPosition({128, 192 - context->screenHeight});
     hitboxVector.assign(HITBOX_MAX, HitboxVectorElement());
 }
 
@@ -118,7 +118,7 @@ bool TA_MechaGolem::update() {
 }
 
 bool TA_MechaGolem::isComplete() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     return itemMask & (1ll << 22);
 }
 
@@ -139,7 +139,7 @@ void TA_MechaGolem::updateWait() {
         return;
     }
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer < waitTime) {
         return;
     }
@@ -156,7 +156,7 @@ void TA_MechaGolem::updateWait() {
         if(previousState == STATE_GO_LEFT || previousState == STATE_GO_RIGHT) {
             timer = 0;
             float characterX = objectSet->getCharacterPosition().x;
-            if(TA::random::next() % 4 == 0) {
+            if(TA::random::next(context) % 4 == 0) {
                 initGo();
             } else if(characterX < position.x && characterX > position.x - 48) {
                 state = STATE_ARM_CIRCLE;
@@ -176,7 +176,7 @@ void TA_MechaGolem::initGo() {
 
     if(position.x < cameraX + goBorder) {
         state = STATE_GO_RIGHT;
-    } else if(position.x > cameraX + TA::screenWidth - goBorder - bodySprite.getWidth()) {
+    } else if(position.x > cameraX + context->screenWidth - goBorder - bodySprite.getWidth()) {
         state = STATE_GO_LEFT;
     } else if(position.x + bodySprite.getWidth() / 2 < objectSet->getCharacterPosition().x) {
         state = STATE_GO_RIGHT;
@@ -191,7 +191,7 @@ void TA_MechaGolem::initGo() {
 
 void TA_MechaGolem::updateGo() {
     int direction = (state == STATE_GO_LEFT ? -1 : 1);
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
 
     if(timer > goTime) {
         if(state == STATE_GO_RIGHT) {
@@ -240,7 +240,7 @@ void TA_MechaGolem::initArmMove() {
 }
 
 void TA_MechaGolem::updateArmMove() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armMoveTime) {
         timer = 0;
         state = STATE_ARM_MOVE_BACK;
@@ -252,7 +252,7 @@ void TA_MechaGolem::updateArmMove() {
 }
 
 void TA_MechaGolem::updateArmMoveBack() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armMoveTime) {
         timer = 0;
         state = STATE_WAIT;
@@ -285,14 +285,14 @@ void TA_MechaGolem::initPhaseChange() {
 
     for(int delay = 0; delay < phaseChangeTime * 2 / 3; delay += phaseChangeExplosionInterval) {
         TA_Point explosionPosition = position + TA_Point(5, -56);
-        explosionPosition.x += TA::random::next() % 8;
-        explosionPosition.y += TA::random::next() % 16;
+        explosionPosition.x += TA::random::next(context) % 8;
+        explosionPosition.y += TA::random::next(context) % 16;
         objectSet->spawnObject<TA_Explosion>(explosionPosition, delay, TA_EXPLOSION_NEUTRAL);
     }
 }
 
 void TA_MechaGolem::updatePhaseChange() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > phaseChangeTime) {
         timer = 0;
         headSprite.setAnimation("idle2");
@@ -306,7 +306,7 @@ void TA_MechaGolem::updatePhaseChange() {
 }
 
 void TA_MechaGolem::updateArmCircle() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armCircleTime) {
         timer = 0;
         state = STATE_WAIT;
@@ -328,7 +328,7 @@ void TA_MechaGolem::updateArmCircle() {
 }
 
 void TA_MechaGolem::updateArmBite1() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armBite1Time) {
         timer = 0;
         state = STATE_ARM_BITE2;
@@ -344,7 +344,7 @@ void TA_MechaGolem::updateArmBite1() {
 void TA_MechaGolem::updateArmBite2() {
     TA_Point startPosition = position + TA_Point(-11, -82);
     TA_Point endPosition = position + TA_Point(-32, -15);
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
 
     if(timer > armBite2Time) {
         timer = 0;
@@ -368,7 +368,7 @@ void TA_MechaGolem::updateArmBite2() {
 }
 
 void TA_MechaGolem::updateArmBite3() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armBite3Time) {
         timer = 0;
         state = STATE_ARM_BITE4;
@@ -376,7 +376,7 @@ void TA_MechaGolem::updateArmBite3() {
 }
 
 void TA_MechaGolem::updateArmBite4() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > armBite4Time) {
         timer = 0;
         state = STATE_WAIT;
@@ -402,7 +402,7 @@ void TA_MechaGolem::initBlow() {
 
 void TA_MechaGolem::updateBlow() {
     float prev = timer;
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
 
     if(prev <= 32 && timer > 32) {
         smallExplosionSound.play();
@@ -418,8 +418,8 @@ void TA_MechaGolem::updateBlow() {
 }
 
 void TA_MechaGolem::updateFall() {
-    speed += gravity * TA::elapsedTime;
-    position.y += speed * TA::elapsedTime;
+    speed += gravity * context->elapsedTime;
+    position.y += speed * context->elapsedTime;
 
     if(position.y >= 171) {
         position.y = 171;
@@ -428,8 +428,8 @@ void TA_MechaGolem::updateFall() {
 
         for(int delay = 0; delay < defeatedTime; delay += defeatedExplosionInterval) {
             TA_Point explosionPosition;
-            explosionPosition.x = position.x + TA::random::next() % 41;
-            explosionPosition.y = position.y - 57 + TA::random::next() % 30;
+            explosionPosition.x = position.x + TA::random::next(context) % 41;
+            explosionPosition.y = position.y - 57 + TA::random::next(context) % 30;
             objectSet->spawnObject<TA_Explosion>(explosionPosition, delay, TA_EXPLOSION_NEUTRAL);
         }
     }
@@ -441,7 +441,7 @@ void TA_MechaGolem::updateDefeated() {
         return;
     }
     float prev = timer;
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
 
     if(!TA::sound::isPlaying(TA_SOUND_CHANNEL_SFX3)) {
         explosionSound.play();
@@ -457,14 +457,14 @@ bool TA_MechaGolem::canDoTransition() {
 }
 
 void TA_MechaGolem::doTransition() {
-    TA::save::setSaveParameter("map_selection", 4);
-    TA::save::setSaveParameter("seafox", 0);
+    TA::save::setSaveParameter(context, "map_selection", 4);
+    TA::save::setSaveParameter(context, "seafox", 0);
     objectSet->setTransition(TA_SCREENSTATE_MAP);
 }
 
 void TA_MechaGolem::updateDamage() {
     if(invincibleTimer <= invincibleTime) {
-        invincibleTimer += TA::elapsedTime;
+        invincibleTimer += context->elapsedTime;
         return;
     }
 
@@ -483,10 +483,10 @@ void TA_MechaGolem::updateDamage() {
 void TA_MechaGolem::updateHitboxes() {
     // TODO: add hitbox to block bombs from back
     hitboxVector[HITBOX_WALL_TOP].hitbox.setRectangle(
-        TA_Point(0, 208 - TA::screenHeight), TA_Point(512, 192 - TA::screenHeight));
+        TA_Point(0, 208 - context->screenHeight), TA_Point(512, 192 - context->screenHeight));
     hitboxVector[HITBOX_WALL_LEFT].hitbox.setRectangle(TA_Point(112, 0), TA_Point(128, 160));
     hitboxVector[HITBOX_WALL_RIGHT].hitbox.setRectangle(
-        TA_Point(128 + TA::screenWidth, 0), TA_Point(144 + TA::screenWidth, 160));
+        TA_Point(128 + context->screenWidth, 0), TA_Point(144 + context->screenWidth, 160));
     hitboxVector[HITBOX_WALL_TOP].collisionType = TA_COLLISION_SOLID;
     hitboxVector[HITBOX_WALL_LEFT].collisionType = hitboxVector[HITBOX_WALL_RIGHT].collisionType =
         (state == STATE_IDLE ? TA_COLLISION_TRANSPARENT : TA_COLLISION_SOLID);
@@ -9,6 +9,7 @@ public:
     void load();
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     const float invincibleTime = 30;
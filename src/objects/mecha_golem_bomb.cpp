@@ -3,15 +3,15 @@
 #include "tilemap.h"
 
 void TA_MechaGolemBomb::load(TA_Point position) {
-    TA_Sprite::load("objects/mecha_golem/bomb.png");
+    TA_Sprite::load(context, "objects/mecha_golem/bomb.png");
     hitbox.setRectangle({4, 4}, {12, 28});
     collisionType = TA_COLLISION_DAMAGE;
     this->position = position;
 }
 
 bool TA_MechaGolemBomb::update() {
-    speed = std::min(maxSpeed, speed + gravity * TA::elapsedTime);
-    position.y += speed * TA::elapsedTime;
+    speed = std::min(maxSpeed, speed + gravity * context->elapsedTime);
+    position.y += speed * context->elapsedTime;
     updatePosition();
 
     if(position.y >= 128) {
@@ -4,12 +4,12 @@
 void TA_MechaGolemEnergyShot::load(TA_Point position) {
     this->position = position;
 
-    foregroundSprite.loadFromToml("objects/mecha_golem/energy_shot.toml");
+    foregroundSprite.loadFromToml(context, "objects/mecha_golem/energy_shot.toml");
     foregroundSprite.setCamera(objectSet->getLinks().camera);
     foregroundSprite.setPosition(position);
     foregroundSprite.setAnimation("foreground");
 
-    backgroundSprite.loadFromToml("objects/mecha_golem/energy_shot.toml");
+    backgroundSprite.loadFromToml(context, "objects/mecha_golem/energy_shot.toml");
     backgroundSprite.setCamera(objectSet->getLinks().camera);
     backgroundSprite.setPosition(position);
     backgroundSprite.setAnimation("background");
@@ -30,6 +30,14 @@ void TA_MechaGolemEnergyShot::load(TA_Point position) {
 bool TA_MechaGolemEnergyShot::update() {
     static constexpr float flySpeed = 0.3;
     static constexpr float turnSpeed = 0.02;
+    static constexpr float glowInterval = 5;
+
+    glowTimer = std::fmod(glowTimer + context->elapsedTime, glowInterval * 2);
+    if(glowTimer < glowInterval) {
+        foregroundSprite.setAlpha(static_cast<int>(255 * (glowTimer / glowInterval)));
+    } else {
+        foregroundSprite.setAlpha(static_cast<int>(255 - (255 * ((glowTimer - glowInterval) / glowInterval))));
+    }
 
     TA_Point delta = objectSet->getCharacterPosition() - (position + TA_Point(7, 7));
     float neededAngle = std::atan2(delta.y, delta.x);
@@ -37,16 +45,16 @@ bool TA_MechaGolemEnergyShot::update() {
         neededAngle = TA::pi * 2 + neededAngle;
     }
 
-    if(std::abs(angle - neededAngle) <= turnSpeed * TA::elapsedTime) {
+    if(std::abs(angle - neededAngle) <= turnSpeed * context->elapsedTime) {
         angle = neededAngle;
     } else {
         float positiveDiff = (neededAngle >= angle ? neededAngle - angle : (TA::pi * 2) - angle + neededAngle);
         float negativeDiff = (neededAngle <= angle ? angle - neededAngle : (TA::pi * 2) - neededAngle + angle);
 
         if(positiveDiff < negativeDiff) {
-            angle = std::fmod(angle + (turnSpeed * TA::elapsedTime), TA::pi * 2);
+            angle = std::fmod(angle + (turnSpeed * context->elapsedTime), TA::pi * 2);
         } else {
-            angle = std::fmod(angle - (turnSpeed * TA::elapsedTime) + (TA::pi * 8), TA::pi * 2);
+            angle = std::fmod(angle - (turnSpeed * context->elapsedTime) + (TA::pi * 8), TA::pi * 2);
         }
     }
 
@@ -64,15 +72,6 @@ bool TA_MechaGolemEnergyShot::update() {
 }
 
 void TA_MechaGolemEnergyShot::draw() {
-    static constexpr float glowInterval = 5;
-
-    glowTimer = std::fmod(glowTimer + TA::elapsedTime, glowInterval * 2);
-    if(glowTimer < glowInterval) {
-        foregroundSprite.setAlpha(static_cast<int>(255 * (glowTimer / glowInterval)));
-    } else {
-        foregroundSprite.setAlpha(static_cast<int>(255 - (255 * ((glowTimer - glowInterval) / glowInterval))));
-    }
-
     backgroundSprite.draw();
     foregroundSprite.draw();
 }
@@ -9,6 +9,7 @@ public:
     void load(TA_Point position);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
     void updatePosition() override;
 
 private:
@@ -1,5 +1,4 @@
 #include "mecha_golem_mk2.h"
-#include "bullet.h"
 #include "explosion.h"
 #include "mecha_golem_energy_shot.h"
 #include "save.h"
@@ -10,26 +9,26 @@ void TA_MechaGolemMk2::load(TA_Point position, TA_Point enterBlockerPosition, TA
     this->enterBlockerPosition = enterBlockerPosition;
     this->exitBlockerPosition = exitBlockerPosition;
 
-    bodySprite.loadFromToml("objects/mecha_golem/mk2_body.toml");
+    bodySprite.loadFromToml(context, "objects/mecha_golem/mk2_body.toml");
     bodySprite.setCamera(objectSet->getLinks().camera);
     bodySprite.setPosition(position);
 
-    headSprite.loadFromToml("objects/mecha_golem/head.toml");
+    headSprite.loadFromToml(context, "objects/mecha_golem/head.toml");
     headSprite.setCamera(objectSet->getLinks().camera);
     headSprite.setPosition(position + TA_Point(32, 1));
     headSprite.setAnimation("mk2_idle");
-    headFlashSprite.loadFromToml("objects/mecha_golem/head.toml");
+    headFlashSprite.loadFromToml(context, "objects/mecha_golem/head.toml");
     headFlashSprite.setCamera(objectSet->getLinks().camera);
     headFlashSprite.setPosition(position + TA_Point(32, 1));
 
-    enterBlockerSprite.loadFromToml("objects/mecha_golem/enter_blocker.toml");
+    enterBlockerSprite.loadFromToml(context, "objects/mecha_golem/enter_blocker.toml");
     enterBlockerSprite.setCamera(objectSet->getLinks().camera);
     enterBlockerSprite.setPosition(enterBlockerPosition - TA_Point(0, enterBlockerOffset));
-    exitBlockerSprite.loadFromToml("objects/mecha_golem/exit_blocker.toml");
+    exitBlockerSprite.loadFromToml(context, "objects/mecha_golem/exit_blocker.toml");
     exitBlockerSprite.setCamera(objectSet->getLinks().camera);
     exitBlockerSprite.setPosition(exitBlockerPosition);
 
-    fireEffectSprite.loadFromToml("objects/mecha_golem/fire_effect.toml");
+    fireEffectSprite.loadFromToml(context, "objects/mecha_golem/fire_effect.toml");
     fireEffectSprite.setCamera(objectSet->getLinks().camera);
     fireEffectSprite.setPosition(position + TA_Point(18, 22));
 
@@ -51,7 +50,7 @@ void TA_MechaGolemMk2::load(TA_Point position, TA_Point enterBlockerPosition, TA
     hitSound.load("sound/hit.ogg", TA_SOUND_CHANNEL_SFX2);
     explosionSound.load("sound/explosion.ogg", TA_SOUND_CHANNEL_SFX3);
 
-    if((TA::save::getSaveParameter("item_mask") & (1 << 21)) != 0) {
+    if((TA::save::getSaveParameter(context, "item_mask") & (1 << 21)) != 0) {
         initDefeated();
     }
 }
@@ -88,7 +87,7 @@ void TA_MechaGolemMk2::updateWait() {
         objectSet->getLinks().camera->unlock();
     } else {
         TA_Point centerPosition = position + TA_Point(96, 0);
-        TA_Point lockPosition = centerPosition - TA_Point(TA::screenWidth / 2, TA::screenHeight / 2);
+        TA_Point lockPosition = centerPosition - TA_Point(context->screenWidth / 2, context->screenHeight / 2);
         objectSet->getLinks().camera->setLockPosition(lockPosition);
         if(objectSet->getLinks().camera->isLocked()) {
             TA::sound::playMusic("sound/boss.vgm");
@@ -109,9 +108,9 @@ void TA_MechaGolemMk2::updateIdle() {
 
     static constexpr float cooldown = 80;
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > cooldown) {
-        if(secondPhase && TA::random::next() % 2 == 0) {
+        if(secondPhase && TA::random::next(context) % 2 == 0) {
             objectSet->spawnObject<TA_MechaGolemEnergyShot>(position + TA_Point(48, 24));
             timer = 0;
         } else {
@@ -132,7 +131,7 @@ void TA_MechaGolemMk2::updateFire() {
         -TA::pi * 4 / 16, -TA::pi * 3 / 16, -TA::pi * 2 / 16, -TA::pi / 16};
     static constexpr float bulletSpeed = 5;
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer <= fireInterval) {
         return;
     }
@@ -140,7 +139,7 @@ void TA_MechaGolemMk2::updateFire() {
     TA_Point firePosition = position + TA_Point(19, 23);
     TA_Point fireVelocity = {
         std::cos(fireAngles[fireIndex]) * bulletSpeed, std::sin(fireAngles[fireIndex]) * bulletSpeed};
-    objectSet->spawnObject<TA_MechaGolemBullet>(firePosition, fireVelocity);
+    objectSet->getProjectiles().spawn(TA_PROJECTILE_MECHA_GOLEM, firePosition, fireVelocity);
     fireEffectSprite.setAnimation("fire");
 
     fireIndex++;
@@ -158,14 +157,14 @@ void TA_MechaGolemMk2::initPhaseChange() {
 
     for(int delay = 0; delay < static_cast<int>(phaseChangeTime * 2 / 3); delay += phaseChangeExplosionInterval) {
         TA_Point explosionPosition = position + TA_Point(30, 2);
-        explosionPosition.x += static_cast<float>(TA::random::next() % 8);
-        explosionPosition.y += static_cast<float>(TA::random::next() % 16);
+        explosionPosition.x += static_cast<float>(TA::random::next(context) % 8);
+        explosionPosition.y += static_cast<float>(TA::random::next(context) % 16);
         objectSet->spawnObject<TA_Explosion>(explosionPosition, delay, TA_EXPLOSION_NEUTRAL);
     }
 }
 
 void TA_MechaGolemMk2::updatePhaseChange() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > phaseChangeTime) {
         timer = 0;
         headSprite.setAnimation("idle2");
@@ -192,8 +191,8 @@ void TA_MechaGolemMk2::initBlow() {
 
     for(int delay = 0; delay < static_cast<int>(blowTime); delay += blowInterval) {
         TA_Point explosionPosition;
-        explosionPosition.x = position.x + static_cast<float>(TA::random::next() % 41);
-        explosionPosition.y = position.y + static_cast<float>(TA::random::next() % 30);
+        explosionPosition.x = position.x + static_cast<float>(TA::random::next(context) % 41);
+        explosionPosition.y = position.y + static_cast<float>(TA::random::next(context) % 30);
         objectSet->spawnObject<TA_Explosion>(explosionPosition, delay, TA_EXPLOSION_NEUTRAL);
     }
 }
@@ -203,7 +202,7 @@ void TA_MechaGolemMk2::updateBlow() {
         explosionSound.play();
     }
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > blowTime * 2 / 3) {
         headSprite.setAlpha(0);
     }
@@ -224,7 +223,7 @@ void TA_MechaGolemMk2::initDefeated() {
 
 void TA_MechaGolemMk2::updateDamage() {
     if(invincibleTimer <= invincibleTime) {
-        invincibleTimer += TA::elapsedTime;
+        invincibleTimer += context->elapsedTime;
         return;
     }
     if(state == State::BLOW || state == State::DEFEATED) {
@@ -249,9 +248,9 @@ void TA_MechaGolemMk2::updateEnterBlocker() {
     }
 
     if(state == State::DEFEATED) {
-        enterBlockerOffset = std::min(32.0F, enterBlockerOffset + (TA::elapsedTime * 2));
+        enterBlockerOffset = std::min(32.0F, enterBlockerOffset + (context->elapsedTime * 2));
     } else {
-        enterBlockerOffset = std::max(0.0F, enterBlockerOffset - (TA::elapsedTime * 2));
+        enterBlockerOffset = std::max(0.0F, enterBlockerOffset - (context->elapsedTime * 2));
     }
 
     enterBlockerSprite.setPosition(enterBlockerPosition - TA_Point(0, enterBlockerOffset));
@@ -260,7 +259,7 @@ void TA_MechaGolemMk2::updateEnterBlocker() {
 
 void TA_MechaGolemMk2::updateExitBlocker() {
     if(state == State::DEFEATED) {
-        exitBlockerOffset = std::min(32.0F, exitBlockerOffset + (TA::elapsedTime * 2));
+        exitBlockerOffset = std::min(32.0F, exitBlockerOffset + (context->elapsedTime * 2));
     }
 
     exitBlockerSprite.setPosition(exitBlockerPosition - TA_Point(exitBlockerOffset, 0));
@@ -9,6 +9,7 @@ public:
     void load(TA_Point position, TA_Point enterBlockerPosition, TA_Point exitBlockerPosition);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 
 private:
     enum class State : uint8_t { WAIT, IDLE, FIRE, PHASE_CHANGE, BLOW, DEFEATED };
@@ -3,7 +3,7 @@
 #include "geometry.h"
 
 void TA_Mine::load(TA_Point position, float xsp) {
-    loadFromToml("objects/mine.toml");
+    loadFromToml(context, "objects/mine.toml");
     this->position = position;
     velocity = {xsp, 0};
 
@@ -16,14 +16,14 @@ void TA_Mine::load(TA_Point position, float xsp) {
 
 bool TA_Mine::update() {
     if(!destroyed) {
-        velocity.y = std::min(maxYSpeed, velocity.y + gravity * TA::elapsedTime);
+        velocity.y = std::min(maxYSpeed, velocity.y + gravity * context->elapsedTime);
         if(velocity.x > 0) {
-            velocity.x = std::max(0.0F, velocity.x - drag * TA::elapsedTime);
+            velocity.x = std::max(0.0F, velocity.x - drag * context->elapsedTime);
         } else {
-            velocity.x = std::min(0.0F, velocity.x + drag * TA::elapsedTime);
+            velocity.x = std::min(0.0F, velocity.x + drag * context->elapsedTime);
         }
 
-        position += velocity * TA::elapsedTime;
+        position += velocity * context->elapsedTime;
         updatePosition();
 
         if((objectSet->checkCollision(hitbox) & (TA_COLLISION_SOLID | TA_COLLISION_TARGET)) != 0) {
@@ -34,12 +34,12 @@ bool TA_Mine::update() {
             explosionSound.play();
             for(int i = 1; i <= 3; i++) {
                 TA_Point explosionPosition =
-                    position + TA_Point(int(TA::random::next() % 7) - 3, int(TA::random::next() % 7) - 3);
+                    position + TA_Point(int(TA::random::next(context) % 7) - 3, int(TA::random::next(context) % 7) - 3);
                 objectSet->spawnObject<TA_Explosion>(explosionPosition, i * 16, TA_EXPLOSION_NEUTRAL);
             }
         }
     } else {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > 10) {
             return false;
         }
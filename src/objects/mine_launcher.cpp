@@ -2,7 +2,7 @@
 #include "enemy_mine.h"
 
 void TA_MineLauncher::load(TA_Point position) {
-    loadFromToml("objects/mine_launcher.toml");
+    loadFromToml(context, "objects/mine_launcher.toml");
     this->position = position;
     hitbox.setRectangle({0, 0}, {16, 16});
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
@@ -11,7 +11,7 @@ void TA_MineLauncher::load(TA_Point position) {
 
 bool TA_MineLauncher::update() {
     if(timer < cooldown) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         return true;
     }
 
@@ -3,7 +3,7 @@
 #include "tilemap.h"
 
 void TA_MiniSub::load(TA_Point position) {
-    loadFromToml("objects/mini_sub.toml");
+    loadFromToml(context, "objects/mini_sub.toml");
     setAnimation("mini_sub");
 
     hitbox.setRectangle(TA_Point(5, 2), TA_Point(19, 30));
@@ -41,6 +41,6 @@ void TA_MiniSub::updateIdle() {
 }
 
 void TA_MiniSub::updateAttack() {
-    position.x -= speed * TA::elapsedTime * (flip ? -1 : 1);
-    timer += TA::elapsedTime;
+    position.x -= speed * context->elapsedTime * (flip ? -1 : 1);
+    timer += context->elapsedTime;
 }
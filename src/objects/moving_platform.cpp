@@ -8,7 +8,7 @@ void TA_MovingPlatform::load(TA_Point startPosition, TA_Point endPosition, bool
     this->idle = idle;
     position = prevPosition = startPosition;
 
-    TA_Sprite::load("maps/pm/platform.png");
+    TA_Sprite::load(context, "maps/pm/platform.png");
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(32, 16));
     updatePosition();
 }
@@ -34,13 +34,15 @@ void TA_MovingPlatform::updateIdle() {
 void TA_MovingPlatform::movePlatform() {
     prevPosition = position;
     if(moveByX()) {
-        position.x += TA::sign(endPosition.x - startPosition.x) * (reverse ? -1.0F : 1.0F) * speed * TA::elapsedTime;
+        position.x +=
+            TA::sign(endPosition.x - startPosition.x) * (reverse ? -1.0F : 1.0F) * speed * context->elapsedTime;
         if(exceedsBorder()) {
             position.x = (reverse ? startPosition.x : endPosition.x);
             reverse = !reverse;
         }
     } else {
-        position.y += TA::sign(endPosition.y - startPosition.y) * (reverse ? -1.0F : 1.0F) * speed * TA::elapsedTime;
+        position.y +=
+            TA::sign(endPosition.y - startPosition.y) * (reverse ? -1.0F : 1.0F) * speed * context->elapsedTime;
         if(exceedsBorder()) {
             position.y = (reverse ? startPosition.y : endPosition.y);
             reverse = !reverse;
@@ -4,7 +4,7 @@ void TA_NapalmFire::load(TA_Point position, float xsp) {
     this->position = position;
     velocity = {xsp, 0};
 
-    loadFromToml("objects/napalm_fire.toml");
+    loadFromToml(context, "objects/napalm_fire.toml");
     setAnimation("fire");
 
     TA_Rect explosionHitbox;
@@ -19,7 +19,7 @@ void TA_NapalmFire::load(TA_Point position, float xsp) {
 }
 
 bool TA_NapalmFire::update() {
-    auto [delta, flags] = objectSet->moveAndCollide(position, topLeft, bottomRight, velocity * TA::elapsedTime,
+    auto [delta, flags] = objectSet->moveAndCollide(position, topLeft, bottomRight, velocity * context->elapsedTime,
         TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP | TA_COLLISION_PUSHABLE, true);
     position += delta;
     if((flags & TA_WALL_COLLISION) != 0) {
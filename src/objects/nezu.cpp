@@ -7,7 +7,7 @@
 void TA_Nezu::load(TA_Point position) {
     this->position = position;
 
-    loadFromToml("objects/nezu.toml");
+    loadFromToml(context, "objects/nezu.toml");
     setAnimation("idle");
 
     hitbox.setRectangle(TA_Point(2, 3), TA_Point(13, 14));
@@ -68,7 +68,7 @@ void TA_Nezu::updateWalk() {
     setFlip(direction);
 
     TA_Point newPosition = position;
-    newPosition.x += speed * (direction ? 1 : -1) * TA::elapsedTime;
+    newPosition.x += speed * (direction ? 1 : -1) * context->elapsedTime;
     if(isBadPosition(newPosition) || isCloseToCharacter()) {
         state = STATE_ATTACK;
         bombPlaced = false;
@@ -84,7 +84,7 @@ void TA_Nezu::updateAttack() {
     setAnimation("idle");
     setFlip(false);
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > placeTime && !bombPlaced) {
         placeBomb();
         bombPlaced = true;
@@ -104,9 +104,9 @@ void TA_Nezu::placeBomb() {
 }
 
 bool TA_Nezu::updateFall() {
-    fallSpeed += gravity * TA::elapsedTime;
+    fallSpeed += gravity * context->elapsedTime;
     fallSpeed = std::min(fallSpeed, maxFallSpeed);
-    position.y += fallSpeed * TA::elapsedTime;
+    position.y += fallSpeed * context->elapsedTime;
 
     TA_Rect hitbox;
     hitbox.setRectangle(TA_Point(2, 0), TA_Point(14, 16));
@@ -170,12 +170,12 @@ bool TA_Nezu::isGoingToFall() {
 
 void TA_NezuBomb::load(TA_Point position) {
     this->position = position;
-    TA_Sprite::load("objects/nezu_bomb.png");
+    TA_Sprite::load(context, "objects/nezu_bomb.png");
     updatePosition();
 }
 
 bool TA_NezuBomb::update() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > waitTime) {
         objectSet->spawnObject<TA_Explosion>(position - TA_Point(4, 4), 0, TA_EXPLOSION_ENEMY);
         return false;
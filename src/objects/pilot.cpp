@@ -1,34 +1,36 @@
 #include "pilot.h"
-#include "bullet.h"
 #include "dead_kukku.h"
 #include "sea_fox.h"
 #include "tilemap.h"
 
 bool TA_PilotSpawner::update() {
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer < cooldown) {
         return true;
     }
-    if(objectSet->getCharacterPosition().x < static_cast<float>(TA::screenWidth) ||
+    if(objectSet->getCharacterPosition().x < static_cast<float>(context->screenWidth) ||
         objectSet->getCharacterPosition().x >
-            static_cast<float>(objectSet->getLinks().tilemap->getWidth() - TA::screenWidth)) {
+            static_cast<float>(objectSet->getLinks().tilemap->getWidth() - context->screenWidth)) {
         return true;
     }
 
-    if(TA::random::next() % 2 == 0) {
-        if(TA::random::next() % 2 == 0) {
-            objectSet->spawnObject<TA_Pilot>(TA_Point(0, TA::random::next() % 64 - 32));
+    if(TA::random::next(context) % 2 == 0) {
+        if(TA::random::next(context) % 2 == 0) {
+            objectSet->spawnObject<TA_Pilot>(TA_Point(0, TA::random::next(context) % 64 - 32));
         } else {
-            objectSet->spawnObject<TA_Pilot>(TA_Point(TA::random::next() % 16, TA::random::next() % 64 - 32));
-            objectSet->spawnObject<TA_Pilot>(TA_Point(48 + TA::random::next() % 16, TA::random::next() % 64 - 32));
+            objectSet->spawnObject<TA_Pilot>(
+                TA_Point(TA::random::next(context) % 16, TA::random::next(context) % 64 - 32));
+            objectSet->spawnObject<TA_Pilot>(
+                TA_Point(48 + TA::random::next(context) % 16, TA::random::next(context) % 64 - 32));
         }
     } else {
-        if(TA::random::next() % 2 == 0) {
-            objectSet->spawnObject<TA_DivingPilot>(TA_Point(0, TA::random::next() % 32 - 16));
+        if(TA::random::next(context) % 2 == 0) {
+            objectSet->spawnObject<TA_DivingPilot>(TA_Point(0, TA::random::next(context) % 32 - 16));
         } else {
-            objectSet->spawnObject<TA_DivingPilot>(TA_Point(TA::random::next() % 16, TA::random::next() % 32 - 16));
             objectSet->spawnObject<TA_DivingPilot>(
-                TA_Point(48 + TA::random::next() % 16, TA::random::next() % 32 - 16));
+                TA_Point(TA::random::next(context) % 16, TA::random::next(context) % 32 - 16));
+            objectSet->spawnObject<TA_DivingPilot>(
+                TA_Point(48 + TA::random::next(context) % 16, TA::random::next(context) % 32 - 16));
         }
     }
 
@@ -37,7 +39,7 @@ bool TA_PilotSpawner::update() {
 }
 
 void TA_Pilot::load(TA_Point offset) {
-    loadFromToml("objects/pilot.toml");
+    loadFromToml(context, "objects/pilot.toml");
     setAnimation("fly");
 
     flip = objectSet->getLinks().seaFox->getFlip();
@@ -47,7 +49,7 @@ void TA_Pilot::load(TA_Point offset) {
         position.x = objectSet->getLinks().camera->getPosition().x - static_cast<float>(getWidth()) - 8;
         offset.x *= -1;
     } else {
-        position.x = objectSet->getLinks().camera->getPosition().x + static_cast<float>(TA::screenWidth) + 8;
+        position.x = objectSet->getLinks().camera->getPosition().x + static_cast<float>(context->screenWidth) + 8;
     }
 
     position.y = objectSet->getCharacterPosition().y - 36;
@@ -62,17 +64,18 @@ bool TA_Pilot::update() {
         setAnimation("fly");
     }
 
-    float newYsp = std::max(minYSpeed, ysp - gravity * TA::elapsedTime);
+    float newYsp = std::max(minYSpeed, ysp - gravity * context->elapsedTime);
     if(ysp >= 0.4F && newYsp < 0.4F) {
-        objectSet->spawnObject<TA_PilotBullet>(position + TA_Point(flip ? 22 : -6, 24), TA_Point(flip ? 2 : -2, 0));
+        objectSet->getProjectiles().spawn(
+            TA_PROJECTILE_PILOT, position + TA_Point(flip ? 22 : -6, 24), TA_Point(flip ? 2 : -2, 0));
     }
     if(ysp >= -0.2F && newYsp < -0.2F) {
         setAnimation("look");
     }
     ysp = newYsp;
 
-    position.x += (flip ? 1.0F : -1.0F) * TA::elapsedTime;
-    position.y += ysp * TA::elapsedTime;
+    position.x += (flip ? 1.0F : -1.0F) * context->elapsedTime;
+    position.y += ysp * context->elapsedTime;
     updatePosition();
 
     int flags = objectSet->checkCollision(hitbox);
@@ -88,7 +91,7 @@ bool TA_Pilot::update() {
 }
 
 void TA_DivingPilot::load(TA_Point offset) {
-    loadFromToml("objects/pilot.toml");
+    loadFromToml(context, "objects/pilot.toml");
     setAnimation("dive");
 
     flip = objectSet->getLinks().seaFox->getFlip();
@@ -98,7 +101,7 @@ void TA_DivingPilot::load(TA_Point offset) {
         position.x = objectSet->getLinks().camera->getPosition().x - static_cast<float>(getWidth()) - 8;
         offset.x *= -1;
     } else {
-        position.x = objectSet->getLinks().camera->getPosition().x + static_cast<float>(TA::screenWidth) + 8;
+        position.x = objectSet->getLinks().camera->getPosition().x + static_cast<float>(context->screenWidth) + 8;
     }
 
     position.y = objectSet->getCharacterPosition().y - 96;
@@ -139,11 +142,12 @@ void TA_DivingPilot::updateDive() {
     static constexpr float diveTime = 60;
     static constexpr float fireTime = 30;
 
-    position += TA_Point(flip ? 0.5 : -0.5, 1) * TA::elapsedTime;
-    if(timer < fireTime && timer + TA::elapsedTime >= fireTime) {
-        objectSet->spawnObject<TA_PilotBullet>(position + TA_Point(flip ? 18 : -2, 21), TA_Point(flip ? 1 : -1, 2));
+    position += TA_Point(flip ? 0.5 : -0.5, 1) * context->elapsedTime;
+    if(timer < fireTime && timer + context->elapsedTime >= fireTime) {
+        objectSet->getProjectiles().spawn(
+            TA_PROJECTILE_PILOT, position + TA_Point(flip ? 18 : -2, 21), TA_Point(flip ? 1 : -1, 2));
     }
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > diveTime) {
         timer = 0;
         state = State::TURN_BACK;
@@ -152,7 +156,7 @@ void TA_DivingPilot::updateDive() {
 }
 
 void TA_DivingPilot::updateTurnBack() {
-    position += TA_Point(0, 1) * TA::elapsedTime;
+    position += TA_Point(0, 1) * context->elapsedTime;
 
     if(!isAnimated()) {
         state = State::FLY_BACK;
@@ -161,5 +165,5 @@ void TA_DivingPilot::updateTurnBack() {
 }
 
 void TA_DivingPilot::updateFlyBack() {
-    position += TA_Point(flip ? -4 : 4, 0) * TA::elapsedTime;
+    position += TA_Point(flip ? -4 : 4, 0) * context->elapsedTime;
 }
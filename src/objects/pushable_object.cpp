@@ -4,7 +4,7 @@
 #include "tools.h"
 
 void TA_PushableObject::load(std::string filename, TA_Point newPosition) {
-    TA_Sprite::load(filename);
+    TA_Sprite::load(context, filename);
     position = newPosition;
     hitbox.setRectangle(TA_Point(0.33, 0), TA_Point(getWidth() - 0.33, getHeight()));
     collisionType = TA_COLLISION_PUSHABLE;
@@ -26,11 +26,12 @@ bool TA_PushableObject::update() {
             velocity.x = -speed;
         }
     }
-    velocity.y += grv * TA::elapsedTime;
+    velocity.y += grv * context->elapsedTime;
 
     // TODO: actually fix pushable objects collision
     auto [delta, flags] = objectSet->moveAndCollide(position, TA_Point(1, 0), TA_Point(getWidth() - 1, getHeight()),
-        velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP, (TA::levelPath == "maps/pf/pf1"));
+        velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP,
+        objectSet->getLinks().level->groundPushables);
     position += delta;
     if(flags & TA_GROUND_COLLISION) {
         velocity.y = 0;
@@ -42,7 +43,7 @@ bool TA_PushableObject::update() {
 
 void TA_PushableSpring::load(TA_Point newPosition) {
     TA_PushableObject::load("objects/spring.png", newPosition);
-    springBounceSprite.load("objects/spring_bounce.png");
+    springBounceSprite.load(context, "objects/spring_bounce.png");
     springBounceSprite.setCamera(objectSet->getLinks().camera);
 
     HitboxVectorElement element;
@@ -27,6 +27,7 @@ public:
     void load(TA_Point newPosition);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 };
 
 #endif // TA_PUSHABLE_OBJECT_H
@@ -1,7 +1,7 @@
 #include "remote_robot_blocker.h"
 
 void TA_RemoteRobotBlocker::load(TA_Point position) {
-    loadFromToml("objects/remote_robot_blocker.toml");
+    loadFromToml(context, "objects/remote_robot_blocker.toml");
     setAnimation("idle");
     this->position = position;
     updatePosition();
@@ -1,5 +1,4 @@
 #include "ring.h"
-#include "save.h"
 #include "tilemap.h"
 #include "tools.h"
 
@@ -7,11 +6,12 @@ void TA_Ring::load(TA_Point position, TA_Point velocity, float delay) {
     this->position = position;
     this->velocity = velocity;
     this->delay = delay;
+    water = objectSet->getLinks().level->seaFox;
 
-    loadFromToml("objects/ring.toml");
+    loadFromToml(context, "objects/ring.toml");
     setAnimation("ring");
     hitbox.setRectangle({0, 0}, {7, 7});
-    ringSound.load("sound/ring.ogg", TA_SOUND_CHANNEL_SFX2);
+    ringSound.load("sound/ring.ogg", TA_SOUND_CHANNEL_SFX2, false, TA_SOUND_PRIORITY_LOW);
     setPosition(position);
 }
 
@@ -24,39 +24,43 @@ void TA_Ring::loadStationary(TA_Point position) {
     stationary = true;
 }
 
-bool TA_Ring::update() {
-    if(collected) {
-        return isAnimated();
+void TA_Ring::prepareUpdate() {
+    if(collected || stationary) {
+        return;
     }
 
-    if(!stationary) {
-        float currentGrv = (TA::save::getSaveParameter("seafox") == 1 ? waterGrv : grv);
-        velocity.y += currentGrv * TA::elapsedTime;
-        TA_Point topLeft{0, 0}, bottomRight{8, 8};
-        auto [delta, flags] = objectSet->moveAndCollide(
-            position, topLeft, bottomRight, velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
-        position += delta;
-        setPosition(position);
+    float currentGrv = (water ? waterGrv : grv);
+    velocity.y += currentGrv * context->elapsedTime;
+    TA_Point topLeft{0, 0}, bottomRight{8, 8};
+    auto [delta, flags] = objectSet->moveAndCollide(position, topLeft, bottomRight,
+        velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
+    position += delta;
+    setPosition(position);
 
-        if(velocity.x > 0) {
-            velocity.x = std::max(0.0F, velocity.x - drag * TA::elapsedTime);
-        } else {
-            velocity.x = std::min(0.0F, velocity.x + drag * TA::elapsedTime);
-        }
+    if(velocity.x > 0) {
+        velocity.x = std::max(0.0F, velocity.x - drag * context->elapsedTime);
+    } else {
+        velocity.x = std::min(0.0F, velocity.x + drag * context->elapsedTime);
+    }
 
-        if((flags & TA_GROUND_COLLISION) != 0 && velocity.y > 0) {
-            velocity.y *= -slowdown;
-            if(velocity.y > -0.5F) {
-                velocity.y = 0;
-            }
-        }
-        if((flags & TA_WALL_COLLISION) != 0) {
-            velocity.x *= -1;
-        }
-        if((flags & TA_CEIL_COLLISION) != 0 && velocity.y < 0) {
-            velocity.y *= -1;
+    if((flags & TA_GROUND_COLLISION) != 0 && velocity.y > 0) {
+        velocity.y *= -slowdown;
+        if(velocity.y > -0.5F) {
+            velocity.y = 0;
         }
     }
+    if((flags & TA_WALL_COLLISION) != 0) {
+        velocity.x *= -1;
+    }
+    if((flags & TA_CEIL_COLLISION) != 0 && velocity.y < 0) {
+        velocity.y *= -1;
+    }
+}
+
+bool TA_Ring::update() {
+    if(collected) {
+        return isAnimated();
+    }
 
     if(timer > delay) {
         hitbox.setPosition(position);
@@ -70,7 +74,7 @@ bool TA_Ring::update() {
         }
     }
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(!stationary && timer > maxTime) {
         return false;
     }
@@ -12,6 +12,7 @@ private:
     float delay = 0;
     bool stationary = false;
     bool collected = false;
+    bool water = false;
 
     static constexpr int maxTime = 300;
     static constexpr float grv = 0.125;
@@ -24,8 +25,12 @@ public:
     void load(TA_Point position, TA_Point velocity, float delay = 0);
     void load(TA_Point position, float startSpeed = -2);
     void loadStationary(TA_Point position);
+    void prepareUpdate() override;
     bool update() override;
     int getDrawPriority() override { return 1; }
+    TA_ActivationPolicy getActivationPolicy() override {
+        return (stationary && !collected ? TA_ACTIVATION_NEAR_CAMERA : TA_ACTIVATION_ALWAYS);
+    }
 };
 
 #endif // TA_RING_H
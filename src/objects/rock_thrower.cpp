@@ -6,7 +6,7 @@ void TA_RockThrower::load(TA_Point position, bool direction) {
     this->position = position;
     this->direction = direction;
 
-    loadFromToml("objects/rock_thrower.toml");
+    loadFromToml(context, "objects/rock_thrower.toml");
     setFlip(direction);
     setAnimation("idle");
 
@@ -35,7 +35,7 @@ bool TA_RockThrower::update() {
 void TA_RockThrower::updateIdle() {
     TA_Point distance = getDistanceToCharacter();
     if(abs(distance.x) <= 128 && abs(distance.y) <= 64) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
     } else {
         timer = 0;
     }
@@ -104,7 +104,7 @@ void TA_EnemyRock::load(TA_Point position, TA_Point velocity) {
     this->position = position;
     this->velocity = velocity;
 
-    loadFromToml("objects/enemy_rock.toml");
+    loadFromToml(context, "objects/enemy_rock.toml");
     setAnimation("rock");
 
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(6, 7));
@@ -124,7 +124,7 @@ bool TA_EnemyRock::update() {
 }
 
 void TA_EnemyRock::updateVelocity() {
-    float add = (ground ? friction : airDrag) * TA::elapsedTime;
+    float add = (ground ? friction : airDrag) * context->elapsedTime;
     if(velocity.x > add) {
         velocity.x -= add;
     } else if(velocity.x < -add) {
@@ -136,14 +136,14 @@ void TA_EnemyRock::updateVelocity() {
     if(ground) {
         velocity.y = 0;
     } else {
-        velocity.y += gravity * TA::elapsedTime;
+        velocity.y += gravity * context->elapsedTime;
         velocity.y = std::min(velocity.y, maxFallSpeed);
     }
 }
 
 void TA_EnemyRock::updateCollision() {
     auto [delta, flags] = objectSet->moveAndCollide(position, TA_Point(0, 0), TA_Point(6, 7),
-        velocity * TA::elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP, ground);
+        velocity * context->elapsedTime, TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP, ground);
     position += delta;
 
     ground = ((flags & TA_GROUND_COLLISION) != 0);
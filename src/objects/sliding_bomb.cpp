@@ -4,7 +4,7 @@
 #include "tools.h"
 
 void TA_SlidingBomb::load(TA_Point position, bool flip, bool* lock) {
-    loadFromToml("objects/sliding_bomb.toml");
+    loadFromToml(context, "objects/sliding_bomb.toml");
     setAnimation("idle");
     this->position = position;
     this->flip = flip;
@@ -15,8 +15,8 @@ void TA_SlidingBomb::load(TA_Point position, bool flip, bool* lock) {
 }
 
 bool TA_SlidingBomb::update() {
-    auto [delta, flags] =
-        objectSet->moveAndCollide(position, {3, 5}, {13, 16}, velocity * TA::elapsedTime, TA_COLLISION_SOLID, true);
+    auto [delta, flags] = objectSet->moveAndCollide(
+        position, {3, 5}, {13, 16}, velocity * context->elapsedTime, TA_COLLISION_SOLID, true);
     position += delta;
     updatePosition();
 
@@ -24,7 +24,7 @@ bool TA_SlidingBomb::update() {
         velocity.x = (flip ? -1.0F : 1.0F);
         velocity.y = 0;
     } else {
-        velocity.y += gravity * TA::elapsedTime;
+        velocity.y += gravity * context->elapsedTime;
     }
     if((flags & TA_WALL_COLLISION) != 0) {
         velocity.x = 0;
@@ -52,7 +52,7 @@ bool TA_SlidingBombSpawner::update() {
         return true;
     }
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > cooldown) {
         objectSet->spawnObject<TA_SlidingBomb>(position - TA_Point(0, 1), flip, &lock);
         lock = true;
@@ -1,9 +1,8 @@
 #include "sniper.h"
-#include "bullet.h"
 #include "dead_kukku.h"
 
 void TA_Sniper::load(TA_Point position) {
-    loadFromToml("objects/sniper.toml");
+    loadFromToml(context, "objects/sniper.toml");
     this->position = position;
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
     hitbox.setRectangle({9, 17}, {24, 32});
@@ -14,7 +13,7 @@ void TA_Sniper::load(TA_Point position) {
 bool TA_Sniper::update() {
     if(aim) {
         updateAim();
-        if((objectSet->checkCollision(hitbox) & TA_COLLISION_ATTACK) != 0) {
+        if((getContactFlags() & TA_COLLISION_ATTACK) != 0) {
             objectSet->spawnObject<TA_DeadKukku>(position + TA_Point(8, 0));
             return false;
         }
@@ -26,10 +25,10 @@ bool TA_Sniper::update() {
 }
 
 void TA_Sniper::updateAim() {
-    float newTimer = timer + TA::elapsedTime;
+    float newTimer = timer + context->elapsedTime;
     if(timer < fireTime && newTimer >= fireTime) {
-        objectSet->spawnObject<TA_SniperBullet>(
-            position + TA_Point((flip ? 27 : -1), 16), TA_Point((flip ? 1.5 : -1.5), 0));
+        objectSet->getProjectiles().spawn(
+            TA_PROJECTILE_SNIPER, position + TA_Point((flip ? 27 : -1), 16), TA_Point((flip ? 1.5 : -1.5), 0));
     }
     timer = newTimer;
 
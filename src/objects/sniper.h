@@ -5,6 +5,7 @@ public:
     using TA_Object::TA_Object;
     void load(TA_Point position);
     bool update() override;
+    TA_ActivationPolicy getActivationPolicy() override { return TA_ACTIVATION_NEAR_CAMERA; }
 
 private:
     static constexpr float fireTime = 20;
@@ -8,15 +8,15 @@
 #include "transition.h"
 
 void TA_Speedy::load() {
-    float leftX = 256 - static_cast<float>(TA::screenWidth) / 2;
+    float leftX = 256 - static_cast<float>(context->screenWidth) / 2;
     objectSet->spawnObject<TA_Transition>(TA_Point(leftX, 3888), TA_Point(leftX + 2, 4016), "maps/pm/pm3");
 
-    objectSet->getLinks().camera->setLockPosition({leftX, 112 - (TA::screenHeight - 144)});
+    objectSet->getLinks().camera->setLockPosition({leftX, 112 - (context->screenHeight - 144)});
     objectSet->getLinks().camera->forceLockX();
 
     if(isComplete()) {
         objectSet->spawnObject<TA_Transition>(
-            TA_Point(leftX + TA::screenWidth - 2, 3888), TA_Point(leftX + TA::screenWidth, 4016), 3, false);
+            TA_Point(leftX + context->screenWidth - 2, 3888), TA_Point(leftX + context->screenWidth, 4016), 3, false);
         return;
     }
 
@@ -25,15 +25,15 @@ void TA_Speedy::load() {
 }
 
 bool TA_Speedy::isComplete() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     return itemMask & (1ll << 33);
 }
 
 void TA_Speedy::loadSprite() {
-    loadFromToml("objects/speedy.toml");
+    loadFromToml(context, "objects/speedy.toml");
     hitbox.setRectangle(TA_Point(6, 10), TA_Point(20, 30));
 
-    characterPlaceholder.loadFromToml("tails/tails.toml");
+    characterPlaceholder.loadFromToml(context, "tails/tails.toml");
     characterPlaceholder.setCamera(objectSet->getLinks().camera);
 }
 
@@ -89,13 +89,13 @@ bool TA_Speedy::update() {
 
 void TA_Speedy::updateShow() {
     if(waiting) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > showWaitTime) {
             waiting = false;
         }
     } else {
-        velocity.y -= gravity * TA::elapsedTime;
-        position = position + velocity * TA::elapsedTime;
+        velocity.y -= gravity * context->elapsedTime;
+        position = position + velocity * context->elapsedTime;
     }
 
     characterPlaceholder.setPosition(objectSet->getLinks().character->getPosition());
@@ -144,7 +144,7 @@ void TA_Speedy::initAttack() {
 }
 
 void TA_Speedy::updateAttack() {
-    position.y += attackSpeed * TA::elapsedTime;
+    position.y += attackSpeed * context->elapsedTime;
     if(position.y > objectSet->getLinks().camera->getPosition().y + 200) {
         initFlyUp();
     }
@@ -160,7 +160,7 @@ void TA_Speedy::initFlyUp() {
     velocity = TA_Point(0, -flyUpSpeed);
     setAnimation("fly_up");
 
-    if(TA::random::next() % 2 == 0) {
+    if(TA::random::next(context) % 2 == 0) {
         flyUpPhase = 0;
         state = STATE_FLY_UP;
     } else {
@@ -169,7 +169,7 @@ void TA_Speedy::initFlyUp() {
 }
 
 void TA_Speedy::updateFlyUpSimple() {
-    position = position + velocity * TA::elapsedTime;
+    position = position + velocity * context->elapsedTime;
     if(position.y < objectSet->getLinks().camera->getPosition().y - 64) {
         initAttack();
     }
@@ -237,8 +237,8 @@ void TA_Speedy::updateEndSequence() {
 }
 
 void TA_Speedy::updateEndSequencePhase0() {
-    cpPosition.y -= TA::elapsedTime;
-    float needY = objectSet->getLinks().camera->getPosition().y + 48 + (TA::screenHeight - 144);
+    cpPosition.y -= context->elapsedTime;
+    float needY = objectSet->getLinks().camera->getPosition().y + 48 + (context->screenHeight - 144);
 
     if(cpPosition.y < needY) {
         endSequencePhase = 1;
@@ -249,10 +249,10 @@ void TA_Speedy::updateEndSequencePhase1() {
     const float needX = 176;
 
     if(cpPosition.x < needX) {
-        cpPosition.x += TA::elapsedTime;
+        cpPosition.x += context->elapsedTime;
         cpPosition.x = std::min(cpPosition.x, needX);
     } else {
-        cpPosition.x -= TA::elapsedTime;
+        cpPosition.x -= context->elapsedTime;
         cpPosition.x = std::max(cpPosition.x, needX);
     }
 
@@ -262,9 +262,9 @@ void TA_Speedy::updateEndSequencePhase1() {
 }
 
 void TA_Speedy::updateEndSequencePhase2() {
-    float needY = objectSet->getLinks().camera->getPosition().y + 89 + (TA::screenHeight - 144);
+    float needY = objectSet->getLinks().camera->getPosition().y + 89 + (context->screenHeight - 144);
 
-    cpPosition.y += TA::elapsedTime;
+    cpPosition.y += context->elapsedTime;
     if(cpPosition.y > needY) {
         cpPosition.y = needY;
         characterPlaceholder.setAnimation("idle");
@@ -275,9 +275,9 @@ void TA_Speedy::updateEndSequencePhase2() {
 }
 
 void TA_Speedy::updateEndSequencePhase3() {
-    velocity.y -= gravity * TA::elapsedTime;
+    velocity.y -= gravity * context->elapsedTime;
     velocity.y = std::max(velocity.y, float(0));
-    position = position + velocity * TA::elapsedTime;
+    position = position + velocity * context->elapsedTime;
 
     if(TA::equal(velocity.y, 0)) {
         setAnimation("throw");
@@ -296,12 +296,12 @@ void TA_Speedy::updateEndSequencePhase4() {
 
     velocity.x = (getCurrentFrame() == 4 ? 1 : -1);
     velocity.y = 0;
-    position = position + velocity * TA::elapsedTime;
+    position = position + velocity * context->elapsedTime;
 }
 
 void TA_Speedy::updateEndSequencePhase5() {
-    velocity.y -= gravity * TA::elapsedTime;
-    position = position + velocity * TA::elapsedTime;
+    velocity.y -= gravity * context->elapsedTime;
+    position = position + velocity * context->elapsedTime;
     float cameraY = objectSet->getLinks().camera->getPosition().y;
 
     if(position.x > 388 || position.y < cameraY - 36) {
@@ -327,8 +327,8 @@ void TA_Speedy::updateWaitItem() {
 }
 
 void TA_Speedy::updateFlyAway() {
-    cpVelocity.y -= flyAwayAcceleration * TA::elapsedTime;
-    cpPosition = cpPosition + cpVelocity * TA::elapsedTime;
+    cpVelocity.y -= flyAwayAcceleration * context->elapsedTime;
+    cpPosition = cpPosition + cpVelocity * context->elapsedTime;
     characterPlaceholder.setPosition(cpPosition);
 
     if(cpPosition.y < -48) {
@@ -347,11 +347,11 @@ void TA_Speedy::updateFlip() {
 }
 
 void TA_Speedy::doTransition() {
-    long long areaMask = TA::save::getSaveParameter("area_mask");
+    long long areaMask = TA::save::getSaveParameter(context, "area_mask");
     areaMask |= (1ll << 10);
-    TA::save::setSaveParameter("area_mask", areaMask);
-    TA::save::setSaveParameter("last_unlocked", 10);
-    TA::save::setSaveParameter("seafox", true);
+    TA::save::setSaveParameter(context, "area_mask", areaMask);
+    TA::save::setSaveParameter(context, "last_unlocked", 10);
+    TA::save::setSaveParameter(context, "seafox", true);
     objectSet->setTransition(TA_SCREENSTATE_HOUSE);
 }
 
@@ -68,6 +68,7 @@ public:
     void load();
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 };
 
 #endif // TA_SPEEDY_H
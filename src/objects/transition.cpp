@@ -21,10 +21,10 @@ bool TA_Transition::update() {
     if((flags & TA_COLLISION_CHARACTER) &&
         (!objectSet->getLinks().character || !objectSet->getLinks().character->isRemoteRobot())) {
         if(screenState == TA_SCREENSTATE_GAME) {
-            TA::levelPath = levelPath;
+            context->levelPath = levelPath;
         } else {
-            TA::save::setSaveParameter("map_selection", selection);
-            TA::save::setSaveParameter("seafox", seaFox);
+            TA::save::setSaveParameter(context, "map_selection", selection);
+            TA::save::setSaveParameter(context, "seafox", seaFox);
         }
         objectSet->setTransition(screenState);
     }
@@ -17,6 +17,7 @@ public:
     void load(TA_Point topLeft, TA_Point bottomRight, int selection, bool seaFox);
     bool update() override;
     void draw() override;
+    bool isCullable() override { return false; }
 };
 
 #endif // TA_TRANSITION_H
@@ -1,15 +1,14 @@
 #include "underwater_barrier.h"
-#include "particle.h"
 #include "save.h"
 #include "tools.h"
 
 void TA_UnderwaterBarrier::load(TA_Point position, std::string particlePath) {
-    if(TA::save::getSaveParameter("underwater_barrier_passed") == 1) {
+    if(TA::save::getSaveParameter(context, "underwater_barrier_passed") == 1) {
         passed = true;
         return;
     }
 
-    loadFromToml("objects/underwater_barrier.toml");
+    loadFromToml(context, "objects/underwater_barrier.toml");
     this->position = position;
     this->particlePath = particlePath;
     hitbox.setRectangle({0, 0}, {48, 32});
@@ -22,25 +21,25 @@ bool TA_UnderwaterBarrier::update() {
         return false;
     }
     if(timer < cooldown) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         return true;
     }
 
-    if((objectSet->checkCollision(hitbox) & TA_COLLISION_ATTACK) != 0) {
+    if((getContactFlags() & TA_COLLISION_ATTACK) != 0) {
         hp--;
         timer = 0;
         if(hp <= 0) {
             for(int i = 0; i < 4; i++) {
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particlePath, position + TA_Point(i * 16 + 2, 8), TA_Point(-0.5, -2), TA_Point(0, gravity));
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particlePath, position + TA_Point(i * 16 + 8, 8), TA_Point(0.5, -2), TA_Point(0, gravity));
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particlePath, position + TA_Point(i * 16 + 2, 18), TA_Point(-0.5, -0.5), TA_Point(0, gravity));
-                objectSet->spawnObject<TA_Particle>(
+                objectSet->getParticles().spawnDebris(
                     particlePath, position + TA_Point(i * 16 + 8, 18), TA_Point(0.5, -0.5), TA_Point(0, gravity));
             }
-            TA::save::setSaveParameter("underwater_barrier_passed", 1);
+            TA::save::setSaveParameter(context, "underwater_barrier_passed", 1);
             return false;
         }
     }
@@ -3,7 +3,7 @@
 #include "tools.h"
 
 void TA_UnderwaterGun::load(TA_Point position, bool flip) {
-    loadFromToml("objects/underwater_gun.toml");
+    loadFromToml(context, "objects/underwater_gun.toml");
     this->position = position;
     this->flip = flip;
     setFlip(flip);
@@ -14,7 +14,7 @@ void TA_UnderwaterGun::load(TA_Point position, bool flip) {
 
 bool TA_UnderwaterGun::update() {
     if(timer < cooldown) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         return true;
     }
 
@@ -32,7 +32,7 @@ bool TA_UnderwaterGun::update() {
 }
 
 void TA_UnderwaterBullet::load(TA_Point position, bool flip) {
-    loadFromToml("objects/underwater_bullet.toml");
+    loadFromToml(context, "objects/underwater_bullet.toml");
     this->position = position;
     this->flip = flip;
     hitbox.setRectangle({0, 0}, {8, 7});
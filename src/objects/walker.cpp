@@ -4,7 +4,7 @@
 #include "tools.h"
 
 void TA_Walker::load(TA_Point newPosition, int range, bool flip) {
-    loadFromToml("objects/pf_enemies.toml");
+    loadFromToml(context, "objects/pf_enemies.toml");
     hitbox.setRectangle(TA_Point(5, 0), TA_Point(18, 26));
     collisionType = TA_COLLISION_DAMAGE | TA_COLLISION_TARGET;
 
@@ -68,12 +68,12 @@ void TA_Walker::updateMove() {
     } else {
         setAnimation("walker");
         if(!direction) {
-            position.x += speed * TA::elapsedTime;
+            position.x += speed * context->elapsedTime;
             if(position.x > rangeRight) {
                 direction = true;
             }
         } else {
-            position.x -= speed * TA::elapsedTime;
+            position.x -= speed * context->elapsedTime;
             if(position.x < rangeLeft) {
                 direction = false;
             }
@@ -92,7 +92,7 @@ void TA_Walker::updateFire() {
     } else {
         setAnimation("walker_fire");
     }
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > fireTime) {
         objectSet->spawnObject<TA_WalkerBullet>(position + TA_Point((direction ? -1 : 16), 16), direction);
         state = TA_WALKER_STATE_MOVE_AWAY;
@@ -106,12 +106,12 @@ void TA_Walker::updateMoveAway() {
     }
     setAnimation("walker");
     if(!direction) {
-        position.x -= speed * TA::elapsedTime;
+        position.x -= speed * context->elapsedTime;
         if(position.x < rangeLeft) {
             state = TA_WALKER_STATE_MOVE;
         }
     } else {
-        position.x += speed * TA::elapsedTime;
+        position.x += speed * context->elapsedTime;
         if(position.x > rangeRight) {
             state = TA_WALKER_STATE_MOVE;
         }
@@ -125,7 +125,7 @@ TA_Point TA_Walker::getDistanceToCharacter() {
 }
 
 void TA_WalkerBullet::load(TA_Point newPosition, bool newDirection) {
-    TA_Sprite::load("objects/walker_bullet.png");
+    TA_Sprite::load(context, "objects/walker_bullet.png");
     position = newPosition;
     direction = newDirection;
     hitbox.setRectangle(TA_Point(0, 0), TA_Point(7, 7));
@@ -134,9 +134,9 @@ void TA_WalkerBullet::load(TA_Point newPosition, bool newDirection) {
 
 bool TA_WalkerBullet::update() {
     if(direction) {
-        position.x -= speed * TA::elapsedTime;
+        position.x -= speed * context->elapsedTime;
     } else {
-        position.x += speed * TA::elapsedTime;
+        position.x += speed * context->elapsedTime;
     }
     setPosition(position);
     hitbox.setPosition(position);
@@ -33,6 +33,7 @@ public:
     using TA_Object::TA_Object;
     void load(TA_Point newPosition, int range, bool flip);
     bool update() override;
+    TA_ActivationPolicy getActivationPolicy() override { return TA_ACTIVATION_NEAR_CAMERA; }
 };
 
 class TA_WalkerBullet : public TA_Object { // TODO: reimplement TA_WalkerBullet as inheritor of TA_Bullet
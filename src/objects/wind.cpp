@@ -10,9 +10,8 @@ void TA_Wind::load(TA_Point topLeft, TA_Point bottomRight, TA_Point velocity, co
 bool TA_Wind::update() {
     if(shouldBlow()) {
         objectSet->getLinks().character->setWindVelocity(velocity);
-        timer += TA::elapsedTime;
-        // TODO: don't hardcode this, make level option like wind_as_flow
-        if(timer > leafSpawnTime && TA::levelPath.substr(0, 7) != "maps/ci") {
+        timer += context->elapsedTime;
+        if(timer > leafSpawnTime && !objectSet->getLinks().level->windAsFlow) {
             spawnLeaf();
             timer = 0;
         }
@@ -24,13 +23,13 @@ bool TA_Wind::update() {
 }
 
 bool TA_Wind::shouldBlow() {
-    if((objectSet->checkCollision(hitbox) & TA_COLLISION_CHARACTER) == 0) {
+    if((getContactFlags() & TA_COLLISION_CHARACTER) == 0) {
         return false;
     }
     if(objectSet->getLinks().character->isRemoteRobot()) {
         return false;
     }
-    if(TA::levelPath.substr(0, 7) == "maps/ci") {
+    if(objectSet->getLinks().level->windAsFlow) {
         return objectSet->getLinks().character->isInWater();
     }
     return objectSet->getLinks().character->isFlying();
@@ -44,7 +43,7 @@ void TA_Wind::spawnLeaf() {
     leafVelocity.x = (TA::equal(velocity.x, 0) ? 0 : TA::sign(velocity.x) * 12);
     leafVelocity.y = (TA::equal(velocity.y, 0) ? 0 : TA::sign(velocity.y) * 12);
 
-    objectSet->spawnObject<TA_Leaf>(leafPosition, leafVelocity, animation);
+    objectSet->getParticles().spawnLeaf(leafPosition, leafVelocity, animation);
 }
 
 // TODO: actual uniform distribution
@@ -64,21 +63,21 @@ TA_Wind::Side TA_Wind::getRandomLeafSide() {
         sides.push_back(SIDE_RIGHT);
     }
 
-    int pos = TA::random::next() % (int)sides.size();
+    int pos = TA::random::next(context) % (int)sides.size();
     return sides[pos];
 }
 
 TA_Point TA_Wind::getRandomPointOnSide(Side side) {
-    int width = TA::screenWidth, height = TA::screenHeight;
+    int width = context->screenWidth, height = context->screenHeight;
     switch(side) {
         case SIDE_UP:
-            return TA_Point(TA::random::next() % width, -16);
+            return TA_Point(TA::random::next(context) % width, -16);
         case SIDE_DOWN:
-            return TA_Point(TA::random::next() % width, height + 16);
+            return TA_Point(TA::random::next(context) % width, height + 16);
         case SIDE_LEFT:
-            return TA_Point(-16, TA::random::next() % height);
+            return TA_Point(-16, TA::random::next(context) % height);
         case SIDE_RIGHT:
-            return TA_Point(width + 16, TA::random::next() % height);
+            return TA_Point(width + 16, TA::random::next(context) % height);
     }
     return TA_Point(0, 0);
 }
@@ -88,7 +87,7 @@ void TA_StrongWind::load(TA_Point topLeft, TA_Point bottomRight) {
 }
 
 bool TA_StrongWind::shouldBlow() {
-    if(objectSet->checkCollision(hitbox) & TA_COLLISION_CHARACTER) {
+    if(getContactFlags() & TA_COLLISION_CHARACTER) {
         blowing = true;
     }
     if(objectSet->getLinks().character->isOnGround() || objectSet->getLinks().character->isOnCeiling() ||
@@ -101,24 +100,3 @@ bool TA_StrongWind::shouldBlow() {
     }
     return blowing;
 }
-
-void TA_Leaf::load(TA_Point position, TA_Point velocity, const std::string& animation) {
-    loadFromToml("objects/leaf.toml");
-    setAnimation(animation);
-    setCamera(nullptr);
-
-    this->position = position;
-    this->velocity = velocity;
-    updatePosition();
-}
-
-bool TA_Leaf::update() {
-    position = position + velocity * TA::elapsedTime;
-    updatePosition();
-
-    timer += TA::elapsedTime;
-    if(timer > existTime) {
-        return false;
-    }
-    return true;
-}
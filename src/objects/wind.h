@@ -38,17 +38,4 @@ public:
     void load(TA_Point topLeft, TA_Point bottomRight);
 };
 
-class TA_Leaf : public TA_Object {
-private:
-    const float existTime = 200;
-
-    TA_Point velocity;
-    float timer = 0;
-
-public:
-    using TA_Object::TA_Object;
-    void load(TA_Point position, TA_Point velocity, const std::string& animation);
-    bool update();
-};
-
 #endif // TA_WIND_H
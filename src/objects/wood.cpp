@@ -2,9 +2,9 @@
 #include "dead_kukku.h"
 
 void TA_Wood::load(TA_Point position) {
-    loadFromToml("objects/wood.toml");
+    loadFromToml(context, "objects/wood.toml");
     setAnimation("wood");
-    birdSprite.loadFromToml("objects/jumper.toml");
+    birdSprite.loadFromToml(context, "objects/jumper.toml");
     birdSprite.setAnimation("jump");
     birdSprite.setCamera(objectSet->getLinks().camera);
 
@@ -45,12 +45,12 @@ void TA_Wood::draw() {
 }
 
 void TA_Wood::updateIdle() {
-    float camRightX = objectSet->getLinks().camera->getPosition().x + TA::screenWidth;
+    float camRightX = objectSet->getLinks().camera->getPosition().x + context->screenWidth;
     if(camRightX < startPosition.x && startPosition.x < camRightX + 64) {
         position = startPosition;
         ground = false;
         idle = false;
-        bird = (TA::random::next() % 2 == 0);
+        bird = (TA::random::next(context) % 2 == 0);
     }
 }
 
@@ -58,7 +58,7 @@ void TA_Wood::updateAttack() {
     if(ground) {
         velocity = {-1, 0};
     } else {
-        velocity.y = std::min(maxYSpeed, velocity.y + gravity * TA::elapsedTime);
+        velocity.y = std::min(maxYSpeed, velocity.y + gravity * context->elapsedTime);
     }
 
     if(bird && (objectSet->checkCollision(hitboxVector[0].hitbox) & TA_COLLISION_ATTACK) != 0) {
@@ -66,8 +66,8 @@ void TA_Wood::updateAttack() {
         bird = false;
     }
 
-    auto [delta, flags] =
-        objectSet->moveAndCollide(position, {0, 0}, {16, 16}, velocity * TA::elapsedTime, TA_COLLISION_SOLID, ground);
+    auto [delta, flags] = objectSet->moveAndCollide(
+        position, {0, 0}, {16, 16}, velocity * context->elapsedTime, TA_COLLISION_SOLID, ground);
     position += delta;
     ground = (flags & TA_GROUND_COLLISION) != 0;
 
@@ -3,21 +3,28 @@
 #include "resource_manager.h"
 #include "save.h"
 
-void TA_AreaSelector::load() {
-    controller.load();
+void TA_AreaSelector::load(TA_Context* newContext) {
+    context = newContext;
+    controller.load(context);
+    tailsIcon.loadFromToml(context, "worldmap/tails_icon.toml");
+    switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
+}
+
+void TA_AreaSelector::reset() {
+    // the points depend on the save, so they are rebuilt on every visit
+    points.clear();
     appendPoints();
     addSelectedArea();
     setActivePoints();
-    loadTailsIcon();
-    switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
+    tailsIcon.setAnimation(TA::save::getSaveParameter(context, "seafox") ? "seafox" : "blink");
 }
 
 void TA_AreaSelector::appendPoints() {
-    float xOffset = (TA::screenWidth - 256) / 2;
-    float yOffset = (TA::screenHeight - 144) / 2;
+    float xOffset = (context->screenWidth - 256) / 2;
+    float yOffset = (context->screenHeight - 144) / 2;
 
     toml::array tomlPoints;
-    if(TA::save::getSaveParameter("seafox") == 1) {
+    if(TA::save::getSaveParameter(context, "seafox") == 1) {
         tomlPoints = TA::resmgr::loadToml("worldmap/points.toml").at("seafox").as_array();
     } else {
         tomlPoints = TA::resmgr::loadToml("worldmap/points.toml").at("main").as_array();
@@ -28,7 +35,7 @@ void TA_AreaSelector::appendPoints() {
         std::string path = (element.contains("path") ? element.at("path").as_string() : "");
         float x = static_cast<float>(element.at("x").as_integer());
         float y = static_cast<float>(element.at("y").as_integer());
-        points.emplace_back(name, path, TA_Point(x + xOffset, y + yOffset));
+        points.emplace_back(context, name, path, TA_Point(x + xOffset, y + yOffset));
 
         if(element.contains("up")) {
             points.back().setNeighbour(TA_DIRECTION_UP, static_cast<int>(element.at("up").as_integer()));
@@ -44,26 +51,26 @@ void TA_AreaSelector::appendPoints() {
         }
     }
 
-    pos = TA::save::getSaveParameter("map_selection");
+    pos = TA::save::getSaveParameter(context, "map_selection");
 }
 
 void TA_AreaSelector::addSelectedArea() {
-    long long areaMask = TA::save::getSaveParameter("area_mask");
-    int index = TA::save::getSaveParameter("map_selection");
-    if(TA::save::getSaveParameter("seafox")) {
+    long long areaMask = TA::save::getSaveParameter(context, "area_mask");
+    int index = TA::save::getSaveParameter(context, "map_selection");
+    if(TA::save::getSaveParameter(context, "seafox")) {
         index += 9;
     }
 
     if((areaMask & (1ll << index)) == 0) {
         areaMask |= (1ll << index);
-        TA::save::setSaveParameter("area_mask", areaMask);
-        TA::save::setSaveParameter("last_unlocked", index);
+        TA::save::setSaveParameter(context, "area_mask", areaMask);
+        TA::save::setSaveParameter(context, "last_unlocked", index);
     }
 }
 
 void TA_AreaSelector::setActivePoints() {
-    int mask = TA::save::getSaveParameter("area_mask");
-    int add = (TA::save::getSaveParameter("seafox") ? 9 : 0);
+    int mask = TA::save::getSaveParameter(context, "area_mask");
+    int add = (TA::save::getSaveParameter(context, "seafox") ? 9 : 0);
     for(int level = 0; level < (int)points.size(); level++) {
         if(mask & (1 << (level + add))) {
             points[level].activate();
@@ -71,11 +78,6 @@ void TA_AreaSelector::setActivePoints() {
     }
 }
 
-void TA_AreaSelector::loadTailsIcon() {
-    tailsIcon.loadFromToml("worldmap/tails_icon.toml");
-    tailsIcon.setAnimation(TA::save::getSaveParameter("seafox") ? "seafox" : "blink");
-}
-
 TA_ScreenState TA_AreaSelector::update() {
     controller.update();
     if(controller.isJustChangedDirection()) {
@@ -94,12 +96,12 @@ TA_ScreenState TA_AreaSelector::update() {
         }
     }
 
-    TA::save::setSaveParameter("map_selection", pos);
+    TA::save::setSaveParameter(context, "map_selection", pos);
     tailsIcon.setPosition(points[pos].getPosition() + TA_Point(-2, 8));
 
     if(controller.isJustPressed(TA_BUTTON_A) || controller.isJustPressed(TA_BUTTON_B) || points[pos].updateButton()) {
-        TA::levelPath = points[pos].getPath();
-        if(TA::levelPath == "") {
+        context->levelPath = points[pos].getPath();
+        if(context->levelPath == "") {
             return TA_SCREENSTATE_HOUSE;
         }
         return TA_SCREENSTATE_GAME;
@@ -108,7 +110,7 @@ TA_ScreenState TA_AreaSelector::update() {
 }
 
 void TA_AreaSelector::draw() {
-    if(TA::save::getSaveParameter("seafox") == 0) {
+    if(TA::save::getSaveParameter(context, "seafox") == 0) {
         for(int pos = 1; pos < (int)points.size(); pos++) {
             points[pos].draw();
         }
@@ -121,7 +123,8 @@ std::string TA_AreaSelector::getSelectionName() {
     return points[pos].getName();
 }
 
-TA_MapPoint::TA_MapPoint(std::string name, std::string path, TA_Point position) {
+TA_MapPoint::TA_MapPoint(TA_Context* context, std::string name, std::string path, TA_Point position) {
+    this->context = context;
     this->position = position;
     this->name = name;
     this->path = path;
@@ -129,7 +132,7 @@ TA_MapPoint::TA_MapPoint(std::string name, std::string path, TA_Point position)
         neighbours[direction] = -1;
     }
 
-    sprite.load("worldmap/selection.png");
+    sprite.load(context, "worldmap/selection.png");
     sprite.setPosition(position);
     button.setRectangle(position - TA_Point(4, 4), position + TA_Point(16, 16));
 }
@@ -143,7 +146,7 @@ void TA_MapPoint::draw() {
     if(!active) {
         return;
     }
-    timer = fmod(timer + TA::elapsedTime, lightTime * 2);
+    timer = fmod(timer + context->elapsedTime, lightTime * 2);
     if(timer < lightTime) {
         sprite.setAlpha(255 * timer / appearTime);
     } else {
@@ -14,16 +14,17 @@ private:
     void appendPoints();
     void addSelectedArea();
     void setActivePoints();
-    void loadTailsIcon();
 
     TA_Controller controller;
     std::vector<TA_MapPoint> points;
     TA_Sprite tailsIcon;
     TA_Sound switchSound;
+    TA_Context* context = nullptr;
     int pos;
 
 public:
-    void load();
+    void load(TA_Context* newContext);
+    void reset();
     TA_ScreenState update();
     std::string getSelectionName();
     void draw();
@@ -35,6 +36,7 @@ private:
 
     TA_Sprite sprite;
     TA_OnscreenButton button;
+    TA_Context* context;
     TA_Point position;
     std::string name = "", path = "";
     std::array<int, TA_DIRECTION_MAX> neighbours;
@@ -43,7 +45,7 @@ private:
     float timer = 0;
 
 public:
-    TA_MapPoint(std::string name, std::string path, TA_Point position);
+    TA_MapPoint(TA_Context* context, std::string name, std::string path, TA_Point position);
     void setNeighbour(TA_Direction direction, int neighbour) { neighbours[direction] = neighbour; }
     void activate() { active = true; }
     bool updateButton();
@@ -5,21 +5,21 @@
 #include "save.h"
 
 void TA_DataSelectSection::load() {
-    entrySprite.load("data_select/entry.png");
-    selectorRedSprite.load("data_select/selector.png", 48, 72);
-    selectorWhiteSprite.load("data_select/selector.png", 48, 72);
-    previewSprite.load("data_select/preview.png", 46, 46);
-    optionsSprite.load("data_select/options.png");
+    entrySprite.load(context, "data_select/entry.png");
+    selectorRedSprite.load(context, "data_select/selector.png", 48, 72);
+    selectorWhiteSprite.load(context, "data_select/selector.png", 48, 72);
+    previewSprite.load(context, "data_select/preview.png", 46, 46);
+    optionsSprite.load(context, "data_select/options.png");
 
-    font.loadFont("fonts/pause_menu.toml");
-    splashFont.loadFont("fonts/splash.toml");
+    font.loadFont(context, "fonts/pause_menu.toml");
+    splashFont.loadFont(context, "fonts/splash.toml");
 
     switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
     selectSound.load("sound/select_item.ogg", TA_SOUND_CHANNEL_SFX1);
     loadSaveSound.load("sound/load_save.ogg", TA_SOUND_CHANNEL_SFX1);
 
     for(int pos = 0; pos < 9; pos++) {
-        TA_Point topLeft{menuStart + menuOffset * pos, (float)TA::screenHeight / 2 - entrySprite.getHeight() / 2};
+        TA_Point topLeft{menuStart + menuOffset * pos, (float)context->screenHeight / 2 - entrySprite.getHeight() / 2};
         TA_Point bottomRight = topLeft + TA_Point(48, (pos == 0 ? 48 : 72));
         buttons[pos].setRectangle(topLeft, bottomRight);
     }
@@ -27,9 +27,15 @@ void TA_DataSelectSection::load() {
     splashSequence = generateSplashSequence();
 }
 
+void TA_DataSelectSection::reset() {
+    locked = false;
+    timer = 0;
+    createdSave = -1;
+}
+
 TA_MainMenuState TA_DataSelectSection::update() {
     if(locked) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > loadTime) {
             return TA_MAIN_MENU_EXIT;
         }
@@ -57,11 +63,11 @@ TA_MainMenuState TA_DataSelectSection::processSelection() {
         return TA_MAIN_MENU_OPTIONS;
     }
 
-    if(!TA::save::saveExists(selection - 1)) {
+    if(!TA::save::saveExists(context, selection - 1)) {
         createdSave = selection - 1;
     }
-    TA::save::repairSave("save_" + std::to_string(selection - 1));
-    TA::save::setCurrentSave("save_" + std::to_string(selection - 1));
+    TA::save::repairSave(context, "save_" + std::to_string(selection - 1));
+    TA::save::setCurrentSave(context, "save_" + std::to_string(selection - 1));
     loadSaveSound.play();
     locked = true;
     return TA_MAIN_MENU_DATA_SELECT;
@@ -72,29 +78,29 @@ void TA_DataSelectSection::updateScroll() {
         scrollVelocity = TA::touchscreen::getScrollVector().x;
     } else if(!TA::equal(scrollVelocity, 0)) {
         if(scrollVelocity > 0) {
-            scrollVelocity = std::max((float)0, scrollVelocity - scrollSlowdown * TA::elapsedTime);
+            scrollVelocity = std::max((float)0, scrollVelocity - scrollSlowdown * context->elapsedTime);
         } else {
-            scrollVelocity = std::min((float)0, scrollVelocity + scrollSlowdown * TA::elapsedTime);
+            scrollVelocity = std::min((float)0, scrollVelocity + scrollSlowdown * context->elapsedTime);
         }
     }
 
     position += scrollVelocity;
     position = std::max(position, float(0));
-    position = std::min(position, menuStart + 9 * menuOffset - TA::screenWidth);
+    position = std::min(position, menuStart + 9 * menuOffset - context->screenWidth);
 }
 
 void TA_DataSelectSection::updateSelection() {
-    // menuStart + selection * menuOffset + 24 - need = TA::screenWidth / 2
-    float need = menuStart + selection * menuOffset + 24 - (float)TA::screenWidth / 2;
+    // menuStart + selection * menuOffset + 24 - need = context->screenWidth / 2
+    float need = menuStart + selection * menuOffset + 24 - (float)context->screenWidth / 2;
     need = std::max(need, float(0));
-    need = std::min(need, menuStart + 9 * menuOffset - TA::screenWidth);
+    need = std::min(need, menuStart + 9 * menuOffset - context->screenWidth);
 
     if(!TA::equal(position, need)) {
         if(position > need) {
-            position = std::max(need, position - scrollSpeed * TA::elapsedTime);
+            position = std::max(need, position - scrollSpeed * context->elapsedTime);
         }
         if(position < need) {
-            position = std::min(need, position + scrollSpeed * TA::elapsedTime);
+            position = std::min(need, position + scrollSpeed * context->elapsedTime);
         }
     } else if(controller->isJustChangedDirection()) {
         if(selection - 1 >= 0 && controller->getDirection() == TA_DIRECTION_LEFT) {
@@ -134,7 +140,7 @@ void TA_DataSelectSection::draw() {
 
 void TA_DataSelectSection::drawCustomEntries() {
     optionsSprite.setAlpha(alpha);
-    optionsSprite.setPosition(menuStart - position, (float)TA::screenHeight / 2 - entrySprite.getHeight() / 2);
+    optionsSprite.setPosition(menuStart - position, (float)context->screenHeight / 2 - entrySprite.getHeight() / 2);
     optionsSprite.draw();
 }
 
@@ -144,12 +150,12 @@ void TA_DataSelectSection::drawSaveEntries() {
     font.setAlpha(255 * ((float)alpha / 255) * ((float)alpha / 255));
 
     for(int num = 0; num < 8; num++) {
-        TA_Point entryPosition{
-            menuStart + (num + 1) * menuOffset - position, (float)TA::screenHeight / 2 - entrySprite.getHeight() / 2};
+        TA_Point entryPosition{menuStart + (num + 1) * menuOffset - position,
+            (float)context->screenHeight / 2 - entrySprite.getHeight() / 2};
         entrySprite.setPosition(entryPosition);
         entrySprite.draw();
 
-        if(TA::save::saveExists(num) && num != createdSave) {
+        if(TA::save::saveExists(context, num) && num != createdSave) {
             previewSprite.setFrame(TA::save::getParameter("save_" + std::to_string(num) + "/last_unlocked"));
         } else {
             previewSprite.setFrame(0);
@@ -168,23 +174,23 @@ void TA_DataSelectSection::drawModCount() {
     if(total >= 1) {
         std::string text = "M " + std::to_string(loaded) + "/" + std::to_string(total);
         font.setAlpha(alpha);
-        font.drawText(TA_Point(TA::screenWidth - font.getTextWidth(text) - 8, 9), text);
+        font.drawText(TA_Point(context->screenWidth - font.getTextWidth(text) - 8, 9), text);
     }
 }
 
 void TA_DataSelectSection::drawSplash() {
     static constexpr float spashInterval = 4;
 
-    splashTimer += TA::elapsedTime;
+    splashTimer += context->elapsedTime;
     int pos = static_cast<int>(splashTimer / spashInterval);
     pos = std::min(pos, static_cast<int>(splashSequence.size()) - 1);
 
     splashFont.setAlpha(alpha);
-    splashFont.drawTextCentered(TA::screenHeight - 24, splashSequence[pos], TA_Point(-1, 0));
+    splashFont.drawTextCentered(context->screenHeight - 24, splashSequence[pos], TA_Point(-1, 0));
 }
 
 void TA_DataSelectSection::drawSelector() {
-    selectorTimer += TA::elapsedTime;
+    selectorTimer += context->elapsedTime;
     selectorRedSprite.setAlpha(alpha);
     selectorWhiteSprite.setAlpha(TA::linearInterpolation(0, alpha, selectorTimer / selectorBlinkTime));
 
@@ -212,15 +218,15 @@ void TA_DataSelectSection::drawSelector() {
         selectorWhiteSprite.setFrame(3);
     }
 
-    selectorRedSprite.setPosition(
-        menuStart + selectorPosition * menuOffset - position, TA::screenHeight / 2 - selectorRedSprite.getHeight() / 2);
+    selectorRedSprite.setPosition(menuStart + selectorPosition * menuOffset - position,
+        context->screenHeight / 2 - selectorRedSprite.getHeight() / 2);
     selectorWhiteSprite.setPosition(selectorRedSprite.getPosition());
     selectorRedSprite.draw();
     selectorWhiteSprite.draw();
 }
 
 int TA_DataSelectSection::getSavePercent(int save) {
-    if(!TA::save::saveExists(save) || save == createdSave) {
+    if(!TA::save::saveExists(context, save) || save == createdSave) {
         return 0;
     }
 
@@ -231,7 +237,7 @@ int TA_DataSelectSection::getSavePercent(int save) {
 }
 
 std::string TA_DataSelectSection::getSaveTime(int save) {
-    if(!TA::save::saveExists(save) || save == createdSave) {
+    if(!TA::save::saveExists(context, save) || save == createdSave) {
         return "--:--";
     }
 
@@ -254,14 +260,14 @@ std::vector<std::string> TA_DataSelectSection::generateSplashSequence() {
     std::vector<int> permutation(splash.size());
     std::iota(permutation.begin(), permutation.end(), 0);
     for(int i = 0; i < splash.size(); i++) {
-        std::swap(permutation[i], permutation[TA::random::next() % splash.size()]);
+        std::swap(permutation[i], permutation[TA::random::next(context) % splash.size()]);
     }
 
     std::vector<int> positions(sequenceSize + 1);
     positions[0] = 0;
     positions[sequenceSize] = static_cast<int>(splash.size());
     for(int i = 1; i < sequenceSize; i++) {
-        positions[i] = static_cast<int>(TA::random::next() % splash.size());
+        positions[i] = static_cast<int>(TA::random::next(context) % splash.size());
     }
     std::ranges::sort(positions);
 
@@ -276,10 +282,10 @@ std::vector<std::string> TA_DataSelectSection::generateSplashSequence() {
         sequence[i] = splash;
         for(int j = 0; j < splash.size(); j++) {
             if(splash[j] != ' ' && !stable.contains(j)) {
-                if(TA::random::next() % 5 != 0) {
-                    sequence[i][j] = static_cast<char>('a' + (TA::random::next() % 26));
+                if(TA::random::next(context) % 5 != 0) {
+                    sequence[i][j] = static_cast<char>('a' + (TA::random::next(context) % 26));
                 } else {
-                    sequence[i][j] = static_cast<char>('A' + (TA::random::next() % 26));
+                    sequence[i][j] = static_cast<char>('A' + (TA::random::next(context) % 26));
                 }
             }
         }
@@ -306,5 +312,5 @@ std::string TA_DataSelectSection::generateSplash() {
         "Flint and Steel!",
     };
 
-    return splashes[TA::random::next() % static_cast<int>(splashes.size())];
+    return splashes[TA::random::next(context) % static_cast<int>(splashes.size())];
 }
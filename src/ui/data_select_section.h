@@ -12,6 +12,7 @@ public:
     TA_MainMenuState update() override;
     void setAlpha(int alpha) override { this->alpha = alpha; }
     void draw() override;
+    void reset() override;
 
 private:
     const float menuStart = 16;
@@ -2,7 +2,7 @@
 #include "save.h"
 
 void TA_DevmenuScreen::init() {
-    controller.load();
+    controller.load(context);
     levels.emplace_back("maps/pf/pf1");
     levels.emplace_back("maps/pf/pf2");
     levels.emplace_back("maps/pf/pf3");
@@ -38,8 +38,8 @@ void TA_DevmenuScreen::init() {
     levels.emplace_back("maps/cc/cc3");
     levels.emplace_back("maps/bf/bf1");
     levels.emplace_back("maps/bf/bf2");
-    normalFont.loadFont("fonts/devmenu.toml");
-    selectedFont.loadFont("fonts/devmenu_selected.toml");
+    normalFont.loadFont(context, "fonts/devmenu.toml");
+    selectedFont.loadFont(context, "fonts/devmenu_selected.toml");
 }
 
 TA_ScreenState TA_DevmenuScreen::update() {
@@ -91,9 +91,9 @@ TA_ScreenState TA_DevmenuScreen::update() {
     }
 
     if(controller.isJustPressed(TA_BUTTON_A) || controller.isJustPressed(TA_BUTTON_B)) {
-        TA::levelPath = levels[levelPosition];
-        TA::save::repairSave("save_0");
-        TA::save::setCurrentSave("save_0");
+        context->levelPath = levels[levelPosition];
+        TA::save::repairSave(context, "save_0");
+        TA::save::setCurrentSave(context, "save_0");
         return TA_SCREENSTATE_GAME;
     }
     return TA_SCREENSTATE_CURRENT;
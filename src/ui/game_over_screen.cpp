@@ -4,16 +4,16 @@
 #include "tools.h"
 
 void TA_GameOverScreen::init() {
-    gameOverSprite.load("gameover/gameover.png");
-    controller.load();
+    gameOverSprite.load(context, "gameover/gameover.png");
+    controller.load(context);
     TA::sound::playMusic("sound/game_over.vgm", 0);
-    button.setRectangle(TA_Point(0, 0), TA_Point(TA::screenWidth, TA::screenHeight));
+    button.setRectangle(TA_Point(0, 0), TA_Point(context->screenWidth, context->screenHeight));
 }
 
 TA_ScreenState TA_GameOverScreen::update() {
-    TA::drawScreenRect(17, 17, 153, 255);
-    gameOverSprite.setPosition(
-        TA::screenWidth / 2 - gameOverSprite.getWidth() / 2, TA::screenHeight / 2 - gameOverSprite.getHeight() / 2);
+    TA::drawScreenRect(context, 17, 17, 153, 255);
+    gameOverSprite.setPosition(context->screenWidth / 2 - gameOverSprite.getWidth() / 2,
+        context->screenHeight / 2 - gameOverSprite.getHeight() / 2);
     gameOverSprite.draw();
 
     controller.update();
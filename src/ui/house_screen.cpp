@@ -3,15 +3,14 @@
 #include "tools.h"
 
 void TA_HouseScreen::init() {
-    interfaceSprite.load("house/interface.png");
-    houseSprite.load("house/house.png");
-    houseSeaFoxSprite.load("house/house_seafox.png");
-    clawSprite.load("house/claw.png");
-    seaFoxSprite.load("house/seafox.png");
-    curtainSprite.load("house/curtain.png");
-    selectorSprite.load("house/selector.png", 16, 12);
-    controller.load();
-    TA::sound::playMusic("sound/house.vgm");
+    interfaceSprite.load(context, "house/interface.png");
+    houseSprite.load(context, "house/house.png");
+    houseSeaFoxSprite.load(context, "house/house_seafox.png");
+    clawSprite.load(context, "house/claw.png");
+    seaFoxSprite.load(context, "house/seafox.png");
+    curtainSprite.load(context, "house/curtain.png");
+    selectorSprite.load(context, "house/selector.png", 16, 12);
+    controller.load(context);
     switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
     errorSound.load("sound/damage.ogg", TA_SOUND_CHANNEL_SFX2);
     selectSound.load("sound/select.ogg", TA_SOUND_CHANNEL_SFX2);
@@ -20,7 +19,18 @@ void TA_HouseScreen::init() {
         buttons[pos].setRectangle({0, 0}, {23, 32});
     }
 
-    inventoryMenu.load(&controller);
+    inventoryMenu.load(context, &controller);
+    resume();
+}
+
+void TA_HouseScreen::resume() {
+    TA::sound::playMusic("sound/house.vgm");
+    selection = 3;
+    curtainTimeLeft = -1;
+    inventoryOpen = shouldMove = shouldExit = false;
+    clawX = 40;
+    clawDirection = true;
+    layer.invalidate();
 }
 
 TA_ScreenState TA_HouseScreen::update() {
@@ -52,28 +62,28 @@ TA_ScreenState TA_HouseScreen::update() {
     controller.draw();
 
     if(shouldExit) {
-        TA::save::setSaveParameter("map_selection", 0);
+        TA::save::setSaveParameter(context, "map_selection", 0);
         return (selection == 2 ? TA_SCREENSTATE_MAIN_MENU : TA_SCREENSTATE_MAP);
     }
     return TA_SCREENSTATE_CURRENT;
 }
 
 void TA_HouseScreen::updatePositions() {
-    float leftX = TA::screenWidth / 2 - interfaceSprite.getWidth() / 2;
-    float topY = TA::screenHeight / 2 - interfaceSprite.getHeight() / 2;
+    float leftX = context->screenWidth / 2 - interfaceSprite.getWidth() / 2;
+    float topY = context->screenHeight / 2 - interfaceSprite.getHeight() / 2;
     interfaceSprite.setPosition(leftX, topY);
     houseSprite.setPosition(leftX + 8, topY + 32);
     houseSeaFoxSprite.setPosition(leftX + 8, topY + 32);
     curtainSprite.setPosition(leftX + 8, topY + 32);
 
     if(clawDirection) {
-        clawX += TA::elapsedTime;
+        clawX += context->elapsedTime;
         if(clawX > 106) {
             clawX = 106;
             clawDirection = false;
         }
     } else {
-        clawX -= TA::elapsedTime;
+        clawX -= context->elapsedTime;
         if(clawX < 40) {
             clawX = 40;
             clawDirection = true;
@@ -107,8 +117,8 @@ void TA_HouseScreen::updateSelectorController() {
 }
 
 void TA_HouseScreen::updateSelectorTouch() {
-    float leftX = TA::screenWidth / 2 - interfaceSprite.getWidth() / 2;
-    float topY = TA::screenHeight / 2 - interfaceSprite.getHeight() / 2;
+    float leftX = context->screenWidth / 2 - interfaceSprite.getWidth() / 2;
+    float topY = context->screenHeight / 2 - interfaceSprite.getHeight() / 2;
     for(int pos = 0; pos < 4; pos++) {
         buttons[pos].setPosition({leftX + 31 + 23 * pos, topY});
         buttons[pos].update();
@@ -128,7 +138,7 @@ void TA_HouseScreen::updateCurtain() {
     }
 
     float prev = curtainTimeLeft;
-    curtainTimeLeft -= TA::elapsedTime;
+    curtainTimeLeft -= context->elapsedTime;
 
     if(prev > curtainMoveTime && curtainTimeLeft <= curtainMoveTime) {
         applyTransition();
@@ -166,7 +176,7 @@ bool TA_HouseScreen::shouldDoTransition() {
 }
 
 bool TA_HouseScreen::isSeaFoxAvailable() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     return itemMask & (1ll << 33);
 }
 
@@ -174,59 +184,84 @@ void TA_HouseScreen::applyTransition() {
     if(selection == 0) {
         inventoryOpen = !inventoryOpen;
     } else if(selection == 1) {
-        bool seaFox = TA::save::getSaveParameter("seafox");
+        bool seaFox = TA::save::getSaveParameter(context, "seafox");
         seaFox = !seaFox;
-        TA::save::setSaveParameter("seafox", seaFox);
+        TA::save::setSaveParameter(context, "seafox", seaFox);
     } else {
         shouldExit = true;
     }
 }
 
 void TA_HouseScreen::draw() {
-    TA::drawScreenRect(68, 56, 68, 255);
+    bool seaFox = TA::save::getSaveParameter(context, "seafox");
+    if(inventoryOpen) {
+        inventoryMenu.updateAlpha();
+    }
+
+    // the frame, house and selector only change on input, the inventory is drawn directly while it fades
+    if(inventoryOpen && !inventoryMenu.isSteady()) {
+        drawStatic();
+    } else {
+        long long key = (inventoryOpen ? inventoryMenu.getStaticKey() : 0);
+        for(int pos = 0; pos < 4; pos++) {
+            key = (key << 5) | getSelectorFrame(pos);
+        }
+        key = (key << 2) | (seaFox ? 2 : 0) | (inventoryOpen ? 1 : 0);
+        layer.draw(context, key, [&]() { drawStatic(); });
+    }
+
+    if(inventoryOpen) {
+        inventoryMenu.drawOverlay();
+    } else if(seaFox) {
+        clawSprite.draw();
+        seaFoxSprite.draw();
+    }
+    drawCurtain();
+}
+
+void TA_HouseScreen::drawStatic() {
+    TA::drawScreenRect(context, 68, 56, 68, 255);
     interfaceSprite.draw();
 
     if(inventoryOpen) {
-        inventoryMenu.draw();
+        inventoryMenu.drawStatic();
+    } else if(TA::save::getSaveParameter(context, "seafox")) {
+        houseSeaFoxSprite.draw();
     } else {
-        if(TA::save::getSaveParameter("seafox")) {
-            houseSeaFoxSprite.draw();
-            clawSprite.draw();
-            seaFoxSprite.draw();
-        } else {
-            houseSprite.draw();
-        }
+        houseSprite.draw();
     }
 
     drawSelector();
-    drawCurtain();
 }
 
-void TA_HouseScreen::drawSelector() {
-    float leftX = TA::screenWidth / 2 - interfaceSprite.getWidth() / 2;
-    float topY = TA::screenHeight / 2 - interfaceSprite.getHeight() / 2;
+int TA_HouseScreen::getSelectorFrame(int pos) {
     bool touchscreen = controller.isTouchscreen();
+    int frame = pos;
+    if(pos > 1 || (pos == 1 && TA::save::getSaveParameter(context, "seafox"))) {
+        frame++;
+    }
 
-    for(int pos = 0; pos < 4; pos++) {
-        int frame = pos;
-        if(pos > 1 || (pos == 1 && TA::save::getSaveParameter("seafox"))) {
-            frame++;
-        }
-
-        if(inventoryOpen) {
-            if(pos == 3 && touchscreen) {
-                if(buttons[pos].isPressed()) {
-                    frame += 5;
-                }
-            } else {
-                frame += 10;
+    if(inventoryOpen) {
+        if(pos == 3 && touchscreen) {
+            if(buttons[pos].isPressed()) {
+                frame += 5;
             }
-        } else if((!touchscreen && selection == pos) || (touchscreen && buttons[pos].isPressed())) {
-            frame += 5;
+        } else {
+            frame += 10;
         }
+    } else if((!touchscreen && selection == pos) || (touchscreen && buttons[pos].isPressed())) {
+        frame += 5;
+    }
+    return frame;
+}
+
+void TA_HouseScreen::drawSelector() {
+    float leftX = context->screenWidth / 2 - interfaceSprite.getWidth() / 2;
+    float topY = context->screenHeight / 2 - interfaceSprite.getHeight() / 2;
 
+    for(int pos = 0; pos < 4; pos++) {
         selectorSprite.setPosition(leftX + 37 + pos * 23, topY + 10);
-        selectorSprite.setFrame(frame);
+        selectorSprite.setFrame(getSelectorFrame(pos));
         selectorSprite.draw();
     }
 }
@@ -7,6 +7,7 @@
 #include "screen_state_machine.h"
 #include "sound.h"
 #include "sprite.h"
+#include "ui_layer.h"
 
 class TA_HouseScreen : public TA_Screen {
 private:
@@ -23,6 +24,8 @@ private:
     bool isSeaFoxAvailable();
 
     void draw();
+    void drawStatic();
+    int getSelectorFrame(int pos);
     void drawSelector();
     void drawCurtain();
     void drawCurtain(float factor);
@@ -32,6 +35,7 @@ private:
     std::array<TA_OnscreenButton, 4> buttons;
     TA_Controller controller;
     TA_Sound switchSound, errorSound, selectSound;
+    TA_UILayer layer;
 
     int selection = 3;
     float curtainTimeLeft = -1;
@@ -45,6 +49,8 @@ public:
     void init() override;
     TA_ScreenState update() override;
     void quit() override {}
+    bool isReusable() override { return true; }
+    void resume() override;
 };
 
 #endif // TA_HOUSE_SCREEN_H
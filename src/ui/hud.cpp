@@ -1,28 +1,33 @@
 #include "hud.h"
 #include <cmath>
 #include "character.h"
+#include "error.h"
+#include "level_context.h"
 #include "save.h"
 #include "screen.h"
 
 void TA_Hud::load(TA_Links newLinks) {
+    if(newLinks.level == nullptr) {
+        TA::handleError("%s", "hud links have no level context");
+    }
     links = newLinks;
-    ringMonitor.loadFromToml("hud/items.toml");
+    ringMonitor.loadFromToml(links.context, "hud/items.toml");
     ringMonitor.setAnimation("ring_monitor");
     ringMonitor.setPosition(2, 4);
 
     for(int pos = 0; pos < 2; pos++) {
-        ringDigits[pos].load("hud/numbers.png", 6, 11);
+        ringDigits[pos].load(links.context, "hud/numbers.png", 6, 11);
         ringDigits[pos].setPosition(20 + 6 * pos, 6);
     }
 
-    itemSprite.loadFromToml("hud/items.toml");
+    itemSprite.loadFromToml(links.context, "hud/items.toml");
     itemSprite.setPosition(2, 22);
 
-    leftSprite.loadFromToml("hud/items.toml");
+    leftSprite.loadFromToml(links.context, "hud/items.toml");
     leftSprite.setFrame(40);
-    rightSprite.loadFromToml("hud/items.toml");
+    rightSprite.loadFromToml(links.context, "hud/items.toml");
     rightSprite.setFrame(41);
-    pauseSprite.loadFromToml("hud/items.toml");
+    pauseSprite.loadFromToml(links.context, "hud/items.toml");
 
     leftButton.setRectangle({0, 0}, {24, 24});
     rightButton.setRectangle({0, 0}, {24, 24});
@@ -31,9 +36,9 @@ void TA_Hud::load(TA_Links newLinks) {
     pauseMenu.load(links);
 
     itemPositionKey = (links.seaFox == nullptr ? "item_position" : "seafox_item_position");
-    itemPosition = TA::save::getSaveParameter(itemPositionKey);
-    flightBarSprite.load("hud/flightbar.png");
-    rings = TA::save::getSaveParameter("rings");
+    itemPosition = TA::save::getSaveParameter(links.context, itemPositionKey);
+    flightBarSprite.load(links.context, "hud/flightbar.png");
+    rings = TA::save::getSaveParameter(links.context, "rings");
 
     switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
     itemSwitchSound.load("sound/item_switch.ogg", TA_SOUND_CHANNEL_SFX1);
@@ -46,11 +51,12 @@ void TA_Hud::update() {
         updateRingsCounter();
         updateCurrentItem();
     }
+    updateFlightBar();
 }
 
 void TA_Hud::updatePause() {
     if(!paused) {
-        pauseButton.setPosition(TA_Point(TA::screenWidth - 72, 0));
+        pauseButton.setPosition(TA_Point(links.context->screenWidth - 72, 0));
         pauseButton.update();
         pauseSprite.setFrame((pauseButton.isPressed() ? 43 : 42));
         if(links.controller->isJustPressed(TA_BUTTON_PAUSE) || pauseButton.isReleased()) {
@@ -66,7 +72,7 @@ void TA_Hud::updatePause() {
 }
 
 void TA_Hud::updatePauseMenu() {
-    timer += TA::elapsedTime;
+    timer += links.context->elapsedTime;
 
     if(exitPause) {
         if(timer < fadeTime) {
@@ -93,7 +99,8 @@ void TA_Hud::updatePauseMenu() {
     if(result == TA_PauseMenu::UpdateResult::RESUME) {
         exitPause = true;
         timer = 0;
-        itemPosition = static_cast<int>(TA::save::getSaveParameter(itemPositionKey));
+        itemPosition = static_cast<int>(TA::save::getSaveParameter(links.context, itemPositionKey));
+        links.level->updateItems(links.context);
     }
     if(result == TA_PauseMenu::UpdateResult::QUIT) {
         transition = TA_SCREENSTATE_MAP;
@@ -116,11 +123,11 @@ void TA_Hud::setHudAlpha(int alpha) {
 }
 
 void TA_Hud::updateRingsCounter() {
-    int actualRings = TA::save::getSaveParameter("rings");
+    int actualRings = TA::save::getSaveParameter(links.context, "rings");
     actualRings = std::max(actualRings, 0);
     actualRings = std::min(actualRings, 99);
 
-    timer += TA::elapsedTime;
+    timer += links.context->elapsedTime;
     if(timer > ringAddTime) {
         if(rings < actualRings) {
             rings++;
@@ -132,8 +139,8 @@ void TA_Hud::updateRingsCounter() {
 }
 
 void TA_Hud::updateCurrentItem() {
-    leftButton.setPosition(TA_Point(TA::screenWidth - 52, 0));
-    rightButton.setPosition(TA_Point(TA::screenWidth - 28, 0));
+    leftButton.setPosition(TA_Point(links.context->screenWidth - 52, 0));
+    rightButton.setPosition(TA_Point(links.context->screenWidth - 28, 0));
     leftButton.update();
     rightButton.update();
 
@@ -149,7 +156,7 @@ void TA_Hud::updateCurrentItem() {
         itemSwitchSound.play();
     }
 
-    TA::save::setSaveParameter(itemPositionKey, itemPosition);
+    TA::save::setSaveParameter(links.context, itemPositionKey, itemPosition);
 }
 
 void TA_Hud::draw() {
@@ -165,8 +172,7 @@ void TA_Hud::draw() {
 }
 
 void TA_Hud::drawCurrentItem() {
-    std::string itemKey = (links.seaFox ? "seafox_item_slot" : "item_slot") + std::to_string(itemPosition);
-    item = TA::save::getSaveParameter(itemKey);
+    item = links.level->items[itemPosition];
     if(item == -1) {
         item = 38;
     }
@@ -176,7 +182,7 @@ void TA_Hud::drawCurrentItem() {
     }
 
     if(links.controller->isTouchscreen()) {
-        itemSprite.setPosition(TA::screenWidth - 36, 4);
+        itemSprite.setPosition(links.context->screenWidth - 36, 4);
     } else {
         itemSprite.setPosition(2, 22);
     }
@@ -184,9 +190,9 @@ void TA_Hud::drawCurrentItem() {
 }
 
 void TA_Hud::drawTouchControls() {
-    leftSprite.setPosition(TA::screenWidth - 52, 4);
-    rightSprite.setPosition(TA::screenWidth - 20, 4);
-    pauseSprite.setPosition(TA::screenWidth - 72, 4);
+    leftSprite.setPosition(links.context->screenWidth - 52, 4);
+    rightSprite.setPosition(links.context->screenWidth - 20, 4);
+    pauseSprite.setPosition(links.context->screenWidth - 72, 4);
 
     leftSprite.draw();
     rightSprite.draw();
@@ -204,20 +210,26 @@ void TA_Hud::drawRingsCounter() {
     ringDigits[1].draw();
 }
 
-void TA_Hud::drawFlightBar() {
+void TA_Hud::updateFlightBar() {
     if(!links.character) {
         return;
     }
 
-    float flightTime = links.character->getFlightTime();
-    if(links.character->displayFlightTimeBar() && flightTime < 1) {
-        flightBarX = std::min(flightBarRight, flightBarX + flightBarSpeed * TA::elapsedTime);
+    if(links.character->displayFlightTimeBar() && links.character->getFlightTime() < 1) {
+        flightBarX = std::min(flightBarRight, flightBarX + flightBarSpeed * links.context->elapsedTime);
     } else {
-        flightBarX = std::max(flightBarLeft, flightBarX - flightBarSpeed * TA::elapsedTime);
+        flightBarX = std::max(flightBarLeft, flightBarX - flightBarSpeed * links.context->elapsedTime);
+    }
+}
+
+void TA_Hud::drawFlightBar() {
+    if(!links.character) {
+        return;
     }
 
+    float flightTime = links.character->getFlightTime();
     int offset = 8 + std::min(24, int(24 * flightTime));
-    int topY = (TA::screenHeight - 144) / 2;
+    int topY = (links.context->screenHeight - 144) / 2;
     flightBarSprite.setPosition(flightBarX, topY + flightBarY);
     flightBarSprite.drawFrom({8, 0, 8, offset});
     flightBarSprite.setPosition(flightBarX, topY + flightBarY + offset);
@@ -31,6 +31,7 @@ private:
 
     void updateRingsCounter();
     void updateCurrentItem();
+    void updateFlightBar();
     void updatePause();
     void updatePauseMenu();
     void updatePauseMenuInputController();
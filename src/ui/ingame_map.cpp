@@ -1,21 +1,22 @@
 #include "ingame_map.h"
 #include "tools.h"
 
-void TA_InGameMap::load() {
-    float xOffset = (TA::screenWidth - 256) / 2;
-    float yOffset = (TA::screenHeight - 144) / 2;
+void TA_InGameMap::load(TA_Context* newContext) {
+    context = newContext;
+    float xOffset = (context->screenWidth - 256) / 2;
+    float yOffset = (context->screenHeight - 144) / 2;
 
-    mapSprite.loadFromToml("worldmap/map.toml");
+    mapSprite.loadFromToml(context, "worldmap/map.toml");
     mapSprite.setPosition({xOffset, yOffset});
     mapSprite.setAnimation("map");
 
-    namePlateSprite.load("worldmap/name_plate.png");
-    namePlateSprite.setPosition(16, TA::screenHeight - 24);
+    namePlateSprite.load(context, "worldmap/name_plate.png");
+    namePlateSprite.setPosition(16, context->screenHeight - 24);
 
-    font.loadFont("fonts/area.toml");
+    font.loadFont(context, "fonts/area.toml");
 
     for(int i = 0; i < 2; i++) {
-        dolphinSprites[i].loadFromToml("worldmap/dolphin.toml");
+        dolphinSprites[i].loadFromToml(context, "worldmap/dolphin.toml");
         dolphinSprites[i].setAnimation("dolphin");
     }
 
@@ -23,7 +24,7 @@ void TA_InGameMap::load() {
     dolphinSprites[1].setPosition(xOffset + 172, yOffset + 48);
 
     for(int i = 0; i < 3; i++) {
-        birdSprites[i].loadFromToml("worldmap/bird.toml");
+        birdSprites[i].loadFromToml(context, "worldmap/bird.toml");
         birdSprites[i].setAnimation("bird");
     }
 
@@ -33,8 +34,13 @@ void TA_InGameMap::load() {
 }
 
 void TA_InGameMap::draw() {
-    drawBackground();
-    mapSprite.draw();
+    // the map only changes with its own animation, the dolphins and birds go over it
+    // getCurrentFrame() catches the sprite up first, so the layer is keyed on the frame it's about to compose
+    int frame = mapSprite.getCurrentFrame();
+    layer.draw(context, frame, [&]() {
+        drawBackground();
+        mapSprite.draw();
+    });
     for(int i = 0; i < 2; i++) {
         dolphinSprites[i].draw();
     }
@@ -44,9 +50,9 @@ void TA_InGameMap::draw() {
 }
 
 void TA_InGameMap::drawBackground() {
-    float yOffset = (TA::screenHeight - 144) / 2;
-    TA::drawScreenRect(17, 136, 221, 255);
-    TA::drawRect({0, 0}, {static_cast<float>(TA::screenWidth), yOffset + 9}, 187, 238, 238, 255);
+    float yOffset = (context->screenHeight - 144) / 2;
+    TA::drawScreenRect(context, 17, 136, 221, 255);
+    TA::drawRect(context, {0, 0}, {static_cast<float>(context->screenWidth), yOffset + 9}, 187, 238, 238, 255);
 }
 
 void TA_InGameMap::drawSelectionName(std::string name) {
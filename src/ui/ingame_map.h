@@ -4,6 +4,7 @@
 #include <array>
 #include "font.h"
 #include "sprite.h"
+#include "ui_layer.h"
 
 class TA_InGameMap {
 private:
@@ -12,11 +13,13 @@ private:
     TA_Font font;
     std::array<TA_Sprite, 2> dolphinSprites;
     std::array<TA_Sprite, 3> birdSprites;
+    TA_UILayer layer;
+    TA_Context* context = nullptr;
 
     void drawBackground();
 
 public:
-    void load();
+    void load(TA_Context* newContext);
     void draw();
     void drawSelectionName(std::string name);
 };
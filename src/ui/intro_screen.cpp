@@ -2,16 +2,16 @@
 #include "tools.h"
 
 void TA_IntroScreen::init() {
-    segaLogoSprite.load("intro/sega_logo.png", 80, 25);
-    segaLogoSprite.setPosition(TA::screenWidth / 2 - 40, TA::screenHeight / 2 - 12);
+    segaLogoSprite.load(context, "intro/sega_logo.png", 80, 25);
+    segaLogoSprite.setPosition(context->screenWidth / 2 - 40, context->screenHeight / 2 - 12);
     segaLogoSprite.setAnimation(TA_Animation(0, 16, 3, 1));
-    disclaimerSprite.load("intro/disclaimer.png");
-    disclaimerSprite.setPosition(TA::screenWidth / 2 - 128, 0);
+    disclaimerSprite.load(context, "intro/disclaimer.png");
+    disclaimerSprite.setPosition(context->screenWidth / 2 - 128, 0);
     localTimer = 0;
 }
 
 TA_ScreenState TA_IntroScreen::update() {
-    localTimer += TA::elapsedTime;
+    localTimer += context->elapsedTime;
 
     if(localTimer <= 130) {
         if(localTimer >= 70 && !secondAnimationPlayed) {
@@ -22,18 +22,18 @@ TA_ScreenState TA_IntroScreen::update() {
 
         if(localTimer >= 120) {
             int factor = 255 * (localTimer - 120) / 10;
-            TA::drawShadow(factor);
+            TA::drawShadow(context, factor);
         }
     } else if(localTimer >= 150) {
         disclaimerSprite.draw();
 
         if(localTimer <= 160) {
             int factor = 255 - 255 * (localTimer - 150) / 10;
-            TA::drawShadow(factor);
+            TA::drawShadow(context, factor);
         }
         if(localTimer >= 300) {
             int factor = 255 * (localTimer - 300) / 10;
-            TA::drawShadow(factor);
+            TA::drawShadow(context, factor);
         }
     }
 
@@ -4,16 +4,17 @@
 #include "save.h"
 #include "sound.h"
 
-void TA_InventoryMenu::load(TA_Controller* controller) {
+void TA_InventoryMenu::load(TA_Context* newContext, TA_Controller* controller) {
+    context = newContext;
     this->controller = controller;
 
-    itemSprite.load("hud/items.png", 16, 16);
-    inventoryItemSprite.load("hud/items.png", 16, 16);
-    pointerSprite.load("house/pointer.png");
-    inventoryPointerSprite.load("house/pointer.png");
-    arrowSprite.load("house/arrow.png", 8, 13);
+    itemSprite.load(context, "hud/items.png", 16, 16);
+    inventoryItemSprite.load(context, "hud/items.png", 16, 16);
+    pointerSprite.load(context, "house/pointer.png");
+    inventoryPointerSprite.load(context, "house/pointer.png");
+    arrowSprite.load(context, "house/arrow.png", 8, 13);
 
-    font.loadFont("fonts/item.toml");
+    font.loadFont(context, "fonts/item.toml");
 
     switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
     selectSound.load("sound/select_item.ogg", TA_SOUND_CHANNEL_SFX2);
@@ -36,7 +37,7 @@ void TA_InventoryMenu::loadOnscreenButtons() {
 }
 
 void TA_InventoryMenu::fillItemMatrix() {
-    if(TA::save::getSaveParameter("seafox") == 1) {
+    if(TA::save::getSaveParameter(context, "seafox") == 1) {
         items[0][0] = {.number = 4, .name = getItemString("vulcan_gun")};
         items[0][1] = {.number = 22, .name = getItemString("anti_air_missile")};
         items[1][0] = {.number = 12, .name = getItemString("proton_torpedo")};
@@ -197,7 +198,7 @@ bool TA_InventoryMenu::updateItemSelection() {
                 selectionX = std::max(0, selectionX - 1);
                 break;
             case TA_DIRECTION_RIGHT:
-                selectionX = std::min((TA::save::getSaveParameter("seafox") ? 3 : 11), selectionX + 1);
+                selectionX = std::min((TA::save::getSaveParameter(context, "seafox") ? 3 : 11), selectionX + 1);
                 break;
             default:
                 break;
@@ -280,11 +281,19 @@ void TA_InventoryMenu::placeItem(int slot, int item) {
 
 void TA_InventoryMenu::draw() {
     updateAlpha();
+    drawStatic();
+    drawOverlay();
+}
+
+void TA_InventoryMenu::drawStatic() {
     drawItemList();
     if(!replace) {
         drawInventory();
         drawSelectionName();
     }
+}
+
+void TA_InventoryMenu::drawOverlay() {
     drawPointer();
     drawArrows();
     if(replace) {
@@ -292,12 +301,25 @@ void TA_InventoryMenu::draw() {
     }
 }
 
+bool TA_InventoryMenu::isSteady() {
+    return shown && showTimeLeft <= 0 && hideTimeLeft <= 0 && listTransitionTimeLeft <= 0;
+}
+
+long long TA_InventoryMenu::getStaticKey() {
+    // everything drawStatic depends on while steady, the item mask can't change while the menu is open
+    long long key = (selectionX << 4) | (selectionY << 3) | (selectionSlot << 1) | (selectingSlot ? 1 : 0);
+    for(int slot = 0; slot < 4; slot++) {
+        key = (key << 6) | (getInventoryItem(slot) + 1);
+    }
+    return key;
+}
+
 void TA_InventoryMenu::updateAlpha() {
     if(showTimeLeft > 0) {
-        showTimeLeft -= TA::elapsedTime;
+        showTimeLeft -= context->elapsedTime;
     }
     if(hideTimeLeft > 0) {
-        hideTimeLeft -= TA::elapsedTime;
+        hideTimeLeft -= context->elapsedTime;
     }
 
     int globalAlpha = 0;
@@ -313,7 +335,7 @@ void TA_InventoryMenu::updateAlpha() {
     font.setAlpha(globalAlpha);
     inventoryPointerSprite.setAlpha(globalAlpha);
 
-    arrowTimer += TA::elapsedTime;
+    arrowTimer += context->elapsedTime;
     arrowTimer = fmod(arrowTimer, (arrowIdleTime + arrowTransitionTime) * 2);
     int arrowAlpha = 0;
 
@@ -333,7 +355,7 @@ void TA_InventoryMenu::updateAlpha() {
     int itemAlpha = 255;
 
     if(listTransitionTimeLeft > 0) {
-        listTransitionTimeLeft -= TA::elapsedTime;
+        listTransitionTimeLeft -= context->elapsedTime;
         if(listTransitionTimeLeft > listTransitionTime) {
             itemAlpha = 255 * (listTransitionTimeLeft - listTransitionTime) / listTransitionTime;
         } else {
@@ -389,16 +411,16 @@ void TA_InventoryMenu::drawInventory() {
 
 int TA_InventoryMenu::getInventoryItem(int slot) {
     std::string paramName = getParameterName(slot);
-    return TA::save::getSaveParameter(paramName);
+    return TA::save::getSaveParameter(context, paramName);
 }
 
 void TA_InventoryMenu::setInventoryItem(int slot, int index) {
     std::string paramName = getParameterName(slot);
-    TA::save::setSaveParameter(paramName, index);
+    TA::save::setSaveParameter(context, paramName, index);
 }
 
 std::string TA_InventoryMenu::getParameterName(int slot) {
-    bool seaFox = TA::save::getSaveParameter("seafox");
+    bool seaFox = TA::save::getSaveParameter(context, "seafox");
     return (seaFox ? "seafox_item_slot" : "item_slot") + std::to_string(slot);
 }
 
@@ -423,7 +445,7 @@ void TA_InventoryMenu::drawSelectionName() {
 }
 
 bool TA_InventoryMenu::characterHasItem(int item) {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     return itemMask & (1ll << item);
 }
 
@@ -487,7 +509,7 @@ void TA_InventoryMenu::drawPointerTouchscreen() {
 }
 
 void TA_InventoryMenu::drawArrows() {
-    if(TA::save::getSaveParameter("seafox")) {
+    if(TA::save::getSaveParameter(context, "seafox")) {
         return;
     }
     if(selectionX >= 4) {
@@ -526,8 +548,9 @@ void TA_InventoryMenu::show() {
     shown = true;
     selectionSlot = selectionX = selectionY = 0;
     if(replace) {
-        std::string param = (TA::save::getSaveParameter("seafox") == 1 ? "seafox_item_position" : "item_position");
-        selectionSlot = TA::save::getSaveParameter(param);
+        std::string param =
+            (TA::save::getSaveParameter(context, "seafox") == 1 ? "seafox_item_position" : "item_position");
+        selectionSlot = TA::save::getSaveParameter(context, param);
         selectingSlot = false;
     }
 }
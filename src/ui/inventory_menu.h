@@ -20,7 +20,6 @@ private:
     bool updateSlotSelection();
     bool updateItemSelection();
     void updateOnscreenButtons();
-    void updateAlpha();
 
     void drawItemList();
     void drawInventory();
@@ -34,8 +33,8 @@ private:
     int getInventoryItem(int slot);
     void setInventoryItem(int slot, int value);
     std::string getParameterName(int slot);
-    int getLeftX() { return TA::screenWidth / 2 - 80; }
-    int getTopY() { return (TA::screenHeight - 144) / 2; }
+    int getLeftX() { return context->screenWidth / 2 - 80; }
+    int getTopY() { return (context->screenHeight - 144) / 2; }
     bool characterHasItem(int item);
     bool canPlaceItem(int item);
     void placeItem(int slot, int item);
@@ -49,6 +48,7 @@ private:
     std::map<int, std::string> itemName;
     std::string replaceText;
 
+    TA_Context* context = nullptr;
     TA_Controller* controller;
     TA_Sprite itemSprite, pointerSprite, arrowSprite;
     TA_Sprite inventoryItemSprite, inventoryPointerSprite;
@@ -66,9 +66,15 @@ private:
 
 public:
     TA_InventoryMenu() {}
-    void load(TA_Controller* controller);
+    void load(TA_Context* newContext, TA_Controller* controller);
     bool update();
     void draw();
+    // draw split for callers that cache the parts which only change on input
+    void updateAlpha();
+    void drawStatic();
+    void drawOverlay();
+    bool isSteady();
+    long long getStaticKey();
     void show();
     void hide();
     bool isShown() { return shown || hideTimeLeft > 0; }
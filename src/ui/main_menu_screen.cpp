@@ -4,17 +4,28 @@
 #include "sound.h"
 
 void TA_MainMenuScreen::init() {
-    TA::sound::playMusic("sound/password.vgm");
-    titleSprite.load("data_select/title.png", 112, 9);
-    controller.load();
+    titleSprite.load(context, "data_select/title.png", 112, 9);
+    controller.load(context);
 
-    sections[TA_MAIN_MENU_DATA_SELECT] = std::make_unique<TA_DataSelectSection>(TA_DataSelectSection(&controller));
+    sections[TA_MAIN_MENU_DATA_SELECT] =
+        std::make_unique<TA_DataSelectSection>(TA_DataSelectSection(context, &controller));
     sections[TA_MAIN_MENU_DATA_SELECT]->load();
 
-    sections[TA_MAIN_MENU_OPTIONS] = std::make_unique<TA_OptionsSection>(TA_OptionsSection(&controller));
+    sections[TA_MAIN_MENU_OPTIONS] = std::make_unique<TA_OptionsSection>(TA_OptionsSection(context, &controller));
     sections[TA_MAIN_MENU_OPTIONS]->load();
+    resume();
+}
 
+void TA_MainMenuScreen::resume() {
+    TA::sound::playMusic("sound/password.vgm");
+    for(auto& section : sections) {
+        if(section != nullptr) {
+            section->reset();
+            section->setAlpha(255);
+        }
+    }
     state = neededState = TA_MAIN_MENU_DATA_SELECT;
+    timer = 0;
 }
 
 TA_ScreenState TA_MainMenuScreen::update() {
@@ -29,7 +40,7 @@ TA_ScreenState TA_MainMenuScreen::update() {
             sections[state]->draw();
             return TA_SCREENSTATE_MAP;
         } else {
-            timer += TA::elapsedTime;
+            timer += context->elapsedTime;
             if(timer < transitionTime) {
                 sections[state]->setAlpha(255 - 255 * timer / transitionTime);
                 sections[state]->draw();
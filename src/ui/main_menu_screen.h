@@ -9,6 +9,8 @@ class TA_MainMenuScreen : public TA_Screen {
 public:
     void init() override;
     TA_ScreenState update() override;
+    bool isReusable() override { return true; }
+    void resume() override;
 
 private:
     const float transitionTime = 5;
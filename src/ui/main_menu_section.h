@@ -7,7 +7,10 @@ enum TA_MainMenuState { TA_MAIN_MENU_DATA_SELECT, TA_MAIN_MENU_OPTIONS, TA_MAIN_
 
 class TA_MainMenuSection {
 public:
-    TA_MainMenuSection(TA_Controller* controller) { this->controller = controller; }
+    TA_MainMenuSection(TA_Context* context, TA_Controller* controller) {
+        this->context = context;
+        this->controller = controller;
+    }
     virtual void load() {}
     virtual TA_MainMenuState update() { return TA_MAIN_MENU_EXIT; }
     virtual void setAlpha(int alpha) {}
@@ -16,6 +19,7 @@ public:
     virtual ~TA_MainMenuSection() = default;
 
 protected:
+    TA_Context* context;
     TA_Controller* controller;
 };
 
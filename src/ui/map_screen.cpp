@@ -2,16 +2,21 @@
 #include "save.h"
 
 void TA_MapScreen::init() {
-    if(TA::save::getSaveParameter("rings") <= 0) {
-        TA::save::setSaveParameter("map_position", 0);
-        TA::save::setSaveParameter("seafox", false);
+    map.load(context);
+    selector.load(context);
+    resume();
+}
+
+void TA_MapScreen::resume() {
+    if(TA::save::getSaveParameter(context, "rings") <= 0) {
+        TA::save::setSaveParameter(context, "map_position", 0);
+        TA::save::setSaveParameter(context, "seafox", false);
         setMaxRings();
     }
 
-    map.load();
-    selector.load();
+    selector.reset();
     TA::sound::playMusic("sound/map.vgm");
-    TA::previousLevelPath = "";
+    context->previousLevelPath = "";
 }
 
 TA_ScreenState TA_MapScreen::update() {
@@ -25,12 +30,12 @@ TA_ScreenState TA_MapScreen::update() {
 }
 
 void TA_MapScreen::setMaxRings() {
-    long long itemMask = TA::save::getSaveParameter("item_mask");
+    long long itemMask = TA::save::getSaveParameter(context, "item_mask");
     int rings = 8;
     for(int num = 29; num <= 34; num++) {
         if(itemMask & (1ll << num)) {
             rings += 2;
         }
     }
-    TA::save::setSaveParameter("rings", rings);
+    TA::save::setSaveParameter(context, "rings", rings);
 }
@@ -16,6 +16,8 @@ public:
     void init() override;
     TA_ScreenState update() override;
     void quit() override {}
+    bool isReusable() override { return true; }
+    void resume() override;
 };
 
 #endif // TA_MAP_SCREEN_H
@@ -1,5 +1,6 @@
 #include "options_section.h"
 #include "SDL3/SDL.h"
+#include "pacing.h"
 #include "resource_manager.h"
 #include "save.h"
 
@@ -104,7 +105,7 @@ public:
         int value = TA::save::getParameter("vsync");
         value = (value + 1) % 3;
         TA::save::setParameter("vsync", value);
-        SDL_SetRenderVSync(TA::renderer, (value == 2 ? -1 : value));
+        TA::pacing::setVSync(value);
         return TA_MOVE_SOUND_SWITCH;
     }
 
@@ -207,6 +208,7 @@ public:
             }
             if(TA::keyboard::isScancodeJustPressed(SDL_Scancode(scancode))) {
                 TA::save::setParameter("keyboard_map_" + buttons[button], scancode);
+                TA::keyboard::updateMapping();
                 button++;
                 if(button >= (int)buttons.size()) {
                     locked = false;
@@ -251,6 +253,7 @@ public:
         for(int id = 0; id < SDL_GAMEPAD_BUTTON_COUNT; id++) {
             if(TA::gamepad::isControllerButtonJustPressed(SDL_GamepadButton(id))) {
                 TA::save::setParameter("gamepad_map_" + buttons[button], id);
+                TA::gamepad::updateMapping();
                 button++;
                 if(button >= (int)buttons.size()) {
                     locked = false;
@@ -316,7 +319,7 @@ private:
 };
 
 void TA_OptionsSection::load() {
-    font.loadFont("fonts/pause_menu.toml");
+    font.loadFont(context, "fonts/pause_menu.toml");
 
     groups = std::vector<std::string>(3);
     groups[0] = getOptionString("video");
@@ -570,16 +573,8 @@ void TA_OptionsSection::drawHighlight(float x, float y, float width) {
     SDL_FRect rect = {static_cast<float>(x), static_cast<float>(y), static_cast<float>(width), 15};
 
     for(int num = 0; num < 4; num++) {
-        SDL_SetRenderDrawColor(
-            TA::renderer, num * 28 * alpha / 255, num * 24 * alpha / 255, num * 28 * alpha / 255, 255);
-
-        SDL_FRect targetRect = rect;
-        targetRect.x *= static_cast<float>(TA::scaleFactor);
-        targetRect.y *= static_cast<float>(TA::scaleFactor);
-        targetRect.w *= static_cast<float>(TA::scaleFactor);
-        targetRect.h *= static_cast<float>(TA::scaleFactor);
-
-        SDL_RenderFillRect(TA::renderer, &targetRect);
+        TA::drawRect(context, TA_Point(rect.x, rect.y), TA_Point(rect.x + rect.w, rect.y + rect.h),
+            num * 28 * alpha / 255, num * 24 * alpha / 255, num * 28 * alpha / 255, 255);
         rect.x += 2;
         rect.w -= 4;
     }
@@ -594,7 +589,7 @@ void TA_OptionsSection::updateAlpha() {
 
     if(listTransitionTimeLeft > 0) {
         bool flag1 = (listTransitionTimeLeft > listTransitionTime);
-        listTransitionTimeLeft -= TA::elapsedTime;
+        listTransitionTimeLeft -= context->elapsedTime;
         bool flag2 = (listTransitionTimeLeft > listTransitionTime);
 
         if(flag1 != flag2) {
@@ -32,7 +32,7 @@ private:
     void playMoveSound(TA_MoveSoundId id);
 
     void updateAlpha();
-    int getLeftX() { return TA::screenWidth / 2 - 80; }
+    int getLeftX() { return context->screenWidth / 2 - 80; }
 
     void drawGroupList();
     void drawOptionList();
@@ -12,20 +12,21 @@
 #include "tools.h"
 
 void TA_PauseMenu::load(TA_Links links) {
+    context = links.context;
     switchMenu.load(links);
-    inventoryMenu.load(links.controller);
+    inventoryMenu.load(links.context, links.controller);
     inventoryMenu.setReplace(true);
 
-    frameSprite.load("hud/pause_menu_frame.png");
-    frameSprite.setPosition(static_cast<float>(TA::screenWidth - frameSprite.getWidth()) / 2,
-        static_cast<float>(TA::screenHeight - frameSprite.getHeight()) / 2);
+    frameSprite.load(links.context, "hud/pause_menu_frame.png");
+    frameSprite.setPosition(static_cast<float>(links.context->screenWidth - frameSprite.getWidth()) / 2,
+        static_cast<float>(links.context->screenHeight - frameSprite.getHeight()) / 2);
 
     reset();
 }
 
 TA_PauseMenu::UpdateResult TA_PauseMenu::update() {
     if(replace != replaceWanted) {
-        timer += TA::elapsedTime;
+        timer += context->elapsedTime;
         if(timer > transitionTime) {
             replace = replaceWanted;
             if(replace) {
@@ -49,6 +50,8 @@ TA_PauseMenu::UpdateResult TA_PauseMenu::update() {
         if(!inventoryMenu.isShown()) {
             replaceWanted = false;
             switchMenu.setAlpha(0);
+        } else {
+            inventoryMenu.updateAlpha();
         }
         return UpdateResult::CONTINUE;
     }
@@ -73,19 +76,20 @@ void TA_PauseMenu::reset() {
 }
 
 void TA_PauseMenu::draw() {
-    TA::drawScreenRect(0, 0, 0, globalAlpha / 2);
+    TA::drawScreenRect(context, 0, 0, 0, globalAlpha / 2);
     frameSprite.draw();
     if(replace && replaceWanted) {
-        inventoryMenu.draw();
+        inventoryMenu.drawStatic();
+        inventoryMenu.drawOverlay();
     } else {
         switchMenu.draw();
     }
 }
 
 void TA_PauseMenu::SwitchMenu::load(TA_Links links) {
-    itemSprite.load("hud/items.png", 16, 16);
-    pointerSprite.load("house/pointer.png");
-    font.loadFont("fonts/pause_menu.toml");
+    itemSprite.load(links.context, "hud/items.png", 16, 16);
+    pointerSprite.load(links.context, "house/pointer.png");
+    font.loadFont(links.context, "fonts/pause_menu.toml");
 
     switchSound.load("sound/switch.ogg", TA_SOUND_CHANNEL_SFX1);
     selectSound.load("sound/select_item.ogg", TA_SOUND_CHANNEL_SFX2);
@@ -119,7 +123,7 @@ TA_PauseMenu::UpdateResult TA_PauseMenu::SwitchMenu::update() {
 
 void TA_PauseMenu::SwitchMenu::reset() {
     const std::string itemPositionKey = (links.seaFox == nullptr ? "item_position" : "seafox_item_position");
-    itemPosition = static_cast<int>(TA::save::getSaveParameter(itemPositionKey));
+    itemPosition = static_cast<int>(TA::save::getSaveParameter(links.context, itemPositionKey));
     selection = 0;
 }
 
@@ -144,11 +148,11 @@ void TA_PauseMenu::SwitchMenu::processControllerInput() {
     if(direction == TA_DIRECTION_LEFT && itemPosition >= 1) {
         switchSound.play();
         itemPosition -= 1;
-        TA::save::setSaveParameter(itemPositionKey, itemPosition);
+        TA::save::setSaveParameter(links.context, itemPositionKey, itemPosition);
     } else if(direction == TA_DIRECTION_RIGHT && itemPosition <= 2) {
         switchSound.play();
         itemPosition += 1;
-        TA::save::setSaveParameter(itemPositionKey, itemPosition);
+        TA::save::setSaveParameter(links.context, itemPositionKey, itemPosition);
     } else if(direction == TA_DIRECTION_UP && selection >= 1) {
         switchSound.play();
         selection -= 1;
@@ -159,12 +163,12 @@ void TA_PauseMenu::SwitchMenu::processControllerInput() {
 }
 
 void TA_PauseMenu::SwitchMenu::processTouchInput() {
-    const float startX = (static_cast<float>(TA::screenWidth) / 2) - 64;
-    const float startY = static_cast<float>(TA::screenHeight - 144) / 2;
+    const float startX = (static_cast<float>(links.context->screenWidth) / 2) - 64;
+    const float startY = static_cast<float>(links.context->screenHeight - 144) / 2;
 
     for(int pos = 0; pos < 3; pos++) {
         menuButtons.at(pos).setPosition(
-            {(static_cast<float>(TA::screenWidth) / 2) - 62, startY + static_cast<float>(63 + (17 * pos))});
+            {(static_cast<float>(links.context->screenWidth) / 2) - 62, startY + static_cast<float>(63 + (17 * pos))});
         menuButtons.at(pos).update();
         if(menuButtons.at(pos).isReleased()) {
             selection = pos;
@@ -179,7 +183,7 @@ void TA_PauseMenu::SwitchMenu::processTouchInput() {
         itemButtons.at(pos).update();
         if(itemButtons.at(pos).isJustPressed()) {
             switchSound.play();
-            TA::save::setSaveParameter(itemPositionKey, pos);
+            TA::save::setSaveParameter(links.context, itemPositionKey, pos);
             itemPosition = pos;
         }
     }
@@ -211,12 +215,12 @@ void TA_PauseMenu::SwitchMenu::setAlpha(int alpha) {
 }
 
 void TA_PauseMenu::SwitchMenu::draw() {
-    const float startX = (static_cast<float>(TA::screenWidth) / 2) - 56;
-    const float startY = static_cast<float>(TA::screenHeight - 144) / 2;
+    const float startX = (static_cast<float>(links.context->screenWidth) / 2) - 56;
+    const float startY = static_cast<float>(links.context->screenHeight - 144) / 2;
 
     for(int num = 0; num < 4; num++) {
         const std::string itemKey = (links.seaFox == nullptr ? "item_slot" : "seafox_item_slot") + std::to_string(num);
-        int item = static_cast<int>(TA::save::getSaveParameter(itemKey));
+        int item = static_cast<int>(TA::save::getSaveParameter(links.context, itemKey));
         if(item == -1) {
             item = 38;
         }
@@ -239,19 +243,12 @@ void TA_PauseMenu::SwitchMenu::draw() {
 }
 
 void TA_PauseMenu::SwitchMenu::drawHighlight(float y) const {
-    SDL_FRect rect = {(static_cast<float>(TA::screenWidth) / 2) - 54, static_cast<float>(y), 110, 15};
+    SDL_FRect rect = {(static_cast<float>(links.context->screenWidth) / 2) - 54, static_cast<float>(y), 110, 15};
 
     for(int num = 0; num < 4; num++) {
         const int squareAlpha = globalAlpha * globalAlpha / 255;
-        SDL_SetRenderDrawColor(TA::renderer, num * 28, num * 24, num * 28, squareAlpha);
-
-        SDL_FRect targetRect = rect;
-        targetRect.x *= static_cast<float>(TA::scaleFactor);
-        targetRect.y *= static_cast<float>(TA::scaleFactor);
-        targetRect.w *= static_cast<float>(TA::scaleFactor);
-        targetRect.h *= static_cast<float>(TA::scaleFactor);
-
-        SDL_RenderFillRect(TA::renderer, &targetRect);
+        TA::drawRect(links.context, TA_Point(rect.x, rect.y), TA_Point(rect.x + rect.w, rect.y + rect.h), num * 28,
+            num * 24, num * 28, squareAlpha);
         rect.x += 2;
         rect.w -= 4;
     }
@@ -54,6 +54,7 @@ private:
     TA_Sprite frameSprite;
     SwitchMenu switchMenu;
     TA_InventoryMenu inventoryMenu;
+    TA_Context* context = nullptr;
     int globalAlpha = 0;
 
     bool replace = false;
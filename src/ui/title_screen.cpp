@@ -6,28 +6,28 @@
 #include "tools.h"
 
 void TA_TitleScreen::init() {
-    backgroundSprite.load("title_screen/title_screen.png");
+    backgroundSprite.load(context, "title_screen/title_screen.png");
 
 #ifdef __ANDROID__
-    pressStartSprite.load("title_screen/touch_to_start.png");
+    pressStartSprite.load(context, "title_screen/touch_to_start.png");
 #else
-    pressStartSprite.load("title_screen/press_start.png");
+    pressStartSprite.load(context, "title_screen/press_start.png");
 #endif
 
     TA::sound::playMusic("sound/title.vgm");
     enterSound.load("sound/enter.ogg", TA_SOUND_CHANNEL_SFX1, 0);
 
-    controller.load();
-    button.setRectangle(TA_Point(0, 0), TA_Point(TA::screenWidth, TA::screenHeight));
+    controller.load(context);
+    button.setRectangle(TA_Point(0, 0), TA_Point(context->screenWidth, context->screenHeight));
 }
 
 TA_ScreenState TA_TitleScreen::update() {
-    backgroundSprite.setPosition(
-        (TA::screenWidth - backgroundSprite.getWidth()) / 2, (TA::screenHeight - backgroundSprite.getHeight()) / 2);
-    pressStartSprite.setPosition(TA::screenWidth / 2 - pressStartSprite.getWidth() / 2,
-        104 + (TA::screenHeight - backgroundSprite.getHeight()) / 2);
+    backgroundSprite.setPosition((context->screenWidth - backgroundSprite.getWidth()) / 2,
+        (context->screenHeight - backgroundSprite.getHeight()) / 2);
+    pressStartSprite.setPosition(context->screenWidth / 2 - pressStartSprite.getWidth() / 2,
+        104 + (context->screenHeight - backgroundSprite.getHeight()) / 2);
 
-    TA::drawScreenRect(0, 0, 102, 255);
+    TA::drawScreenRect(context, 0, 0, 102, 255);
     backgroundSprite.draw();
     controller.update();
     button.update();
@@ -56,7 +56,7 @@ void TA_TitleScreen::updatePressStart() {
     const float idleTime = 30;
     const float transitionTime = 5;
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     timer = std::fmod(timer, (idleTime + transitionTime) * 2);
 
     if(timer < transitionTime) {
@@ -80,7 +80,7 @@ void TA_TitleScreen::updatePressStart() {
 
 void TA_TitleScreen::updateHidePressStart() {
     const float disappearTime = 5;
-    alpha += 255 * (disappearTime / TA::elapsedTime);
+    alpha += 255 * (disappearTime / context->elapsedTime);
 
     pressStartSprite.setAlpha(alpha);
     pressStartSprite.draw();
@@ -96,7 +96,7 @@ void TA_TitleScreen::updateExit() {
     const float exitTime = 14;
     pressStartSprite.draw();
 
-    timer += TA::elapsedTime;
+    timer += context->elapsedTime;
     if(timer > exitTime) {
         shouldExit = true;
     }
@@ -0,0 +1,138 @@
+#include "alloc_counter.h"
+#include <cstdlib>
+#include <new>
+
+namespace TA::allocCounter {
+    thread_local long long count = 0;
+
+    void* allocate(std::size_t size, std::size_t alignment) {
+        count++;
+        size = (size == 0 ? 1 : size);
+        while(true) {
+            void* pointer = nullptr;
+            if(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                pointer = std::malloc(size);
+            } else {
+#ifdef _WIN32
+                pointer = _aligned_malloc(size, alignment);
+#else
+                // aligned_alloc wants the size to be a multiple of the alignment
+                pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+            }
+            if(pointer != nullptr) {
+                return pointer;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if(handler == nullptr) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void* allocateNothrow(std::size_t size, std::size_t alignment) noexcept {
+        try {
+            return allocate(size, alignment);
+        } catch(std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    void release(void* pointer, std::size_t alignment) noexcept {
+#ifdef _WIN32
+        if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            _aligned_free(pointer);
+            return;
+        }
+#endif
+        static_cast<void>(alignment);
+        std::free(pointer);
+    }
+}
+
+long long TA::allocCounter::get() {
+    return count;
+}
+
+// every form of global new and delete is replaced, so none of them pairs a counted allocation with a foreign free
+
+void* operator new(std::size_t size) {
+    return TA::allocCounter::allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size) {
+    return TA::allocCounter::allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return TA::allocCounter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return TA::allocCounter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return TA::allocCounter::allocateNothrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return TA::allocCounter::allocateNothrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    return TA::allocCounter::allocateNothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    return TA::allocCounter::allocateNothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+    TA::allocCounter::release(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    TA::allocCounter::release(pointer, static_cast<std::size_t>(alignment));
+}
@@ -0,0 +1,10 @@
+#ifndef TA_ALLOC_COUNTER_H
+#define TA_ALLOC_COUNTER_H
+
+// the benchmark tool replaces global operator new and delete to count the allocations of each thread, so a benchmark
+// can check that a loop doesn't allocate; the game itself keeps the standard ones
+namespace TA::allocCounter {
+    long long get();
+}
+
+#endif // TA_ALLOC_COUNTER_H
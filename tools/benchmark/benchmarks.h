@@ -0,0 +1,19 @@
+#ifndef TA_BENCHMARKS_H
+#define TA_BENCHMARKS_H
+
+namespace TA::benchmark {
+    void hitboxContainer();
+    void contactPairs();
+    void slopeCollision();
+    // these need the video subsystem
+    void present(const char* driver);
+    void cpuRenderer();
+    void paletteSwap();
+    void parallelMovement();
+    // these also need audio, the objects they load have sounds
+    void objectUpdate();
+    void objectDeterminism();
+    void levelFrames();
+}
+
+#endif // TA_BENCHMARKS_H
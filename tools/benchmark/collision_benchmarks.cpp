@@ -0,0 +1,179 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <tmxpp.hpp>
+#include <vector>
+#include "benchmarks.h"
+#include "contact_sweep.h"
+#include "harness.h"
+#include "hitbox_container.h"
+#include "reference_polygon.h"
+#include "resource_manager.h"
+
+void TA::benchmark::hitboxContainer() {
+    const int hitboxCount = 4000, queryCount = 200000;
+    std::mt19937 gen(1);
+    std::vector<TA_Rect> queries(queryCount);
+    auto container = std::make_unique<TA_HitboxContainer>();
+    for(int pos = 0; pos < hitboxCount; pos++) {
+        container->add(getRandomRect(gen, 4096, 2048, 8, 64), 1 << (gen() % 19));
+    }
+    for(TA_Rect& query : queries) {
+        query = getRandomRect(gen, 4096, 2048, 8, 32);
+    }
+
+    auto comparison = compare([&](bool simd) { container->setSimdEnabled(simd); }, [&]() {
+        long long result = 0;
+        for(const TA_Rect& query : queries) {
+            result += container->getCollisionFlags(query);
+        }
+        return result;
+    });
+    report(describe("hitbox container, %i boxes, %i queries", hitboxCount, queryCount), "scalar",
+        TA_HitboxContainer::getQueryKernelName(true), comparison);
+}
+
+void TA::benchmark::contactPairs() {
+    const int objectCount = 8000, frameCount = 100;
+    std::mt19937 gen(3);
+    std::vector<TA_Rect> hitboxes(objectCount);
+    std::vector<int> types(objectCount);
+    // whole pixels, like most hitboxes in the game, so plenty of boxes only touch at an edge
+    auto round = [](TA_Point point) { return TA_Point(std::floor(point.x), std::floor(point.y)); };
+    for(int pos = 0; pos < objectCount; pos++) {
+        TA_Rect rect = getRandomRect(gen, 4096, 2048, 8, 32);
+        hitboxes[pos] = TA_Rect(round(rect.getTopLeft()), round(rect.getBottomRight()));
+        types[pos] = 1 << (gen() % 19);
+    }
+
+    // every object asking the container about its own hitbox, which also reports the object itself
+    auto container = std::make_unique<TA_HitboxContainer>();
+    auto poll = [&]() {
+        std::vector<int> flags(objectCount);
+        for(int frame = 0; frame < frameCount; frame++) {
+            container->clear();
+            for(int pos = 0; pos < objectCount; pos++) {
+                container->add(hitboxes[pos], types[pos]);
+            }
+            for(int pos = 0; pos < objectCount; pos++) {
+                flags[pos] = container->getCollisionFlags(hitboxes[pos]);
+            }
+        }
+        return flags;
+    };
+
+    TA_ContactSweep sweep;
+    auto sweepPairs = [&]() {
+        std::vector<int> flags(objectCount);
+        for(int frame = 0; frame < frameCount; frame++) {
+            sweep.clear();
+            for(int pos = 0; pos < objectCount; pos++) {
+                sweep.add(hitboxes[pos], types[pos], pos);
+                flags[pos] = types[pos];
+            }
+            sweep.forEachPair([&](const TA_ContactSweep::Entry& first, const TA_ContactSweep::Entry& second) {
+                if(TA_ContactSweep::hits(first, second)) {
+                    flags[first.owner] |= second.type;
+                }
+                if(TA_ContactSweep::hits(second, first)) {
+                    flags[second.owner] |= first.type;
+                }
+            });
+        }
+        return flags;
+    };
+
+    bool useSweep = false;
+    auto comparison = compare(
+        [&](bool enabled) { useSweep = enabled; }, [&]() { return (useSweep ? sweepPairs() : poll()); });
+    report(describe("contact pairs, %i objects, %i frames", objectCount, frameCount), "polling", "sort and sweep",
+        comparison);
+}
+
+void TA::benchmark::slopeCollision() {
+    const int queryCount = 200000;
+    struct Slope {
+        reference::Polygon reference;
+        std::vector<TA_ConvexPolygon> parts;
+    };
+
+    // every tile hitbox of the maps that isn't a plain rectangle, loaded the way TA_Tilemap loads them
+    std::vector<Slope> slopes;
+    for(const char* filename : maps) {
+        tmx::Map map;
+        map.parseFromData(TA::resmgr::loadAsset(filename));
+        for(const tmx::Tile& tile : map.tilesets()[0].tiles()) {
+            if(tile.objectGroup().objects().empty()) {
+                continue;
+            }
+            const tmx::Object& object = tile.objectGroup().objects()[0];
+            if(object.type() != tmx::Object::Type::POLYGON) {
+                continue;
+            }
+            TA_Point start{object.position().x, object.position().y};
+            std::vector<TA_Point> vertices;
+            for(size_t pos = 0; pos < object.polygon().size(); pos++) {
+                vertices.push_back(start + TA_Point(object.polygon()[pos].x, object.polygon()[pos].y));
+            }
+
+            Slope slope;
+            for(const TA_Point& vertex : vertices) {
+                slope.reference.addVertex(vertex);
+            }
+            if(!slope.reference.isRectangle()) {
+                slope.parts = TA_ConvexPolygon::split(vertices);
+                slopes.push_back(slope);
+            }
+        }
+    }
+    if(slopes.empty()) {
+        fail("%s", "no slope tiles in the benchmark maps");
+        return;
+    }
+
+    // slope vertices sit on multiples of 8, query corners a fixed fraction off the pixel grid never touch an edge
+    // exactly, so the two tests can't disagree through rounding alone
+    struct Query {
+        int slope;
+        TA_Point tilePosition;
+        TA_Rect rect;
+    };
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<int> slope(0, static_cast<int>(slopes.size()) - 1), tile(0, 255), offset(-16, 16),
+        size(4, 24);
+    std::vector<Query> queries(queryCount);
+    for(Query& query : queries) {
+        query.slope = slope(gen);
+        query.tilePosition.x = static_cast<float>(tile(gen) * 16);
+        query.tilePosition.y = static_cast<float>(tile(gen) * 16);
+        TA_Point topLeft = query.tilePosition + TA_Point(0.3F, 0.6F);
+        topLeft.x += static_cast<float>(offset(gen));
+        topLeft.y += static_cast<float>(offset(gen));
+        TA_Point bottomRight = topLeft;
+        bottomRight.x += static_cast<float>(size(gen));
+        bottomRight.y += static_cast<float>(size(gen));
+        query.rect = TA_Rect(topLeft, bottomRight);
+    }
+
+    bool convex = false;
+    auto comparison = compare([&](bool enabled) { convex = enabled; }, [&]() {
+        std::vector<char> hits(queryCount);
+        for(int pos = 0; pos < queryCount; pos++) {
+            const Query& query = queries[pos];
+            Slope& current = slopes[query.slope];
+            if(convex) {
+                bool hit = false;
+                for(const TA_ConvexPolygon& part : current.parts) {
+                    hit = hit || part.intersects(query.rect, query.tilePosition);
+                }
+                hits[pos] = static_cast<char>(hit);
+            } else {
+                current.reference.setPosition(query.tilePosition);
+                hits[pos] = static_cast<char>(current.reference.intersects(query.rect));
+            }
+        }
+        return hits;
+    });
+    report(describe("slope collision, %i slope tiles, %i queries", static_cast<int>(slopes.size()), queryCount),
+        "old polygon", "convex polygon", comparison);
+}
@@ -0,0 +1,58 @@
+#include "harness.h"
+#include <cstring>
+#include "resource_manager.h"
+#include "tools.h"
+
+namespace {
+    bool failed = false;
+}
+
+void TA::benchmark::setFailed() {
+    failed = true;
+}
+
+bool TA::benchmark::hasFailed() {
+    return failed;
+}
+
+bool TA::benchmark::openWindow(int width, int height, const char* driver) {
+    TA::window = SDL_CreateWindow("benchmark", width, height, SDL_WINDOW_HIDDEN);
+    TA::renderer = (TA::window == nullptr ? nullptr : SDL_CreateRenderer(TA::window, driver));
+    if(TA::renderer == nullptr) {
+        SDL_DestroyWindow(TA::window);
+        TA::window = nullptr;
+        return false;
+    }
+    SDL_SetRenderDrawBlendMode(TA::renderer, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void TA::benchmark::closeWindow() {
+    TA::resmgr::quit();
+    SDL_DestroyRenderer(TA::renderer);
+    SDL_DestroyWindow(TA::window);
+    TA::renderer = nullptr;
+    TA::window = nullptr;
+}
+
+TA_Rect TA::benchmark::getRandomRect(std::mt19937& gen, float areaWidth, float areaHeight, float minSize,
+    float maxSize) {
+    std::uniform_real_distribution<float> x(0, areaWidth), y(0, areaHeight), size(minSize, maxSize);
+    TA_Point topLeft(x(gen), y(gen));
+    return {topLeft, topLeft + TA_Point(size(gen), size(gen))};
+}
+
+std::vector<Uint8> TA::benchmark::readPixels(SDL_Renderer* renderer) {
+    SDL_Surface* surface = SDL_RenderReadPixels(renderer, nullptr);
+    if(surface == nullptr) {
+        return {};
+    }
+    size_t rowSize = static_cast<size_t>(surface->w) * SDL_BYTESPERPIXEL(surface->format);
+    std::vector<Uint8> pixels(rowSize * surface->h);
+    for(int row = 0; row < surface->h; row++) {
+        std::memcpy(pixels.data() + (rowSize * row),
+            static_cast<const Uint8*>(surface->pixels) + (static_cast<ptrdiff_t>(row) * surface->pitch), rowSize);
+    }
+    SDL_DestroySurface(surface);
+    return pixels;
+}
@@ -0,0 +1,86 @@
+#ifndef TA_BENCHMARK_HARNESS_H
+#define TA_BENCHMARK_HARNESS_H
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "SDL3/SDL.h"
+#include "error.h"
+#include "geometry.h"
+
+// every benchmark runs the same work through the game's own code twice, with one of its switches off and then on,
+// times both runs and checks that they give the same result
+// a check that fails marks the whole run as failed, the tool then exits with 1 once everything has run
+namespace TA::benchmark {
+    inline const std::array<const char*, 4> maps{
+        "maps/pm/pm1.tmx", "maps/pm/pm3.tmx", "maps/vt/vt1.tmx", "maps/vt/vt2.tmx"};
+
+    void setFailed();
+    bool hasFailed();
+
+    template <typename... T>
+    void fail(const char* format, T... args) {
+        printWarning(format, args...);
+        setFailed();
+    }
+
+    template <typename Result>
+    struct Comparison {
+        double offTime = 0, onTime = 0;
+        Result off{}, on{};
+    };
+
+    template <typename Function>
+    double measure(Function function) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        function();
+        auto endTime = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    }
+
+    template <typename Switch, typename Function>
+    auto compare(Switch setSwitch, Function function) {
+        Comparison<decltype(function())> comparison;
+        setSwitch(false);
+        comparison.offTime = measure([&]() { comparison.off = function(); });
+        setSwitch(true);
+        comparison.onTime = measure([&]() { comparison.on = function(); });
+        return comparison;
+    }
+
+    template <typename Result>
+    void report(const std::string& name, const char* offName, const char* onName,
+        const Comparison<Result>& comparison, bool same) {
+        printLog("%s: %s %.2f ms, %s %.2f ms", name.c_str(), offName, comparison.offTime, onName, comparison.onTime);
+        if(!same) {
+            fail("%s: %s results differ from %s", name.c_str(), onName, offName);
+        }
+    }
+
+    template <typename Result>
+    void report(const std::string& name, const char* offName, const char* onName,
+        const Comparison<Result>& comparison) {
+        report(name, offName, onName, comparison, comparison.off == comparison.on);
+    }
+
+    template <typename... T>
+    std::string describe(const char* format, T... args) {
+        std::array<char, 256> buffer{};
+        std::snprintf(buffer.data(), buffer.size(), format, args...);
+        return buffer.data();
+    }
+
+    // a hidden window in TA::window and TA::renderer, which the game's textures are loaded through
+    bool openWindow(int width, int height, const char* driver);
+    // also drops the textures loaded for the window
+    void closeWindow();
+
+    TA_Rect getRandomRect(std::mt19937& gen, float areaWidth, float areaHeight, float minSize, float maxSize);
+    // the current render target's pixels row by row, empty if they can't be read
+    std::vector<Uint8> readPixels(SDL_Renderer* renderer);
+}
+
+#endif // TA_BENCHMARK_HARNESS_H
@@ -0,0 +1,60 @@
+#include "level_fixture.h"
+#include "save.h"
+#include "tools.h"
+
+TA::benchmark::Level::Level(const std::string& levelPath) {
+    saveMap = TA::save::getConfig();
+    context.saveMap = &saveMap;
+    context.screenWidth = 256;
+    context.screenHeight = 144;
+    context.elapsedTime = 1;
+    context.levelPath = levelPath;
+    TA::random::init(&context, 1);
+    TA::save::createSave(&context, "save_benchmark");
+    TA::save::setCurrentSave(&context, "save_benchmark");
+
+    links.context = &context;
+    links.character = &character;
+    links.level = &levelContext;
+    links.tilemap = &tilemap;
+    links.camera = &camera;
+    links.objectSet = &objectSet;
+    links.hud = &hud;
+    links.controller = &controller;
+
+    levelContext.load(&context, levelPath, false);
+    camera.setContext(&context);
+    camera.setFlightLevel(levelContext.flightLevel);
+    controller.load(&context);
+    controller.setMode(TA_ONSCREEN_CONTROLLER_GAME);
+    character.load(links);
+
+    objectSet.setLinks(links);
+    tilemap.load(&context, levelPath + ".tmx");
+    tilemap.setCamera(&camera);
+    hud.load(links);
+    objectSet.load(levelPath + ".toml");
+    character.setSpawnPoint(objectSet.getCharacterSpawnPoint(), objectSet.getCharacterSpawnFlip());
+}
+
+void TA::benchmark::Level::update() {
+    context.animationClock += context.elapsedTime;
+    character.handleInput();
+    objectSet.update();
+    character.update();
+    camera.update(character.isOnGround(), character.isFastCamera());
+}
+
+void TA::benchmark::Level::draw() {
+    tilemap.draw(0);
+    objectSet.draw(0);
+    if(!objectSet.isNight()) {
+        character.draw();
+    }
+    objectSet.draw(1);
+    tilemap.draw(1);
+    if(objectSet.isNight()) {
+        character.draw();
+    }
+    objectSet.draw(2);
+}
@@ -0,0 +1,42 @@
+#ifndef TA_BENCHMARK_LEVEL_FIXTURE_H
+#define TA_BENCHMARK_LEVEL_FIXTURE_H
+
+#include <string>
+#include "camera.h"
+#include "character.h"
+#include "context.h"
+#include "controller.h"
+#include "hud.h"
+#include "level_context.h"
+#include "links.h"
+#include "object_set.h"
+#include "tilemap.h"
+
+namespace TA::benchmark {
+    // a ground level set up the way TA_GameScreen::init does it, on a copy of the config and a fixed random seed
+    // nothing presses any buttons, so the character stands at the spawn point while the level runs around it
+    // sprites and sounds need openWindow and the audio main opens for benchmarks that ask for it
+    class Level {
+    public:
+        TA_SaveMap saveMap;
+        TA_Context context;
+        TA_Tilemap tilemap;
+        TA_Camera camera;
+        TA_Character character;
+        TA_Controller controller;
+        TA_ObjectSet objectSet;
+        TA_Links links;
+        TA_Hud hud;
+        TA_LevelContext levelContext;
+
+        explicit Level(const std::string& levelPath);
+        Level(const Level&) = delete;
+        Level& operator=(const Level&) = delete;
+
+        // one step of TA_GameScreen::update and the matching TA_GameScreen::draw, without the hud
+        void update();
+        void draw();
+    };
+}
+
+#endif // TA_BENCHMARK_LEVEL_FIXTURE_H
@@ -0,0 +1,96 @@
+#include <array>
+#include <string>
+#include "SDL3_mixer/SDL_mixer.h"
+#include "benchmarks.h"
+#include "error.h"
+#include "harness.h"
+#include "save.h"
+#include "sound.h"
+#include "tools.h"
+
+namespace {
+    struct Benchmark {
+        const char* name;
+        bool video, audio;
+        void (*run)();
+    };
+
+    const std::array<Benchmark, 11> benchmarks{{
+        {"hitbox_container", false, false, TA::benchmark::hitboxContainer},
+        {"contact_pairs", false, false, TA::benchmark::contactPairs},
+        {"slope_collision", false, false, TA::benchmark::slopeCollision},
+        {"present_software", true, false, []() { TA::benchmark::present("software"); }},
+        {"present", true, false, []() { TA::benchmark::present(nullptr); }},
+        {"cpu_renderer", true, false, TA::benchmark::cpuRenderer},
+        {"palette_swap", true, false, TA::benchmark::paletteSwap},
+        {"parallel_movement", true, false, TA::benchmark::parallelMovement},
+        {"object_update", true, true, TA::benchmark::objectUpdate},
+        {"object_determinism", true, true, TA::benchmark::objectDeterminism},
+        {"level_frames", true, true, TA::benchmark::levelFrames},
+    }};
+
+    // the same setup as the game's, on the dummy driver so nothing is heard
+    bool openAudio() {
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        if(!SDL_InitSubSystem(SDL_INIT_AUDIO)) {
+            return false;
+        }
+        Mix_Init(MIX_INIT_OGG);
+        SDL_AudioSpec audioSpec;
+        audioSpec.channels = 2;
+        audioSpec.format = MIX_DEFAULT_FORMAT;
+        audioSpec.freq = 44100;
+        if(!Mix_OpenAudio(0, &audioSpec)) {
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            return false;
+        }
+        TA::sound::init();
+        return true;
+    }
+
+    void closeAudio() {
+        Mix_CloseAudio();
+        Mix_Quit();
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+}
+
+// benchmarks named in the arguments run alone, with no arguments every benchmark runs
+// exits with 1 if a check failed or a benchmark couldn't run
+int main(int argc, char* argv[]) {
+    for(int pos = 1; pos < argc; pos++) {
+        TA::arguments.insert(argv[pos]);
+    }
+    auto selected = [&](const Benchmark& benchmark) {
+        return TA::arguments.empty() || TA::arguments.contains(benchmark.name);
+    };
+
+    TA::save::load();
+    bool video = false, audio = false;
+    for(const Benchmark& benchmark : benchmarks) {
+        video = video || (selected(benchmark) && benchmark.video);
+        audio = audio || (selected(benchmark) && benchmark.audio);
+    }
+    if(video && !SDL_InitSubSystem(SDL_INIT_VIDEO)) {
+        TA::benchmark::fail("skipping benchmarks that draw, video init failed: %s", SDL_GetError());
+        video = false;
+    }
+    if(audio && !openAudio()) {
+        TA::benchmark::fail("skipping benchmarks with sounds, audio init failed: %s", SDL_GetError());
+        audio = false;
+    }
+
+    for(const Benchmark& benchmark : benchmarks) {
+        if(selected(benchmark) && (video || !benchmark.video) && (audio || !benchmark.audio)) {
+            benchmark.run();
+        }
+    }
+
+    if(audio) {
+        closeAudio();
+    }
+    if(video) {
+        SDL_QuitSubSystem(SDL_INIT_VIDEO);
+    }
+    return (TA::benchmark::hasFailed() ? 1 : 0);
+}
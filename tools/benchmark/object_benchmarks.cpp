@@ -0,0 +1,220 @@
+#include <cstring>
+#include <random>
+#include <vector>
+#include "alloc_counter.h"
+#include "benchmarks.h"
+#include "harness.h"
+#include "level_context.h"
+#include "level_fixture.h"
+#include "object_set.h"
+#include "objects/ring.h"
+#include "objects/walker.h"
+#include "save.h"
+#include "thread_pool.h"
+#include "tilemap.h"
+
+namespace {
+    // flying rings and walkers scattered over the level, the rings bounce through prepareUpdate
+    // the walkers away from the camera sleep, so the per frame walks see both kinds
+    void spawnCrowd(TA::benchmark::Level& level, int ringCount, int walkerCount) {
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<float> x(0, static_cast<float>(level.tilemap.getWidth() - 16)),
+            y(0, static_cast<float>(level.tilemap.getHeight() - 32)), speed(-2, 2);
+        std::uniform_int_distribution<int> range(0, 96), flip(0, 1);
+        for(int pos = 0; pos < ringCount; pos++) {
+            level.objectSet.spawnObject<TA_Ring>(TA_Point(x(gen), y(gen)), TA_Point(speed(gen), speed(gen)));
+        }
+        for(int pos = 0; pos < walkerCount; pos++) {
+            level.objectSet.spawnObject<TA_Walker>(TA_Point(x(gen), y(gen)), range(gen), flip(gen) == 1);
+        }
+    }
+}
+
+void TA::benchmark::parallelMovement() {
+    const int bodyCount = 4000, frames = 300;
+    const char* filename = maps[0];
+    TA_Context context;
+    context.elapsedTime = 1;
+
+    // the map's sprites need a renderer to load, the rest of the test doesn't draw
+    if(!openWindow(256, 144, "software")) {
+        printWarning("skipping parallel movement benchmark: %s", SDL_GetError());
+        return;
+    }
+
+    {
+        TA_Tilemap tilemap;
+        tilemap.load(&context, filename);
+        TA_LevelContext level;
+        TA_ObjectSet objectSet;
+        TA_Links links;
+        links.context = &context;
+        links.level = &level;
+        links.tilemap = &tilemap;
+        links.objectSet = &objectSet;
+        objectSet.setLinks(links);
+
+        std::mt19937 gen(4);
+        std::uniform_real_distribution<float> x(0, static_cast<float>(tilemap.getWidth() - 8)),
+            y(0, static_cast<float>(tilemap.getHeight() - 8)), speed(-3, 3);
+        std::vector<TA_Point> startPositions(bodyCount), startVelocities(bodyCount);
+        for(int pos = 0; pos < bodyCount; pos++) {
+            startPositions[pos] = {x(gen), y(gen)};
+            startVelocities[pos] = {speed(gen), speed(gen)};
+        }
+
+        // the same bouncing movement rings use, run through moveAndCollide from the pool
+        auto simulate = [&]() {
+            std::vector<TA_Point> positions = startPositions, velocities = startVelocities;
+            for(int frame = 0; frame < frames; frame++) {
+                TA::threadPool::parallelFor(bodyCount, 32, [&](int begin, int end) {
+                    for(int pos = begin; pos < end; pos++) {
+                        velocities[pos].y += 0.125F;
+                        auto [delta, flags] = objectSet.moveAndCollide(positions[pos], {0, 0}, {8, 8},
+                            velocities[pos], TA_COLLISION_SOLID | TA_COLLISION_SOLID_UP);
+                        positions[pos] += delta;
+                        if((flags & TA_GROUND_COLLISION) != 0 && velocities[pos].y > 0) {
+                            velocities[pos].y *= -0.75F;
+                        }
+                        if((flags & TA_WALL_COLLISION) != 0) {
+                            velocities[pos].x *= -1;
+                        }
+                    }
+                });
+            }
+            return positions;
+        };
+
+        int threadCount = std::max(1, SDL_GetNumLogicalCPUCores() - 1);
+        auto setThreads = [&](bool enabled) {
+            if(enabled) {
+                TA::threadPool::init(threadCount);
+            } else {
+                TA::threadPool::quit();
+            }
+        };
+        auto comparison = compare(setThreads, simulate);
+        TA::threadPool::quit();
+
+        bool same = std::memcmp(comparison.off.data(), comparison.on.data(), sizeof(TA_Point) * bodyCount) == 0;
+        report(describe("parallel movement, %s, %i bodies, %i frames", filename, bodyCount, frames), "serial",
+            describe("%i threads", threadCount + 1).c_str(), comparison, same);
+    }
+
+    closeWindow();
+}
+
+void TA::benchmark::objectUpdate() {
+    // rings leave after 300 frames, the run ends before that
+    const int ringCount = 3000, walkerCount = 3000, frames = 240;
+    const std::string levelPath = "maps/pf/pf1";
+    if(!openWindow(256, 144, "software")) {
+        printWarning("skipping object update benchmark: %s", SDL_GetError());
+        return;
+    }
+
+    // only the level's steps are timed, loading it is left out
+    Comparison<std::vector<TA_ObjectState>> comparison;
+    auto run = [&](bool hotStore, double& time) {
+        Level level(levelPath);
+        level.objectSet.setHotStoreEnabled(hotStore);
+        spawnCrowd(level, ringCount, walkerCount);
+        for(int frame = 0; frame < frames; frame++) {
+            time += measure([&]() { level.update(); });
+        }
+        return level.objectSet.getObjectStates();
+    };
+    comparison.off = run(false, comparison.offTime);
+    comparison.on = run(true, comparison.onTime);
+    std::string name = describe("object update, %s, %i rings and %i walkers, %i frames", levelPath.c_str(),
+        ringCount, walkerCount, frames);
+    report(name, "pointer walk", "hot store", comparison);
+
+    closeWindow();
+}
+
+void TA::benchmark::objectDeterminism() {
+    const int ringCount = 2000, walkerCount = 500, frames = 240, sampleFrames = 10;
+    const std::string levelPath = "maps/pf/pf1";
+    if(!openWindow(256, 144, "software")) {
+        fail("can't run the object determinism check: %s", SDL_GetError());
+        return;
+    }
+
+    // only rings have a prepareUpdate so far, they are what runs on the workers
+    // the states of every object and the character are sampled along the way, not just at the end
+    auto run = [&]() {
+        Level level(levelPath);
+        spawnCrowd(level, ringCount, walkerCount);
+        std::vector<TA_ObjectState> states;
+        for(int frame = 1; frame <= frames; frame++) {
+            level.update();
+            if(frame % sampleFrames == 0) {
+                std::vector<TA_ObjectState> frameStates = level.objectSet.getObjectStates();
+                states.insert(states.end(), frameStates.begin(), frameStates.end());
+                TA_Point position = level.character.getPosition();
+                states.push_back({-1, position.x, position.y, 0, 0, 0, 0, 0});
+            }
+        }
+        return states;
+    };
+
+    long long updateThreads = TA::save::getParameter("update_threads");
+    int threadCount = std::max(1, SDL_GetNumLogicalCPUCores() - 1);
+    auto setThreads = [&](bool enabled) {
+        TA::save::setParameter("update_threads", enabled ? threadCount : 0);
+        if(enabled) {
+            TA::threadPool::init(threadCount);
+        } else {
+            TA::threadPool::quit();
+        }
+    };
+    auto comparison = compare(setThreads, run);
+    TA::threadPool::quit();
+    TA::save::setParameter("update_threads", updateThreads);
+
+    std::string name = describe("object determinism, %s, %i rings and %i walkers, %i frames", levelPath.c_str(),
+        ringCount, walkerCount, frames);
+    report(name, "serial", describe("%i threads", threadCount + 1).c_str(), comparison);
+
+    closeWindow();
+}
+
+void TA::benchmark::levelFrames() {
+    const int warmupFrames = 120, frames = 600;
+    const std::string levelPath = "maps/pf/pf1";
+    if(!openWindow(256, 144, "software")) {
+        fail("can't run the level frames check: %s", SDL_GetError());
+        return;
+    }
+
+    {
+        Level level(levelPath);
+        auto frame = [&]() {
+            level.update();
+            SDL_RenderClear(TA::renderer);
+            level.draw();
+            SDL_RenderPresent(TA::renderer);
+        };
+        // the character lands and the object set's buffers grow to their working size first
+        for(int pos = 0; pos < warmupFrames; pos++) {
+            frame();
+        }
+
+        long long allocations = 0;
+        double time = measure([&]() {
+            long long start = TA::allocCounter::get();
+            for(int pos = 0; pos < frames; pos++) {
+                frame();
+            }
+            allocations = TA::allocCounter::get() - start;
+        });
+        printLog("level frames, %s, %i frames: %lld allocations %.2f ms", levelPath.c_str(), frames, allocations,
+            time);
+        if(allocations != 0) {
+            fail("level frames allocated %lld times, expected none", allocations);
+        }
+    }
+
+    closeWindow();
+}
@@ -0,0 +1,126 @@
+#ifndef TA_BENCHMARK_REFERENCE_POLYGON_H
+#define TA_BENCHMARK_REFERENCE_POLYGON_H
+
+#include <cmath>
+#include <vector>
+#include "geometry.h"
+
+// the polygon tile hitboxes used before TA_ConvexPolygon, kept as it was so the slope benchmark has a baseline
+// it was moved to every tile's position before each check and tested edge against edge
+namespace TA::benchmark::reference {
+    class Line {
+    public:
+        Line(const TA_Point& p1, const TA_Point& p2)
+            : p1(p1), p2(p2), a(p2.y - p1.y), b(p1.x - p2.x), c((p2.x * p1.y) - (p1.x * p2.y)) {
+            const float k = (c > 0 ? -1.0 : 1.0) / std::sqrt((a * a) + (b * b));
+            a *= k;
+            b *= k;
+            c *= k;
+        }
+
+        [[nodiscard]] const TA_Point& getFirst() const { return p1; }
+        [[nodiscard]] const TA_Point& getSecond() const { return p2; }
+
+        [[nodiscard]] float getDeviation(const TA_Point& point) const { return (a * point.x) + (b * point.y) + c; }
+
+        [[nodiscard]] bool intersects(const Line& rv) const {
+            const float s1 = getDeviation(rv.getFirst());
+            const float s2 = getDeviation(rv.getSecond());
+            const float s3 = rv.getDeviation(getFirst());
+            const float s4 = rv.getDeviation(getSecond());
+            return s1 * s2 <= 0 && s3 * s4 <= 0;
+        }
+
+    private:
+        TA_Point p1, p2;
+        float a = 0, b = 0, c = 0;
+    };
+
+    class Polygon {
+    public:
+        void setPosition(const TA_Point& newPosition) {
+            position = newPosition;
+            updateVertexList();
+        }
+
+        void addVertex(const TA_Point& vertex) {
+            sourceVertexList.push_back(vertex);
+            updateVertexList();
+
+            rect = (vertexList.size() == 4 && TA::equal(getVertex(1).x, getVertex(2).x) &&
+                    TA::equal(getVertex(1).y, getVertex(0).y) && TA::equal(getVertex(3).x, getVertex(0).x) &&
+                    TA::equal(getVertex(3).y, getVertex(2).y));
+        }
+
+        [[nodiscard]] bool inside(const TA_Point& point) const {
+            if(isRectangle()) [[likely]] {
+                return getTopLeft().x <= point.x && point.x <= getBottomRight().x && getTopLeft().y <= point.y &&
+                       point.y <= getBottomRight().y;
+            }
+
+            const Line ray{point, {1e5, point.y}};
+            int count = 0;
+
+            for(size_t pos = 0; pos < vertexList.size(); pos += 1) {
+                const Line currentLine{vertexList[pos], vertexList[(pos + 1) % vertexList.size()]};
+                if(ray.intersects(currentLine)) {
+                    count += 1;
+                }
+            }
+
+            return count % 2 == 1;
+        }
+
+        [[nodiscard]] bool intersects(const TA_Rect& rv) const {
+            if(isRectangle()) [[likely]] {
+                return getTopLeft().x < rv.getBottomRight().x && getBottomRight().x > rv.getTopLeft().x &&
+                       getTopLeft().y < rv.getBottomRight().y && getBottomRight().y > rv.getTopLeft().y;
+            }
+
+            if(empty()) [[unlikely]] {
+                return false;
+            }
+
+            for(int pos1 = 0; pos1 < size(); pos1++) {
+                const Line line1 = {getVertex(pos1), getVertex((pos1 + 1) % size())};
+                for(int pos2 = 0; pos2 < 4; pos2++) {
+                    const Line line2 = {rv.getVertex(pos2), rv.getVertex((pos2 + 1) % 4)};
+                    if(line1.intersects(line2)) {
+                        return true;
+                    }
+                }
+            }
+
+            if(rv.inside(getVertex(0))) {
+                return true;
+            }
+            if(inside(rv.getVertex(0))) {
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] int size() const { return static_cast<int>(vertexList.size()); }
+        [[nodiscard]] bool empty() const { return size() == 0; }
+        [[nodiscard]] bool isRectangle() const { return rect; }
+
+        [[nodiscard]] const TA_Point& getVertex(const size_t& pos) const { return vertexList[pos]; }
+        [[nodiscard]] const TA_Point& getTopLeft() const { return getVertex(0); }
+        [[nodiscard]] const TA_Point& getBottomRight() const { return getVertex(2); }
+
+    private:
+        std::vector<TA_Point> vertexList;
+        std::vector<TA_Point> sourceVertexList;
+        TA_Point position;
+        bool rect = false;
+
+        void updateVertexList() {
+            vertexList = sourceVertexList;
+            for(TA_Point& vertex : vertexList) {
+                vertex = vertex + position;
+            }
+        }
+    };
+}
+
+#endif // TA_BENCHMARK_REFERENCE_POLYGON_H
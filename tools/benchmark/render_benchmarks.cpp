@@ -0,0 +1,211 @@
+#include <array>
+#include <optional>
+#include <random>
+#include <vector>
+#include "benchmarks.h"
+#include "camera.h"
+#include "cpu_renderer.h"
+#include "harness.h"
+#include "resource_manager.h"
+#include "sprite.h"
+#include "thread_pool.h"
+#include "tilemap.h"
+#include "tools.h"
+
+void TA::benchmark::present(const char* driver) {
+    const int screenWidth = 320, screenHeight = 180, scale = 4, tileSize = 16, frames = 300;
+    const int windowWidth = screenWidth * scale, windowHeight = screenHeight * scale;
+
+    SDL_Window* window = SDL_CreateWindow("benchmark", windowWidth, windowHeight, SDL_WINDOW_HIDDEN);
+    SDL_Renderer* renderer = (window == nullptr ? nullptr : SDL_CreateRenderer(window, driver));
+    if(renderer == nullptr) {
+        printWarning("skipping present benchmark for %s: %s", (driver == nullptr ? "default" : driver), SDL_GetError());
+        SDL_DestroyWindow(window);
+        return;
+    }
+
+    std::mt19937 gen(1);
+    std::vector<Uint32> pixels(tileSize * tileSize);
+    for(Uint32& pixel : pixels) {
+        pixel = gen() | 0xFF;
+    }
+    SDL_Texture* tiles =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, tileSize, tileSize);
+    SDL_UpdateTexture(tiles, nullptr, pixels.data(), tileSize * 4);
+    SDL_SetTextureScaleMode(tiles, SDL_SCALEMODE_NEAREST);
+    SDL_Texture* target =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, windowWidth, windowHeight);
+    SDL_SetTextureScaleMode(target, SDL_SCALEMODE_NEAREST);
+
+    auto drawScene = [&](int frame) {
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+        for(int x = 0; x < screenWidth; x += tileSize) {
+            for(int y = 0; y < screenHeight; y += tileSize) {
+                SDL_FRect dstRect{static_cast<float>(((x + frame) % screenWidth) * scale),
+                    static_cast<float>(y * scale), static_cast<float>(tileSize * scale),
+                    static_cast<float>(tileSize * scale)};
+                SDL_RenderTexture(renderer, tiles, nullptr, &dstRect);
+            }
+        }
+    };
+
+    // what the direct_present setting switches between at integer scales
+    bool direct = false;
+    auto comparison = compare([&](bool enabled) { direct = enabled; }, [&]() {
+        std::vector<Uint8> firstFrame;
+        for(int frame = 0; frame < frames; frame++) {
+            SDL_SetRenderTarget(renderer, (direct ? nullptr : target));
+            drawScene(frame);
+            if(!direct) {
+                SDL_SetRenderTarget(renderer, nullptr);
+                SDL_RenderClear(renderer);
+                SDL_RenderTexture(renderer, target, nullptr, nullptr);
+            }
+            if(frame == 0) {
+                firstFrame = readPixels(renderer);
+            }
+            SDL_RenderPresent(renderer);
+        }
+        return firstFrame;
+    });
+    report(describe("present, %s renderer, %ix%i, %i frames", SDL_GetRendererName(renderer), windowWidth,
+               windowHeight, frames),
+        "target texture", "direct", comparison);
+
+    SDL_DestroyTexture(target);
+    SDL_DestroyTexture(tiles);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+}
+
+void TA::benchmark::cpuRenderer() {
+    const int scale = 4, frames = 300;
+    TA_Context context;
+    context.screenWidth = 256;
+    context.screenHeight = 144;
+    context.elapsedTime = 1;
+    const int windowWidth = context.screenWidth * scale, windowHeight = context.screenHeight * scale;
+
+    if(!openWindow(windowWidth, windowHeight, "software")) {
+        printWarning("skipping cpu renderer benchmark: %s", SDL_GetError());
+        return;
+    }
+    TA::threadPool::init(TA::cpuRenderer::getThreadCount());
+    TA::cpuRenderer::MemoryStats memory;
+    SDL_FRect dstRect{0, 0, static_cast<float>(windowWidth), static_cast<float>(windowHeight)};
+
+    for(const char* filename : maps) {
+        std::optional<TA_Tilemap> tilemap;
+        TA_Camera camera;
+        TA_Point follow;
+        camera.setContext(&context);
+
+        // textures are loaded once per renderer, the cpu renderer doesn't upload them to SDL
+        auto setCpuRenderer = [&](bool enabled) {
+            tilemap.reset();
+            TA::resmgr::quit();
+            TA::cpuRenderer::setEnabled(enabled);
+            TA::scaleFactor = (enabled ? 1 : scale);
+            tilemap.emplace();
+            tilemap->load(&context, filename);
+            tilemap->setCamera(&camera);
+        };
+
+        auto comparison = compare(setCpuRenderer, [&]() {
+            std::vector<Uint8> firstFrame;
+            for(int frame = 0; frame < frames; frame++) {
+                context.animationClock += context.elapsedTime;
+                int range = std::max(1, tilemap->getWidth() - context.screenWidth);
+                follow = TA_Point(static_cast<float>(frame * 2 % range), static_cast<float>(tilemap->getHeight() / 2));
+                camera.setFollowPosition(&follow);
+
+                if(TA::cpuRenderer::isEnabled()) {
+                    TA::cpuRenderer::beginFrame(context.screenWidth, context.screenHeight);
+                } else {
+                    SDL_SetRenderDrawColor(TA::renderer, 0, 0, 0, 255);
+                    SDL_RenderClear(TA::renderer);
+                }
+                tilemap->draw(0);
+                tilemap->draw(1);
+                if(TA::cpuRenderer::isEnabled()) {
+                    SDL_RenderClear(TA::renderer);
+                    TA::cpuRenderer::present(scale, dstRect, false);
+                }
+                if(frame == 0) {
+                    firstFrame = readPixels(TA::renderer);
+                }
+                SDL_RenderPresent(TA::renderer);
+            }
+            return firstFrame;
+        });
+        report(describe("cpu renderer, %s, %i frames", filename, frames), "sdl software", "cpu", comparison);
+
+        memory.stored += TA::cpuRenderer::getMemoryStats().stored;
+        memory.expanded += TA::cpuRenderer::getMemoryStats().expanded;
+    }
+
+    printLog("cpu renderer textures: %zu KiB stored, %zu KiB as 32-bit", memory.stored / 1024, memory.expanded / 1024);
+    TA::cpuRenderer::setEnabled(false);
+    TA::cpuRenderer::quit();
+    TA::threadPool::quit();
+    closeWindow();
+}
+
+void TA::benchmark::paletteSwap() {
+    const int frames = 120;
+    TA_Context context;
+    context.screenWidth = 256;
+    context.screenHeight = 144;
+    context.elapsedTime = 1;
+
+    if(!openWindow(context.screenWidth, context.screenHeight, "software")) {
+        fail("can't run the palette swap check: %s", SDL_GetError());
+        return;
+    }
+    TA::cpuRenderer::setEnabled(true);
+    TA::scaleFactor = 1;
+    SDL_FRect dstRect{0, 0, static_cast<float>(context.screenWidth), static_cast<float>(context.screenHeight)};
+
+    // a plain draw, a red flash, a night vision green and a blink, the kinds of tint sprites can ask for
+    const std::array<SDL_Color, 4> mods{{{255, 255, 255, 255}, {255, 96, 96, 255}, {96, 255, 96, 255},
+        {255, 255, 255, 128}}};
+    std::optional<TA_Sprite> sprite;
+
+    // textures are stored indexed or as 32-bit when they are loaded
+    auto setIndexed = [&](bool enabled) {
+        sprite.reset();
+        TA::resmgr::quit();
+        TA::cpuRenderer::setIndexed(enabled);
+        sprite.emplace();
+        sprite->loadFromToml(&context, "tails/tails.toml");
+        sprite->setAnimation("walk");
+    };
+
+    auto comparison = compare(setIndexed, [&]() {
+        std::vector<Uint8> pixels;
+        for(int frame = 0; frame < frames; frame++) {
+            context.animationClock += context.elapsedTime;
+            TA::cpuRenderer::beginFrame(context.screenWidth, context.screenHeight);
+            for(int pos = 0; pos < static_cast<int>(mods.size()); pos++) {
+                sprite->setPosition(static_cast<float>(8 + (pos * 60)), 48);
+                sprite->setColorMod(mods[pos].r, mods[pos].g, mods[pos].b);
+                sprite->setAlpha(mods[pos].a);
+                sprite->draw();
+            }
+            SDL_RenderClear(TA::renderer);
+            TA::cpuRenderer::present(1, dstRect, false);
+            std::vector<Uint8> framePixels = readPixels(TA::renderer);
+            pixels.insert(pixels.end(), framePixels.begin(), framePixels.end());
+            SDL_RenderPresent(TA::renderer);
+        }
+        return pixels;
+    });
+    report(describe("palette swap, %i frames", frames), "32-bit", "indexed", comparison);
+
+    sprite.reset();
+    TA::cpuRenderer::setEnabled(false);
+    TA::cpuRenderer::setIndexed(true);
+    TA::cpuRenderer::quit();
+    closeWindow();
+}